@@ -164,3 +164,21 @@ if (OTBR_LINK_METRICS_TELEMETRY)
 else()
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LINK_METRICS_TELEMETRY=0)
 endif()
+
+option(OTBR_NCP_IO_THREAD "Forward IPv6 packets between the TUN device and the NCP on a dedicated thread" OFF)
+if (OTBR_NCP_IO_THREAD)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NCP_IO_THREAD=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NCP_IO_THREAD=0)
+endif()
+
+option(OTBR_NCP_IP6_TX_TAIL_DROP "Drop new IPv6 packets of any protocol when the NCP transmit queue is full" OFF)
+if (OTBR_NCP_IP6_TX_TAIL_DROP)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NCP_IP6_TX_TAIL_DROP=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NCP_IP6_TX_TAIL_DROP=0)
+endif()
+
+set(OTBR_COMPILE_LOG_LEVEL "DEBUG" CACHE STRING "The most verbose log level compiled in")
+set_property(CACHE OTBR_COMPILE_LOG_LEVEL PROPERTY STRINGS "EMERG" "ALERT" "CRIT" "ERR" "WARNING" "NOTICE" "INFO" "DEBUG")
+target_compile_definitions(otbr-config INTERFACE OTBR_COMPILE_LOG_LEVEL=OTBR_LOG_${OTBR_COMPILE_LOG_LEVEL})
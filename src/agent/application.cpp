@@ -191,15 +191,21 @@ otbrError Application::Run(void)
             // check the sensor state every 10 seconds
             if (currentTime - lastTime > 10)
             {
+                Timepoint start = MainloopManager::GetInstance().StartSection();
+
                 lastTime = currentTime;
                 otbrLogInfo("Checking sensors state...");
                 // check the sensors state
                 mHost->CheckSensorsState();
+                MainloopManager::GetInstance().EndSection("otbr::Ncp::ThreadHost::CheckSensorsState()", start);
             }
 #if __linux__
             {
+                Timepoint   start        = MainloopManager::GetInstance().StartSection();
                 const char *newInfraLink = mInfraLinkSelector.Select();
 
+                MainloopManager::GetInstance().EndSection("otbr::Utils::InfraLinkSelector::Select()", start);
+
                 if (mBackboneInterfaceName != newInfraLink)
                 {
                     error = OTBR_ERROR_INFRA_LINK_CHANGED;
@@ -36,6 +36,7 @@
 #include <fstream>
 
 #include <assert.h>
+#include <errno.h>
 #include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -53,6 +54,7 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/types.hpp"
 #include "ncp/thread_host.hpp"
 #include "common/database.hpp"
@@ -82,6 +84,9 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_ASYNC_LOG,
+    OTBR_OPT_BINARY_LOG,
+    OTBR_OPT_MAINLOOP_PROFILING,
 };
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
@@ -102,6 +107,9 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"async-log", no_argument, nullptr, OTBR_OPT_ASYNC_LOG},
+    {"binary-log", required_argument, nullptr, OTBR_OPT_BINARY_LOG},
+    {"mainloop-profiling", optional_argument, nullptr, OTBR_OPT_MAINLOOP_PROFILING},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -148,7 +156,11 @@ static void PrintHelp(const char *aProgramName)
             "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [-s] [--auto-attach[=0/1]] "
             "RADIO_URL [RADIO_URL]\n"
             "    --auto-attach defaults to 1\n"
-            "    -s disables syslog and prints to standard out\n",
+            "    -s disables syslog and prints to standard out\n"
+            "    --async-log writes logs from a background thread\n"
+            "    --binary-log=PATH appends logs to PATH in the binary format, see log-decoder\n"
+            "    --mainloop-profiling[=BUDGET_MS] records mainloop latencies and reports iterations over BUDGET_MS, "
+            "defaults to 100\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
@@ -209,6 +221,10 @@ static int realmain(int argc, char *argv[])
     bool                      syslogDisable     = false;
     bool                      printRadioVersion = false;
     bool                      enableAutoAttach  = true;
+    bool                      asyncLog          = false;
+    const char               *binaryLogPath     = nullptr;
+    bool                      mainloopProfiling = false;
+    long                      stallBudget       = otbr::MainloopManager::kDefaultStallBudget.count();
     const char               *restListenAddress = "";
     int                       restListenPort    = kPortNumber;
     std::vector<const char *> radioUrls;
@@ -278,6 +294,22 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_ASYNC_LOG:
+            asyncLog = true;
+            break;
+
+        case OTBR_OPT_BINARY_LOG:
+            binaryLogPath = optarg;
+            break;
+
+        case OTBR_OPT_MAINLOOP_PROFILING:
+            mainloopProfiling = true;
+            if (optarg != nullptr)
+            {
+                VerifyOrExit(ParseInteger(optarg, stallBudget) && stallBudget >= 0, ret = EXIT_FAILURE);
+            }
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -286,6 +318,19 @@ static int realmain(int argc, char *argv[])
     }
 
     otbrLogInit(argv[0], logLevel, verbose, syslogDisable);
+    if (asyncLog)
+    {
+        otbrLogAsyncStart();
+    }
+    if (binaryLogPath != nullptr && otbrLogBinaryStart(binaryLogPath) != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to open binary log %s: %s", binaryLogPath, strerror(errno));
+        ExitNow(ret = EXIT_FAILURE);
+    }
+    if (mainloopProfiling)
+    {
+        otbr::MainloopManager::GetInstance().EnableProfiling(otbr::Milliseconds(stallBudget));
+    }
     otbrLogNotice("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogNotice("Thread version: %s", otbr::Ncp::RcpHost::GetThreadVersion());
     otbrLogNotice("Thread interface: %s", interfaceName);
@@ -51,7 +51,7 @@ BackboneAgent::BackboneAgent(otbr::Ncp::RcpHost &aHost, std::string aInterfaceNa
     : mHost(aHost)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
 #if OTBR_ENABLE_DUA_ROUTING
-    , mNdProxyManager(aHost, aBackboneInterfaceName)
+    , mNdProxyManager(*this, aBackboneInterfaceName)
     , mDuaRoutingManager(aInterfaceName, aBackboneInterfaceName)
 #endif
 {
@@ -196,6 +196,14 @@ void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEven
 {
     mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
 }
+
+otbrError BackboneAgent::GetNdProxyInfo(const Ip6Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo)
+{
+    return otBackboneRouterGetNdProxyInfo(mHost.GetInstance(), reinterpret_cast<const otIp6Address *>(&aDua),
+                                          &aNdProxyInfo) == OT_ERROR_NONE
+               ? OTBR_ERROR_NONE
+               : OTBR_ERROR_NOT_FOUND;
+}
 #endif
 
 } // namespace BackboneRouter
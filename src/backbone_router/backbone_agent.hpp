@@ -64,7 +64,11 @@ namespace BackboneRouter {
 /**
  * This class implements Thread Backbone agent functionality.
  */
+#if OTBR_ENABLE_DUA_ROUTING
+class BackboneAgent : private NonCopyable, private NdProxyManager::Dependencies
+#else
 class BackboneAgent : private NonCopyable
+#endif
 {
 public:
     static constexpr uint16_t kBackboneUdpPort = 61631; ///< The BBR port.
@@ -97,6 +101,7 @@ private:
                                                  otBackboneRouterNdProxyEvent aEvent,
                                                  const otIp6Address          *aAddress);
     void        HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aAddress);
+    otbrError   GetNdProxyInfo(const Ip6Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo) override;
 #endif
 
     static const char *StateToString(otBackboneRouterState aState);
@@ -35,63 +35,86 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include <net/if.h>
+
+#include <linux/rtnetlink.h>
+
 #include "common/code_utils.hpp"
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+constexpr uint32_t DuaRoutingManager::kDefaultRouteMetric;
+constexpr uint32_t DuaRoutingManager::kOpenThreadRouteTable;
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(!mEnabled);
-    mEnabled = true;
 
     mDomainPrefix = aDomainPrefix;
 
+    SuccessOrExit(error = mRouteNetlink.Open());
     AddDefaultRouteToThread();
     AddPolicyRouteToBackbone();
+    SuccessOrExit(error = mRouteNetlink.Commit());
+
+    mEnabled = true;
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    if (error != OTBR_ERROR_NONE && mRouteNetlink.IsOpen())
+    {
+        // Some of the routes may have been added, remove them so that a later `Enable()` starts over.
+        DelDefaultRouteToThread();
+        DelPolicyRouteToBackbone();
+        mRouteNetlink.Commit();
+        mRouteNetlink.Close();
+    }
+
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
     DelDefaultRouteToThread();
     DelPolicyRouteToBackbone();
+    error = mRouteNetlink.Commit();
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::AddDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mRouteNetlink.AddRoute(mDomainPrefix, if_nametoindex(mInterfaceName.c_str()), RT_TABLE_MAIN, kDefaultRouteMetric);
 }
 
 void DuaRoutingManager::DelDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mRouteNetlink.DeleteRoute(mDomainPrefix, if_nametoindex(mInterfaceName.c_str()), RT_TABLE_MAIN,
+                              kDefaultRouteMetric);
 }
 
 void DuaRoutingManager::AddPolicyRouteToBackbone(void)
 {
     // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mRouteNetlink.AddRule(mInterfaceName, kOpenThreadRouteTable);
+    mRouteNetlink.AddRoute(mDomainPrefix, if_nametoindex(mBackboneInterfaceName.c_str()), kOpenThreadRouteTable,
+                           /* aMetric */ 0);
 }
 
 void DuaRoutingManager::DelPolicyRouteToBackbone(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mRouteNetlink.DeleteRule(mInterfaceName, kOpenThreadRouteTable);
+    mRouteNetlink.DeleteRoute(mDomainPrefix, if_nametoindex(mBackboneInterfaceName.c_str()), kOpenThreadRouteTable,
+                              /* aMetric */ 0);
 }
 
 } // namespace BackboneRouter
@@ -44,7 +44,7 @@
 
 #include "common/code_utils.hpp"
 #include "ncp/rcp_host.hpp"
-#include "utils/system_utils.hpp"
+#include "utils/route_netlink.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -85,6 +85,9 @@ public:
     void Disable(void);
 
 private:
+    static constexpr uint32_t kDefaultRouteMetric   = 1;
+    static constexpr uint32_t kOpenThreadRouteTable = 88; ///< The "openthread" table, see script/_rt_tables.
+
     void AddDefaultRouteToThread(void);
     void DelDefaultRouteToThread(void);
     void AddPolicyRouteToBackbone(void);
@@ -94,6 +97,8 @@ private:
     bool        mEnabled : 1;
     std::string mInterfaceName;
     std::string mBackboneInterfaceName;
+
+    Utils::RouteNetlink mRouteNetlink;
 };
 
 /**
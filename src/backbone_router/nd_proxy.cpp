@@ -40,12 +40,15 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <fcntl.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #if __linux__
 #include <linux/netfilter.h>
 #else
@@ -53,14 +56,70 @@
 #endif
 
 #include "backbone_router/constants.hpp"
+#include "backbone_router/nd_proxy_filter.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
+constexpr Milliseconds NdProxyManager::kGroupRetryInterval;
+
+otbrError NdProxyManager::Dependencies::GetNdProxyInfo(const Ip6Address            &aDua,
+                                                       otBackboneRouterNdProxyInfo &aNdProxyInfo)
+{
+    OTBR_UNUSED_VARIABLE(aDua);
+    OTBR_UNUSED_VARIABLE(aNdProxyInfo);
+
+    return OTBR_ERROR_NOT_FOUND;
+}
+
+namespace {
+
+std::string GetInterfaceSysctlPath(const std::string &aInterfaceName, const char *aName)
+{
+    return "/proc/sys/net/ipv6/conf/" + aInterfaceName + "/" + aName;
+}
+
+otbrError ReadInterfaceSysctl(const std::string &aInterfaceName, const char *aName, char &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       fd    = open(GetInterfaceSysctlPath(aInterfaceName, aName).c_str(), O_RDONLY | O_CLOEXEC);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(read(fd, &aValue, sizeof(aValue)) == sizeof(aValue), error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+otbrError WriteInterfaceSysctl(const std::string &aInterfaceName, const char *aName, char aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       fd    = open(GetInterfaceSysctlPath(aInterfaceName, aName).c_str(), O_WRONLY | O_CLOEXEC);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(write(fd, &aValue, sizeof(aValue)) == sizeof(aValue), error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+} // namespace
+
 void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -72,6 +131,12 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
 
     SuccessOrExit(error = InitIcmp6RawSocket());
     SuccessOrExit(error = UpdateMacAddress());
+
+    // Let the kernel answer unicast Neighbor Solicitations when possible,
+    // so that they don't take a round-trip through NFQUEUE.
+    VerifyOrExit(InitKernelProxy() != OTBR_ERROR_NONE);
+
+    otbrLogInfo("NdProxyManager: Kernel ND proxy is unavailable, fall back to NFQUEUE");
     SuccessOrExit(error = InitNetfilterQueue());
 
     // Add ip6tables rule for unicast ICMPv6 messages
@@ -97,6 +162,13 @@ void NdProxyManager::Disable(void)
 
     VerifyOrExit(IsEnabled());
 
+    if (IsKernelProxyEnabled())
+    {
+        FiniKernelProxy();
+        FiniIcmp6RawSocket();
+        ExitNow();
+    }
+
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
 
@@ -128,12 +200,34 @@ void NdProxyManager::Update(MainloopContext &aMainloop)
     {
         aMainloop.AddFdToReadSet(mUnicastNsQueueSock);
     }
+
+    if (HasPendingChanges())
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+    else if (IsEnabled() && mNdProxyTable.HasGroupChanges())
+    {
+        auto delay = std::max(std::chrono::duration_cast<Microseconds>(mGroupRetryTime - Clock::now()),
+                              Microseconds::zero());
+
+        if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+        {
+            aMainloop.mTimeout = ToTimeval(delay);
+        }
+    }
 }
 
 void NdProxyManager::Process(const MainloopContext &aMainloop)
 {
     VerifyOrExit(IsEnabled());
 
+    // Solicitations are only answered once the changes are synced, so that no NA is sent for a DUA whose group is
+    // not joined or whose proxy entry is not committed yet.
+    if (HasPendingChanges())
+    {
+        SyncPendingChanges();
+    }
+
     if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
     {
         ProcessMulticastNeighborSolicition();
@@ -147,44 +241,76 @@ exit:
     return;
 }
 
-void NdProxyManager::ProcessMulticastNeighborSolicition()
+void NdProxyManager::ProcessMulticastNeighborSolicition(void)
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
-    struct icmp6_hdr *icmp6header;
-    struct cmsghdr   *cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
-    otbrError         error = OTBR_ERROR_NONE;
-    bool              found = false;
+    // Only Neighbor Solicitations for targets in the Domain Prefix make it to
+    // the socket (see `NdProxyFilter`), they are received in batches.
+    struct mmsghdr messages[kMaxReceiveBatchSize];
+    struct iovec   iovecs[kMaxReceiveBatchSize];
+    sockaddr_in6   sources[kMaxReceiveBatchSize];
+    unsigned char  cbufs[kMaxReceiveBatchSize][2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
+    uint8_t        packets[kMaxReceiveBatchSize][kMaxICMP6PacketSize];
+    int            count;
+    size_t         numAnswered = 0;
+    otbrError      error       = OTBR_ERROR_NONE;
+
+    memset(messages, 0, sizeof(messages));
+
+    for (size_t i = 0; i < kMaxReceiveBatchSize; i++)
+    {
+        iovecs[i].iov_base = packets[i];
+        iovecs[i].iov_len  = sizeof(packets[i]);
+
+        messages[i].msg_hdr.msg_name       = &sources[i];
+        messages[i].msg_hdr.msg_namelen    = sizeof(sources[i]);
+        messages[i].msg_hdr.msg_iov        = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen     = 1;
+        messages[i].msg_hdr.msg_control    = cbufs[i];
+        messages[i].msg_hdr.msg_controllen = sizeof(cbufs[i]);
+    }
+
+    count = recvmmsg(mIcmp6RawSock, messages, kMaxReceiveBatchSize, MSG_DONTWAIT, nullptr);
+    VerifyOrExit(count > 0, error = OTBR_ERROR_ERRNO);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (HandleMulticastNeighborSolicitation(messages[i].msg_hdr, messages[i].msg_len))
+        {
+            numAnswered++;
+        }
+    }
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
+    UpdateSolicitationCounters(static_cast<size_t>(count), numAnswered);
 
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("NdProxyManager: Failed to receive ICMPv6 packets: %s", strerror(errno));
+    }
+}
 
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
+bool NdProxyManager::HandleMulticastNeighborSolicitation(msghdr &aMessage, size_t aLength)
+{
+    const uint8_t   *packet = static_cast<const uint8_t *>(aMessage.msg_iov[0].iov_base);
+    struct cmsghdr  *cmsghdr;
+    const icmp6_hdr *icmp6header;
+    otbrError        error = OTBR_ERROR_NONE;
+    bool             found = false;
 
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aLength >= sizeof(struct nd_neighbor_solicit), error = OTBR_ERROR_PARSE);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        const sockaddr_in6 &sin6 = *static_cast<const sockaddr_in6 *>(aMessage.msg_name);
+        const Ip6Address   &src  = *reinterpret_cast<const Ip6Address *>(&sin6.sin6_addr);
 
-        icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
+        icmp6header = reinterpret_cast<const icmp6_hdr *>(packet);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
 
         otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        for (cmsghdr = CMSG_FIRSTHDR(&aMessage); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMessage, cmsghdr))
         {
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
@@ -200,14 +326,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     Ip6Address         &dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
+                    found = mNdProxyTable.ContainsSolicitedNodeGroup(dst);
 
                     otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
                                  found ? "Y" : "N");
@@ -221,7 +340,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
                     otbrLogDebug("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
 
-                    VerifyOrExit(hops == 255);
+                    VerifyOrExit(hops == 255, error = OTBR_ERROR_PARSE);
                 }
                 break;
             }
@@ -230,8 +349,8 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
         VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
 
         {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
-            Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
+            const struct nd_neighbor_solicit *ns     = reinterpret_cast<const struct nd_neighbor_solicit *>(packet);
+            const Ip6Address                 &target = *reinterpret_cast<const Ip6Address *>(&ns->nd_ns_target);
 
             otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
                         target.ToString().c_str());
@@ -242,6 +361,29 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return error == OTBR_ERROR_NONE;
+}
+
+void NdProxyManager::UpdateSolicitationCounters(size_t aNumReceived, size_t aNumAnswered)
+{
+    Timepoint now = Clock::now();
+    double    seconds;
+
+    mNumReceivedSolicitations += aNumReceived;
+    mNumAnsweredSolicitations += aNumAnswered;
+
+    seconds = std::chrono::duration<double>(now - mCountersStartTime).count();
+    VerifyOrExit(seconds >= 1);
+
+    otbrLogInfo("NdProxyManager: Processed %.1f multicast NS per second (%.1f answered)",
+                mNumReceivedSolicitations / seconds, mNumAnsweredSolicitations / seconds);
+
+    mCountersStartTime        = now;
+    mNumReceivedSolicitations = 0;
+    mNumAnsweredSolicitations = 0;
+
+exit:
+    return;
 }
 
 void NdProxyManager::ProcessUnicastNeighborSolicition(void)
@@ -269,35 +411,96 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
         target = Ip6Address(aDua->mFields.m8);
     }
 
+    // Any failed joins or leaves are retried along with the changes below.
+    mGroupRetryTime = Timepoint();
+
+    // Only the table is updated here, the group memberships and the kernel
+    // proxy entries are synced by the next `Process()`, so that a burst of
+    // events (e.g. when becoming the Primary BBR) is applied as one diff.
     switch (aEvent)
     {
     case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
     case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
-    {
-        bool isNewInsert = mNdProxySet.insert(target).second;
-
-        if (isNewInsert)
+        if (mNdProxyTable.Add(target) && IsKernelProxyEnabled())
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            mRouteNetlink.AddNeighborProxy(target, mBackboneIfIndex);
         }
 
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        // Advertised by `SyncPendingChanges()`, after the group is joined and the proxy entry is committed, so
+        // that the traffic the NA attracts is not dropped. Nothing is advertised while disabled, and the list
+        // would otherwise grow with every renewal until the next `Enable()`.
+        if (IsEnabled())
+        {
+            mPendingAdvertisements.push_back(target);
+        }
         break;
-    }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        if (mNdProxyTable.Remove(target) && IsKernelProxyEnabled())
+        {
+            mRouteNetlink.DeleteNeighborProxy(target, mBackboneIfIndex);
+        }
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
-        for (const Ip6Address &proxingTarget : mNdProxySet)
+        if (IsKernelProxyEnabled())
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            for (const Ip6Address &proxingTarget : mNdProxyTable)
+            {
+                mRouteNetlink.DeleteNeighborProxy(proxingTarget, mBackboneIfIndex);
+            }
         }
-        mNdProxySet.clear();
+        mNdProxyTable.Clear();
+        mPendingAdvertisements.clear();
         break;
     }
 }
 
+bool NdProxyManager::HasPendingChanges(void) const
+{
+    return IsEnabled() &&
+           ((mNdProxyTable.HasGroupChanges() && Clock::now() >= mGroupRetryTime) ||
+            mRouteNetlink.GetPendingRequestCount() > 0 || !mPendingAdvertisements.empty());
+}
+
+void NdProxyManager::SyncPendingChanges(void)
+{
+    size_t numJoined = 0;
+    size_t numLeft   = 0;
+
+    mNdProxyTable.SyncGroups(
+        [this, &numJoined](const Ip6Address &aGroup) {
+            numJoined++;
+            return UpdateSolicitedNodeMulticastGroup(aGroup, /* aIsJoin */ true) == OTBR_ERROR_NONE;
+        },
+        [this, &numLeft](const Ip6Address &aGroup) {
+            numLeft++;
+            return UpdateSolicitedNodeMulticastGroup(aGroup, /* aIsJoin */ false) == OTBR_ERROR_NONE;
+        });
+
+    // The groups which failed to be joined or left are kept as changes, retry them later rather than spinning.
+    if (mNdProxyTable.HasGroupChanges())
+    {
+        mGroupRetryTime = Clock::now() + kGroupRetryInterval;
+    }
+
+    if (mRouteNetlink.GetPendingRequestCount() > 0)
+    {
+        mRouteNetlink.Commit();
+    }
+
+    for (const Ip6Address &target : mPendingAdvertisements)
+    {
+        // The DUA may have been removed after it was added.
+        if (mNdProxyTable.Contains(target))
+        {
+            SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        }
+    }
+    mPendingAdvertisements.clear();
+
+    otbrLogInfo("NdProxyManager: Proxying %zu DUAs in %zu solicited-node groups, joined %zu and left %zu groups",
+                mNdProxyTable.size(), mNdProxyTable.GetGroupCount(), numJoined, numLeft);
+}
+
 void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
 {
     uint8_t                    packet[kMaxICMP6PacketSize];
@@ -309,9 +512,7 @@ void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const
     otbrError                  error = OTBR_ERROR_NONE;
     otBackboneRouterNdProxyInfo aNdProxyInfo;
 
-    VerifyOrExit(otBackboneRouterGetNdProxyInfo(mHost.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
-                                                &aNdProxyInfo) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_OPENTHREAD);
+    SuccessOrExit(error = mDeps.GetNdProxyInfo(aTarget, aNdProxyInfo));
 
     memset(packet, 0, sizeof(packet));
 
@@ -397,6 +598,19 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    // Solicitations for targets out of the Domain Prefix are dropped by the
+    // kernel too, they are still checked when received otherwise.
+    if (NdProxyFilter(mDomainPrefix).Attach(mIcmp6RawSock) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("NdProxyManager: Failed to attach the socket filter for %s: %s",
+                       mDomainPrefix.ToString().c_str(), strerror(errno));
+    }
+
+    mCountersStartTime        = Clock::now();
+    mNumReceivedSolicitations = 0;
+    mNumAnsweredSolicitations = 0;
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -412,6 +626,10 @@ void NdProxyManager::FiniIcmp6RawSocket(void)
     {
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
+
+        // Closing the socket left all groups it joined.
+        mNdProxyTable.ResetGroups();
+        mPendingAdvertisements.clear();
     }
 }
 
@@ -461,6 +679,61 @@ void NdProxyManager::FiniNetfilterQueue(void)
     }
 }
 
+otbrError NdProxyManager::InitKernelProxy(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      forwarding;
+
+    // The kernel only answers for proxy neighbor entries when IPv6 forwarding is enabled. Unicast solicitations are
+    // checked against the proxy entries on the forwarding path, which requires `proxy_ndp` of "all" in addition to
+    // the one of the Backbone interface.
+    SuccessOrExit(error = ReadInterfaceSysctl("all", "forwarding", forwarding));
+    VerifyOrExit(forwarding != '0', error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = ReadInterfaceSysctl(mBackboneInterfaceName, "forwarding", forwarding));
+    VerifyOrExit(forwarding != '0', error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = ReadInterfaceSysctl("all", "proxy_ndp", mSavedAllProxyNdp));
+    SuccessOrExit(error = ReadInterfaceSysctl(mBackboneInterfaceName, "proxy_ndp", mSavedProxyNdp));
+
+    SuccessOrExit(error = mRouteNetlink.Open());
+    SuccessOrExit(error = WriteInterfaceSysctl("all", "proxy_ndp", '1'));
+    SuccessOrExit(error = WriteInterfaceSysctl(mBackboneInterfaceName, "proxy_ndp", '1'));
+
+    for (const Ip6Address &target : mNdProxyTable)
+    {
+        mRouteNetlink.AddNeighborProxy(target, mBackboneIfIndex);
+    }
+    SuccessOrExit(error = mRouteNetlink.Commit());
+
+exit:
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        FiniKernelProxy();
+    }
+
+    return error;
+}
+
+void NdProxyManager::FiniKernelProxy(void)
+{
+    VerifyOrExit(IsKernelProxyEnabled());
+
+    for (const Ip6Address &target : mNdProxyTable)
+    {
+        mRouteNetlink.DeleteNeighborProxy(target, mBackboneIfIndex);
+    }
+    mRouteNetlink.Commit();
+
+    WriteInterfaceSysctl(mBackboneInterfaceName, "proxy_ndp", mSavedProxyNdp);
+    WriteInterfaceSysctl("all", "proxy_ndp", mSavedAllProxyNdp);
+
+    mRouteNetlink.Close();
+
+exit:
+    return;
+}
+
 int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                          struct nfgenmsg     *aNfMsg,
                                          struct nfq_data     *aNfData,
@@ -508,7 +781,7 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(mNdProxyTable.Contains(dst), error = OTBR_ERROR_NOT_FOUND);
 
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
@@ -530,36 +803,21 @@ exit:
     return ret;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+otbrError NdProxyManager::UpdateSolicitedNodeMulticastGroup(const Ip6Address &aGroup, bool aIsJoin) const
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
-
-    mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
-
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
-                 error = OTBR_ERROR_ERRNO);
-exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
-}
-
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
-{
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
+    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, aIsJoin ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP, &mreq,
+                            sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: %s solicited-node multicast group %s", aIsJoin ? "Join" : "Leave",
+                  aGroup.ToString().c_str());
+    return error;
 }
 
 } // namespace BackboneRouter
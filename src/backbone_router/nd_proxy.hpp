@@ -46,16 +46,19 @@
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <sys/socket.h>
 #include <utility>
+#include <vector>
 
 #include <openthread/backbone_router_ftd.h>
 
+#include "backbone_router/nd_proxy_table.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
-#include "ncp/rcp_host.hpp"
+#include "utils/route_netlink.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -75,16 +78,40 @@ namespace BackboneRouter {
 class NdProxyManager : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This class defines what the ND Proxy manager needs from OpenThread.
+     */
+    class Dependencies
+    {
+    public:
+        virtual ~Dependencies(void) = default;
+
+        /**
+         * This method gets the ND Proxy info of a DUA.
+         *
+         * @param[in]  aDua          The DUA.
+         * @param[out] aNdProxyInfo  The ND Proxy info.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully got the ND Proxy info.
+         * @retval OTBR_ERROR_NOT_FOUND  The DUA is not in the ND Proxy table.
+         */
+        virtual otbrError GetNdProxyInfo(const Ip6Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo);
+    };
+
     /**
      * This constructor initializes a NdProxyManager instance.
      */
-    explicit NdProxyManager(otbr::Ncp::RcpHost &aHost, std::string aBackboneInterfaceName)
-        : mHost(aHost)
+    explicit NdProxyManager(Dependencies &aDependencies, std::string aBackboneInterfaceName)
+        : mDeps(aDependencies)
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
         , mIcmp6RawSock(-1)
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mSavedProxyNdp('0')
+        , mSavedAllProxyNdp('0')
+        , mNumReceivedSolicitations(0)
+        , mNumAnsweredSolicitations(0)
     {
     }
 
@@ -96,6 +123,9 @@ public:
     /**
      * This method enables the ND Proxy manager.
      *
+     * Unicast Neighbor Solicitations are answered by the kernel from proxy neighbor entries (`NTF_PROXY`) when the
+     * Backbone interface forwards IPv6 and supports `proxy_ndp`, and are steered to NFQUEUE otherwise.
+     *
      * @param[in] aDomainPrefix  The Domain Prefix.
      */
     void Enable(const Ip6Prefix &aDomainPrefix);
@@ -124,38 +154,61 @@ public:
      */
     bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
 
+    /**
+     * This method returns if Neighbor Solicitations are answered by kernel proxy neighbor entries.
+     *
+     * @returns If kernel ND proxying is in use.
+     */
+    bool IsKernelProxyEnabled(void) const { return mRouteNetlink.IsOpen(); }
+
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxICMP6PacketSize  = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxReceiveBatchSize = 8,    ///< Max number of ICMP6 packets received by one system call.
     };
 
+    static constexpr Milliseconds kGroupRetryInterval = Milliseconds(1000); ///< Delay to retry failed joins and leaves.
+
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
+    otbrError  InitKernelProxy(void);
+    void       FiniKernelProxy(void);
     void       ProcessMulticastNeighborSolicition(void);
+    bool       HandleMulticastNeighborSolicitation(msghdr &aMessage, size_t aLength);
+    void       UpdateSolicitationCounters(size_t aNumReceived, size_t aNumAnswered);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    otbrError  UpdateSolicitedNodeMulticastGroup(const Ip6Address &aGroup, bool aIsJoin) const;
+    bool       HasPendingChanges(void) const;
+    void       SyncPendingChanges(void);
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg     *aNfMsg,
                                     struct nfq_data     *aNfData,
                                     void                *aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
-    otbr::Ncp::RcpHost  &mHost;
-    std::string          mBackboneInterfaceName;
-    std::set<Ip6Address> mNdProxySet;
-    uint32_t             mBackboneIfIndex;
-    int                  mIcmp6RawSock;
-    int                  mUnicastNsQueueSock;
-    struct nfq_handle   *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *mNfqQueueHandler; ///< A pointer to a newly created queue.
-    MacAddress           mMacAddress;
-    Ip6Prefix            mDomainPrefix;
+    Dependencies           &mDeps;
+    std::string             mBackboneInterfaceName;
+    NdProxyTable            mNdProxyTable;
+    std::vector<Ip6Address> mPendingAdvertisements; ///< The DUAs to advertise once their changes are synced.
+    uint32_t                mBackboneIfIndex;
+    int                     mIcmp6RawSock;
+    int                     mUnicastNsQueueSock;
+    struct nfq_handle      *mNfqHandler;       ///< A pointer to an NFQUEUE handler.
+    struct nfq_q_handle    *mNfqQueueHandler;  ///< A pointer to a newly created queue.
+    char                    mSavedProxyNdp;    ///< The `proxy_ndp` setting of the Backbone interface before enabling.
+    char                    mSavedAllProxyNdp; ///< The `proxy_ndp` setting of all interfaces before enabling.
+    MacAddress              mMacAddress;
+    Ip6Prefix               mDomainPrefix;
+    Utils::RouteNetlink     mRouteNetlink;             ///< Programs the proxy neighbor entries of kernel ND proxy.
+    Timepoint               mGroupRetryTime;           ///< The earliest time to retry failed joins and leaves.
+    Timepoint               mCountersStartTime;        ///< The start of the period counted by the counters below.
+    uint32_t                mNumReceivedSolicitations; ///< The number of multicast NS received in the period.
+    uint32_t                mNumAnsweredSolicitations; ///< The number of multicast NS answered in the period.
 };
 
 /**
@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the socket filter of Neighbor Solicitations received by the ND Proxy manager.
+ */
+
+#ifndef BACKBONE_ROUTER_ND_PROXY_FILTER_HPP_
+#define BACKBONE_ROUTER_ND_PROXY_FILTER_HPP_
+
+#if __linux__
+
+#include <arpa/inet.h>
+#include <linux/filter.h>
+#include <netinet/icmp6.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * This class implements a classic BPF program which passes the Neighbor Solicitations whose target is in the Domain
+ * Prefix, and drops everything else before it is queued to the socket.
+ *
+ * The program is run on raw ICMPv6 sockets, where the packet starts at the ICMPv6 header.
+ */
+class NdProxyFilter
+{
+public:
+    /**
+     * This constructor builds the program for a Domain Prefix.
+     *
+     * @param[in] aDomainPrefix  The Domain Prefix.
+     */
+    explicit NdProxyFilter(const Ip6Prefix &aDomainPrefix)
+    {
+        uint8_t length = aDomainPrefix.mLength;
+
+        // The instructions which don't match jump to the final `ret #0`, the
+        // jump offsets are filled in once the program is complete.
+        mProgram.push_back(BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 0));
+        mProgram.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 0, 0));
+
+        for (uint8_t i = 0; i < sizeof(Ip6Address) / sizeof(uint32_t) && length > 0; i++)
+        {
+            uint32_t offset = kTargetOffset + i * static_cast<uint32_t>(sizeof(uint32_t));
+            uint32_t mask   = (length >= 32) ? UINT32_MAX : ~(UINT32_MAX >> length);
+
+            mProgram.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offset));
+
+            if (mask != UINT32_MAX)
+            {
+                mProgram.push_back(BPF_STMT(BPF_ALU | BPF_AND | BPF_K, mask));
+            }
+
+            mProgram.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ntohl(aDomainPrefix.mPrefix.m32[i]) & mask, 0, 0));
+            length -= (length >= 32) ? 32 : length;
+        }
+
+        mProgram.push_back(BPF_STMT(BPF_RET | BPF_K, UINT32_MAX));
+        mProgram.push_back(BPF_STMT(BPF_RET | BPF_K, 0));
+
+        for (size_t i = 0; i < mProgram.size(); i++)
+        {
+            if (BPF_CLASS(mProgram[i].code) == BPF_JMP)
+            {
+                mProgram[i].jf = static_cast<uint8_t>(mProgram.size() - 2 - i);
+            }
+        }
+    }
+
+    /**
+     * This method attaches the program to a socket, replacing the program attached before if any.
+     *
+     * @param[in] aSocket  The socket.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully attached the program.
+     * @retval OTBR_ERROR_ERRNO  Failed to attach the program, `errno` tells why.
+     */
+    otbrError Attach(int aSocket) const
+    {
+        sock_fprog program;
+
+        program.len    = static_cast<unsigned short>(mProgram.size());
+        program.filter = const_cast<sock_filter *>(mProgram.data());
+
+        return setsockopt(aSocket, SOL_SOCKET, SO_ATTACH_FILTER, &program, sizeof(program)) == 0 ? OTBR_ERROR_NONE
+                                                                                                  : OTBR_ERROR_ERRNO;
+    }
+
+    /**
+     * This method returns the instructions of the program.
+     *
+     * @returns The instructions of the program.
+     */
+    const std::vector<sock_filter> &GetProgram(void) const { return mProgram; }
+
+private:
+    static constexpr uint32_t kTargetOffset = static_cast<uint32_t>(offsetof(nd_neighbor_solicit, nd_ns_target));
+
+    std::vector<sock_filter> mProgram;
+};
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // __linux__
+
+#endif // BACKBONE_ROUTER_ND_PROXY_FILTER_HPP_
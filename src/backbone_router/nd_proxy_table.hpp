@@ -0,0 +1,327 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the table of Domain Unicast Addresses proxied by the ND Proxy manager.
+ */
+
+#ifndef BACKBONE_ROUTER_ND_PROXY_TABLE_HPP_
+#define BACKBONE_ROUTER_ND_PROXY_TABLE_HPP_
+
+#include <algorithm>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+#include "common/open_addressing_table.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * This class implements the table of Domain Unicast Addresses (DUAs) proxied by the ND Proxy manager.
+ *
+ * The DUAs are stored in an array indexed by an open-addressing hash table, and the solicited-node multicast groups
+ * of the DUAs are reference counted, since DUAs may share a group. Adding and removing DUAs only updates the table,
+ * the group memberships are brought in sync afterwards by `SyncGroups()`, so that a burst of changes results in at
+ * most one join or leave for each group.
+ */
+class NdProxyTable
+{
+public:
+    using Iterator = std::vector<Ip6Address>::const_iterator;
+
+    Iterator begin(void) const { return mDuas.begin(); }
+    Iterator end(void) const { return mDuas.end(); }
+
+    /**
+     * This method returns the number of DUAs in the table.
+     *
+     * @returns The number of DUAs.
+     */
+    size_t size(void) const { return mDuas.size(); }
+
+    /**
+     * This method indicates whether the table is empty.
+     *
+     * @returns Whether the table is empty.
+     */
+    bool empty(void) const { return mDuas.empty(); }
+
+    /**
+     * This method adds a DUA to the table.
+     *
+     * @param[in] aDua  The DUA to add.
+     *
+     * @returns Whether the DUA was added, `false` if it was already in the table.
+     */
+    bool Add(const Ip6Address &aDua)
+    {
+        bool isAdded = (FindSlot(aDua) == Index::kNotFound);
+
+        if (isAdded)
+        {
+            mIndex.Insert(Hash(aDua), static_cast<uint32_t>(mDuas.size() + 1));
+            mDuas.push_back(aDua);
+            AddGroupReference(GetGroupId(aDua));
+        }
+
+        return isAdded;
+    }
+
+    /**
+     * This method removes a DUA from the table.
+     *
+     * @param[in] aDua  The DUA to remove.
+     *
+     * @returns Whether the DUA was removed, `false` if it wasn't in the table.
+     */
+    bool Remove(const Ip6Address &aDua)
+    {
+        size_t slot      = FindSlot(aDua);
+        bool   isRemoved = (slot != Index::kNotFound);
+
+        if (isRemoved)
+        {
+            uint32_t index = mIndex.Remove(slot) - 1;
+
+            // Move the last DUA into the hole to keep the array dense.
+            if (index + 1 != mDuas.size())
+            {
+                mIndex.GetValue(FindSlot(mDuas.back())) = index + 1;
+                mDuas[index]                            = mDuas.back();
+            }
+            mDuas.pop_back();
+
+            RemoveGroupReference(GetGroupId(aDua));
+        }
+
+        return isRemoved;
+    }
+
+    /**
+     * This method removes all DUAs from the table.
+     */
+    void Clear(void)
+    {
+        for (const Ip6Address &dua : mDuas)
+        {
+            RemoveGroupReference(GetGroupId(dua));
+        }
+
+        mDuas.clear();
+        mIndex.Clear();
+    }
+
+    /**
+     * This method indicates whether a DUA is in the table.
+     *
+     * @param[in] aDua  The DUA.
+     *
+     * @returns Whether the DUA is in the table.
+     */
+    bool Contains(const Ip6Address &aDua) const { return FindSlot(aDua) != Index::kNotFound; }
+
+    /**
+     * This method indicates whether a multicast address is the solicited-node multicast address of a DUA in the table.
+     *
+     * @param[in] aAddress  The multicast address.
+     *
+     * @returns Whether @p aAddress is the solicited-node multicast address of a DUA in the table.
+     */
+    bool ContainsSolicitedNodeGroup(const Ip6Address &aAddress) const
+    {
+        auto group = mGroups.find(GetGroupId(aAddress));
+
+        return memcmp(aAddress.m8, Ip6Address::GetSolicitedMulticastAddressPrefix().m8, kGroupIdOffset) == 0 &&
+               group != mGroups.end() && group->second.mRefCount > 0;
+    }
+
+    /**
+     * This method returns the number of solicited-node multicast groups of the DUAs in the table.
+     *
+     * @returns The number of solicited-node multicast groups.
+     */
+    size_t GetGroupCount(void) const { return mGroupCount; }
+
+    /**
+     * This method indicates whether there are group membership changes which are not in sync yet.
+     *
+     * @returns Whether there are group membership changes to sync.
+     */
+    bool HasGroupChanges(void) const { return !mChangedGroups.empty(); }
+
+    /**
+     * This method brings the group memberships in sync with the DUAs in the table.
+     *
+     * @p aJoin is called with the solicited-node multicast address of each group which gained its first DUA and is
+     * not joined, and @p aLeave for each group which lost its last DUA and is joined. Both return whether they
+     * succeeded, the groups for which they failed are kept as changes so that they are retried by the next call.
+     *
+     * @param[in] aJoin   The function which joins a group.
+     * @param[in] aLeave  The function which leaves a group.
+     */
+    template <typename JoinFunc, typename LeaveFunc> void SyncGroups(JoinFunc &&aJoin, LeaveFunc &&aLeave)
+    {
+        std::vector<uint32_t> failedGroups;
+
+        for (uint32_t groupId : mChangedGroups)
+        {
+            auto group = mGroups.find(groupId);
+
+            // A group may be changed more than once, it's synced at most once.
+            if (group == mGroups.end() ||
+                std::find(failedGroups.begin(), failedGroups.end(), groupId) != failedGroups.end())
+            {
+                continue;
+            }
+
+            if (group->second.mRefCount > 0 && !group->second.mIsJoined)
+            {
+                group->second.mIsJoined = aJoin(GetGroupAddress(groupId));
+            }
+            else if (group->second.mRefCount == 0 && group->second.mIsJoined)
+            {
+                group->second.mIsJoined = !aLeave(GetGroupAddress(groupId));
+            }
+
+            if (group->second.mIsJoined != (group->second.mRefCount > 0))
+            {
+                failedGroups.push_back(groupId);
+            }
+            else if (group->second.mRefCount == 0)
+            {
+                mGroups.erase(group);
+            }
+        }
+
+        mChangedGroups.swap(failedGroups);
+    }
+
+    /**
+     * This method marks all groups as not joined, for example because the socket which joined them was closed.
+     *
+     * The groups of the DUAs in the table are joined again by the next `SyncGroups()`.
+     */
+    void ResetGroups(void)
+    {
+        for (auto group = mGroups.begin(); group != mGroups.end();)
+        {
+            group->second.mIsJoined = false;
+
+            if (group->second.mRefCount == 0)
+            {
+                group = mGroups.erase(group);
+            }
+            else
+            {
+                mChangedGroups.push_back(group->first);
+                ++group;
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kGroupIdOffset = 13; ///< The solicited-node group is given by the last 24 bits.
+
+    struct Group
+    {
+        uint32_t mRefCount = 0;
+        bool     mIsJoined = false;
+    };
+
+    using Index    = OpenAddressingTable<uint32_t>;
+    using GroupMap = std::unordered_map<uint32_t, Group>;
+
+    static uint32_t GetGroupId(const Ip6Address &aAddress)
+    {
+        return (static_cast<uint32_t>(aAddress.m8[13]) << 16) | (static_cast<uint32_t>(aAddress.m8[14]) << 8) |
+               aAddress.m8[15];
+    }
+
+    static Ip6Address GetGroupAddress(uint32_t aGroupId)
+    {
+        Ip6Address address(Ip6Address::GetSolicitedMulticastAddressPrefix());
+
+        address.m8[13] = static_cast<uint8_t>(aGroupId >> 16);
+        address.m8[14] = static_cast<uint8_t>(aGroupId >> 8);
+        address.m8[15] = static_cast<uint8_t>(aGroupId);
+
+        return address;
+    }
+
+    static uint32_t Hash(const Ip6Address &aAddress)
+    {
+        // DUAs of a Domain share the prefix, so mix the IID into the upper bits.
+        uint64_t hash = (aAddress.m64[1] ^ (aAddress.m64[0] >> 7)) * 0x9e3779b97f4a7c15ull;
+
+        return static_cast<uint32_t>(hash >> 32);
+    }
+
+    void AddGroupReference(uint32_t aGroupId)
+    {
+        if (mGroups[aGroupId].mRefCount++ == 0)
+        {
+            mGroupCount++;
+            mChangedGroups.push_back(aGroupId);
+        }
+    }
+
+    void RemoveGroupReference(uint32_t aGroupId)
+    {
+        Group &group = mGroups[aGroupId];
+
+        assert(group.mRefCount > 0);
+
+        if (--group.mRefCount == 0)
+        {
+            mGroupCount--;
+            mChangedGroups.push_back(aGroupId);
+        }
+    }
+
+    size_t FindSlot(const Ip6Address &aDua) const
+    {
+        return mIndex.Find(Hash(aDua), [this, &aDua](uint32_t aIndex) { return mDuas[aIndex - 1] == aDua; });
+    }
+
+    std::vector<Ip6Address> mDuas;           ///< The DUAs, in no particular order.
+    Index                   mIndex;          ///< The hash index, one plus the index of a DUA in each slot.
+    GroupMap                mGroups;         ///< The groups keyed by the last 24 bits of their addresses.
+    std::vector<uint32_t>   mChangedGroups;  ///< The groups whose reference counts dropped to or rose from zero.
+    size_t                  mGroupCount = 0; ///< The number of groups with at least one DUA.
+};
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_ND_PROXY_TABLE_HPP_
@@ -0,0 +1,927 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary log format.
+ */
+
+#define OTBR_LOG_TAG "LOG"
+
+#include "common/binary_log.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+constexpr char    kMagic[]           = "OTBRLOG";
+constexpr uint8_t kVersion           = 1;
+constexpr size_t  kFlushThreshold    = 4096;
+constexpr size_t  kMaxTextSize       = 1024;
+constexpr size_t  kMaxStringSize     = 65536;
+constexpr int     kNoValue           = -1;
+constexpr int     kValueFromArg      = -2;
+constexpr int     kMaxVarintShift    = 63;
+constexpr int     kNumDoubleBytes    = 8;
+constexpr int     kBitsPerByte       = 8;
+constexpr int     kVarintBitsPerByte = 7;
+
+enum RecordType : uint8_t
+{
+    kRecordHeader = 1,
+    kRecordTime   = 2,
+    kRecordFormat = 3,
+    kRecordLog    = 4,
+    kRecordText   = 5,
+};
+
+enum LengthModifier : uint8_t
+{
+    kLengthNone,
+    kLengthChar,       ///< `hh`
+    kLengthShort,      ///< `h`
+    kLengthLong,       ///< `l`
+    kLengthLongLong,   ///< `ll`
+    kLengthIntMax,     ///< `j`
+    kLengthSize,       ///< `z`
+    kLengthPtrDiff,    ///< `t`
+    kLengthLongDouble, ///< `L`
+};
+
+struct ConversionSpec
+{
+    std::string    mFlags;
+    int            mWidth;
+    int            mPrecision;
+    LengthModifier mLength;
+    char           mConversion;
+};
+
+uint64_t GetTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+int ParseNumber(const char *&aFormat)
+{
+    int number = 0;
+
+    while (*aFormat >= '0' && *aFormat <= '9')
+    {
+        number = number * 10 + (*aFormat++ - '0');
+    }
+
+    return number;
+}
+
+bool IsOneOf(char aChar, const char *aChars)
+{
+    return aChar != '\0' && strchr(aChars, aChar) != nullptr;
+}
+
+// Parses the conversion specification following a '%'. Returns the pointer to its conversion character, or `nullptr`
+// if the specification is not supported.
+const char *ParseSpec(const char *aFormat, ConversionSpec &aSpec)
+{
+    const char *p = aFormat;
+
+    aSpec.mFlags.clear();
+    aSpec.mWidth     = kNoValue;
+    aSpec.mPrecision = kNoValue;
+    aSpec.mLength    = kLengthNone;
+
+    while (IsOneOf(*p, "-+ #0"))
+    {
+        aSpec.mFlags.push_back(*p++);
+    }
+
+    if (*p == '*')
+    {
+        aSpec.mWidth = kValueFromArg;
+        p++;
+    }
+    else if (*p >= '0' && *p <= '9')
+    {
+        aSpec.mWidth = ParseNumber(p);
+    }
+
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            aSpec.mPrecision = kValueFromArg;
+            p++;
+        }
+        else
+        {
+            aSpec.mPrecision = ParseNumber(p);
+        }
+    }
+
+    switch (*p)
+    {
+    case 'h':
+        aSpec.mLength = (p[1] == 'h') ? kLengthChar : kLengthShort;
+        break;
+    case 'l':
+        aSpec.mLength = (p[1] == 'l') ? kLengthLongLong : kLengthLong;
+        break;
+    case 'j':
+        aSpec.mLength = kLengthIntMax;
+        break;
+    case 'z':
+        aSpec.mLength = kLengthSize;
+        break;
+    case 't':
+        aSpec.mLength = kLengthPtrDiff;
+        break;
+    case 'L':
+        aSpec.mLength = kLengthLongDouble;
+        break;
+    default:
+        break;
+    }
+
+    if (aSpec.mLength == kLengthChar || aSpec.mLength == kLengthLongLong)
+    {
+        p += 2;
+    }
+    else if (aSpec.mLength != kLengthNone)
+    {
+        p++;
+    }
+
+    aSpec.mConversion = *p;
+
+    if (IsOneOf(*p, "diouxX"))
+    {
+        VerifyOrExit(aSpec.mLength != kLengthLongDouble, p = nullptr);
+    }
+    else if (IsOneOf(*p, "fFeEgGaA"))
+    {
+        VerifyOrExit(aSpec.mLength == kLengthNone || aSpec.mLength == kLengthLong ||
+                         aSpec.mLength == kLengthLongDouble,
+                     p = nullptr);
+    }
+    else
+    {
+        // Wide characters, wide strings, `%n` and positional arguments are not supported.
+        VerifyOrExit(IsOneOf(*p, "cspm%") && aSpec.mLength == kLengthNone, p = nullptr);
+    }
+
+exit:
+    return p;
+}
+
+int64_t PopSigned(va_list &aArgs, LengthModifier aLength)
+{
+    int64_t value;
+
+    switch (aLength)
+    {
+    case kLengthChar:
+        value = static_cast<signed char>(va_arg(aArgs, int));
+        break;
+    case kLengthShort:
+        value = static_cast<short>(va_arg(aArgs, int));
+        break;
+    case kLengthLong:
+        value = va_arg(aArgs, long);
+        break;
+    case kLengthLongLong:
+        value = va_arg(aArgs, long long);
+        break;
+    case kLengthIntMax:
+        value = va_arg(aArgs, intmax_t);
+        break;
+    case kLengthSize:
+        value = va_arg(aArgs, ssize_t);
+        break;
+    case kLengthPtrDiff:
+        value = va_arg(aArgs, ptrdiff_t);
+        break;
+    default:
+        value = va_arg(aArgs, int);
+        break;
+    }
+
+    return value;
+}
+
+uint64_t PopUnsigned(va_list &aArgs, LengthModifier aLength)
+{
+    uint64_t value;
+
+    switch (aLength)
+    {
+    case kLengthChar:
+        value = static_cast<unsigned char>(va_arg(aArgs, unsigned int));
+        break;
+    case kLengthShort:
+        value = static_cast<unsigned short>(va_arg(aArgs, unsigned int));
+        break;
+    case kLengthLong:
+        value = va_arg(aArgs, unsigned long);
+        break;
+    case kLengthLongLong:
+        value = va_arg(aArgs, unsigned long long);
+        break;
+    case kLengthIntMax:
+        value = va_arg(aArgs, uintmax_t);
+        break;
+    case kLengthSize:
+        value = va_arg(aArgs, size_t);
+        break;
+    case kLengthPtrDiff:
+        value = static_cast<size_t>(va_arg(aArgs, ptrdiff_t));
+        break;
+    default:
+        value = va_arg(aArgs, unsigned int);
+        break;
+    }
+
+    return value;
+}
+
+void AppendVarint(std::string &aBuffer, uint64_t aValue)
+{
+    while (aValue >= 0x80)
+    {
+        aBuffer.push_back(static_cast<char>((aValue & 0x7f) | 0x80));
+        aValue >>= kVarintBitsPerByte;
+    }
+
+    aBuffer.push_back(static_cast<char>(aValue));
+}
+
+void AppendSigned(std::string &aBuffer, int64_t aValue)
+{
+    AppendVarint(aBuffer, (static_cast<uint64_t>(aValue) << 1) ^ static_cast<uint64_t>(aValue >> 63));
+}
+
+void AppendString(std::string &aBuffer, const char *aString, size_t aLength)
+{
+    AppendVarint(aBuffer, aLength);
+    aBuffer.append(aString, aLength);
+}
+
+void AppendDouble(std::string &aBuffer, double aValue)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &aValue, sizeof(bits));
+    for (int i = 0; i < kNumDoubleBytes; i++)
+    {
+        aBuffer.push_back(static_cast<char>(bits >> (i * kBitsPerByte)));
+    }
+}
+
+template <typename ValueType> void AppendFormatted(std::string &aText, const std::string &aConversion, ValueType aValue)
+{
+    int length = snprintf(nullptr, 0, aConversion.c_str(), aValue);
+
+    if (length > 0)
+    {
+        size_t offset = aText.size();
+
+        aText.resize(offset + static_cast<size_t>(length) + 1);
+        snprintf(&aText[offset], static_cast<size_t>(length) + 1, aConversion.c_str(), aValue);
+        aText.resize(offset + static_cast<size_t>(length));
+    }
+}
+
+} // namespace
+
+BinaryLogWriter::BinaryLogWriter(void)
+    : mFd(-1)
+    , mNextFormatId(0)
+    , mLastTime(0)
+{
+}
+
+BinaryLogWriter::~BinaryLogWriter(void)
+{
+    Close();
+}
+
+otbrError BinaryLogWriter::Open(const char *aPath)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    otbrError                   error = OTBR_ERROR_NONE;
+    int                         fd    = open(aPath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0640);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    if (mFd >= 0)
+    {
+        WriteBuffer();
+        close(mFd);
+    }
+
+    mFd = fd;
+    mFormats.clear();
+    mNextFormatId = 0;
+    mBuffer.reserve(kFlushThreshold + kMaxTextSize);
+
+    mBuffer.push_back(static_cast<char>(kRecordHeader));
+    mBuffer.append(kMagic, sizeof(kMagic) - 1);
+    mBuffer.push_back(static_cast<char>(kVersion));
+    AppendTime(GetTime());
+    WriteBuffer();
+
+exit:
+    return error;
+}
+
+void BinaryLogWriter::Close(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(mFd >= 0);
+
+    WriteBuffer();
+    close(mFd);
+    mFd = -1;
+
+exit:
+    return;
+}
+
+void BinaryLogWriter::Flush(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(mFd >= 0);
+    WriteBuffer();
+
+exit:
+    return;
+}
+
+void BinaryLogWriter::Write(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgs)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    int                         savedErrno = errno;
+    uint64_t                    now        = GetTime();
+    const Format               *format;
+
+    VerifyOrExit(mFd >= 0);
+
+    if (now < mLastTime)
+    {
+        AppendTime(now);
+    }
+
+    format = &GetFormat(aLogTag, aFormat);
+
+    if (format->mIsEncodable)
+    {
+        mBuffer.push_back(static_cast<char>(kRecordLog));
+        mBuffer.push_back(static_cast<char>(aLevel));
+        AppendVarint(mBuffer, now - mLastTime);
+        AppendVarint(mBuffer, format->mId);
+        EncodeArgs(*format, aArgs, savedErrno);
+    }
+    else
+    {
+        char text[kMaxTextSize];
+
+        errno = savedErrno;
+        vsnprintf(text, sizeof(text), aFormat, aArgs);
+
+        mBuffer.push_back(static_cast<char>(kRecordText));
+        mBuffer.push_back(static_cast<char>(aLevel));
+        AppendVarint(mBuffer, now - mLastTime);
+        AppendString(mBuffer, format->mLogTag.c_str(), format->mLogTag.size());
+        AppendString(mBuffer, text, strlen(text));
+    }
+
+    mLastTime = now;
+
+    if (mBuffer.size() >= kFlushThreshold || aLevel <= OTBR_LOG_WARNING)
+    {
+        WriteBuffer();
+    }
+
+exit:
+    errno = savedErrno;
+}
+
+const BinaryLogWriter::Format &BinaryLogWriter::GetFormat(const char *aLogTag, const char *aFormat)
+{
+    FormatKey   key{aLogTag, aFormat};
+    const char *logTag = (aLogTag != nullptr ? aLogTag : "");
+    auto        it     = mFormats.find(key);
+    bool        isNew  = (it == mFormats.end());
+
+    if (isNew)
+    {
+        it = mFormats.emplace(key, Format()).first;
+    }
+
+    Format &format = it->second;
+
+    if (isNew || format.mFormat != aFormat || format.mLogTag != logTag)
+    {
+        format.mId          = mNextFormatId++;
+        format.mLogTag      = logTag;
+        format.mFormat      = aFormat;
+        format.mIsEncodable = ParseArgs(aFormat, format.mArgs);
+
+        if (format.mIsEncodable)
+        {
+            mBuffer.push_back(static_cast<char>(kRecordFormat));
+            AppendVarint(mBuffer, format.mId);
+            AppendString(mBuffer, format.mLogTag.c_str(), format.mLogTag.size());
+            AppendString(mBuffer, format.mFormat.c_str(), format.mFormat.size());
+        }
+    }
+
+    return format;
+}
+
+bool BinaryLogWriter::ParseArgs(const char *aFormat, std::vector<Argument> &aArgs)
+{
+    bool           isEncodable = true;
+    ConversionSpec spec;
+
+    aArgs.clear();
+
+    for (const char *p = strchr(aFormat, '%'); p != nullptr; p = strchr(p + 1, '%'))
+    {
+        Argument arg;
+
+        p = ParseSpec(p + 1, spec);
+        VerifyOrExit(p != nullptr, isEncodable = false);
+
+        if (spec.mConversion == '%')
+        {
+            continue;
+        }
+
+        if (spec.mWidth == kValueFromArg)
+        {
+            aArgs.push_back({'*', kLengthNone, kNoValue});
+        }
+        if (spec.mPrecision == kValueFromArg)
+        {
+            aArgs.push_back({'*', kLengthNone, kNoValue});
+        }
+
+        arg.mLength    = spec.mLength;
+        arg.mPrecision = spec.mPrecision;
+
+        switch (spec.mConversion)
+        {
+        case 'd':
+        case 'i':
+            arg.mConversion = 'd';
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            arg.mConversion = 'u';
+            break;
+        case 'c':
+        case 'p':
+        case 's':
+        case 'm':
+            arg.mConversion = spec.mConversion;
+            break;
+        default:
+            arg.mConversion = 'f';
+            break;
+        }
+
+        aArgs.push_back(arg);
+    }
+
+exit:
+    return isEncodable;
+}
+
+void BinaryLogWriter::EncodeArgs(const Format &aFormat, va_list aArgs, int aErrno)
+{
+    int     lastStarArg = kNoValue;
+    va_list args;
+
+    va_copy(args, aArgs);
+
+    for (const Argument &arg : aFormat.mArgs)
+    {
+        LengthModifier length = static_cast<LengthModifier>(arg.mLength);
+
+        switch (arg.mConversion)
+        {
+        case '*':
+            lastStarArg = va_arg(args, int);
+            AppendSigned(mBuffer, lastStarArg);
+            break;
+
+        case 'd':
+            AppendSigned(mBuffer, PopSigned(args, length));
+            break;
+
+        case 'u':
+            AppendVarint(mBuffer, PopUnsigned(args, length));
+            break;
+
+        case 'c':
+            AppendVarint(mBuffer, static_cast<unsigned char>(va_arg(args, int)));
+            break;
+
+        case 'p':
+            AppendVarint(mBuffer, reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+            break;
+
+        case 's':
+        case 'm':
+        {
+            const char *string    = (arg.mConversion == 's') ? va_arg(args, const char *) : strerror(aErrno);
+            int         precision = (arg.mPrecision == kValueFromArg) ? lastStarArg : arg.mPrecision;
+            size_t      stringLength;
+
+            if (string == nullptr)
+            {
+                string = "(null)";
+            }
+
+            stringLength = (precision >= 0) ? strnlen(string, static_cast<size_t>(precision)) : strlen(string);
+            AppendString(mBuffer, string, stringLength);
+            break;
+        }
+
+        default:
+            AppendDouble(mBuffer, length == kLengthLongDouble ? static_cast<double>(va_arg(args, long double))
+                                                              : va_arg(args, double));
+            break;
+        }
+    }
+
+    va_end(args);
+}
+
+void BinaryLogWriter::AppendTime(uint64_t aTime)
+{
+    mBuffer.push_back(static_cast<char>(kRecordTime));
+    AppendVarint(mBuffer, aTime);
+    mLastTime = aTime;
+}
+
+void BinaryLogWriter::WriteBuffer(void)
+{
+    size_t written = 0;
+
+    while (written < mBuffer.size())
+    {
+        ssize_t rval = write(mFd, mBuffer.data() + written, mBuffer.size() - written);
+
+        if (rval < 0)
+        {
+            VerifyOrExit(errno == EINTR);
+            continue;
+        }
+
+        written += static_cast<size_t>(rval);
+    }
+
+exit:
+    mBuffer.clear();
+}
+
+BinaryLogReader::BinaryLogReader(FILE *aFile)
+    : mFile(aFile)
+    , mTime(0)
+{
+}
+
+otbrError BinaryLogReader::Read(Log &aLog)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    for (;;)
+    {
+        int      type = getc(mFile);
+        uint64_t id;
+
+        VerifyOrExit(type != EOF, error = OTBR_ERROR_NOT_FOUND);
+
+        switch (type)
+        {
+        case kRecordHeader:
+        {
+            char    magic[sizeof(kMagic) - 1];
+            uint8_t version;
+
+            VerifyOrExit(fread(magic, 1, sizeof(magic), mFile) == sizeof(magic), error = OTBR_ERROR_PARSE);
+            VerifyOrExit(memcmp(magic, kMagic, sizeof(magic)) == 0, error = OTBR_ERROR_PARSE);
+            SuccessOrExit(error = ReadByte(version));
+            VerifyOrExit(version == kVersion, error = OTBR_ERROR_PARSE);
+            mFormats.clear();
+            break;
+        }
+
+        case kRecordTime:
+            SuccessOrExit(error = ReadVarint(mTime));
+            break;
+
+        case kRecordFormat:
+        {
+            Format format;
+
+            SuccessOrExit(error = ReadVarint(id));
+            SuccessOrExit(error = ReadString(format.mLogTag));
+            SuccessOrExit(error = ReadString(format.mFormat));
+            mFormats[id] = std::move(format);
+            break;
+        }
+
+        case kRecordLog:
+        {
+            std::unordered_map<uint64_t, Format>::const_iterator format;
+
+            SuccessOrExit(error = ReadLevelAndTime(aLog));
+            SuccessOrExit(error = ReadVarint(id));
+            format = mFormats.find(id);
+            VerifyOrExit(format != mFormats.end(), error = OTBR_ERROR_PARSE);
+            aLog.mLogTag = format->second.mLogTag;
+            ExitNow(error = DecodeArgs(format->second.mFormat, aLog.mText));
+        }
+
+        case kRecordText:
+            SuccessOrExit(error = ReadLevelAndTime(aLog));
+            SuccessOrExit(error = ReadString(aLog.mLogTag));
+            ExitNow(error = ReadString(aLog.mText));
+
+        default:
+            ExitNow(error = OTBR_ERROR_PARSE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadByte(uint8_t &aByte)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       byte  = getc(mFile);
+
+    VerifyOrExit(byte != EOF, error = OTBR_ERROR_PARSE);
+    aByte = static_cast<uint8_t>(byte);
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadVarint(uint64_t &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   byte;
+
+    aValue = 0;
+
+    for (int shift = 0;; shift += kVarintBitsPerByte)
+    {
+        VerifyOrExit(shift <= kMaxVarintShift, error = OTBR_ERROR_PARSE);
+        SuccessOrExit(error = ReadByte(byte));
+        aValue |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        VerifyOrExit(byte & 0x80);
+    }
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadSigned(int64_t &aValue)
+{
+    otbrError error;
+    uint64_t  value;
+
+    SuccessOrExit(error = ReadVarint(value));
+    aValue = static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadDouble(double &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint64_t  bits  = 0;
+    uint8_t   byte;
+
+    for (int i = 0; i < kNumDoubleBytes; i++)
+    {
+        SuccessOrExit(error = ReadByte(byte));
+        bits |= static_cast<uint64_t>(byte) << (i * kBitsPerByte);
+    }
+
+    memcpy(&aValue, &bits, sizeof(aValue));
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadString(std::string &aString)
+{
+    otbrError error;
+    uint64_t  length;
+
+    SuccessOrExit(error = ReadVarint(length));
+    VerifyOrExit(length <= kMaxStringSize, error = OTBR_ERROR_PARSE);
+
+    aString.resize(length);
+    VerifyOrExit(length == 0 || fread(&aString[0], 1, length, mFile) == length, error = OTBR_ERROR_PARSE);
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::ReadLevelAndTime(Log &aLog)
+{
+    otbrError error;
+    uint8_t   level;
+    uint64_t  delta;
+
+    SuccessOrExit(error = ReadByte(level));
+    VerifyOrExit(level <= OTBR_LOG_DEBUG, error = OTBR_ERROR_PARSE);
+    SuccessOrExit(error = ReadVarint(delta));
+
+    mTime += delta;
+    aLog.mLevel = static_cast<otbrLogLevel>(level);
+    aLog.mTime  = mTime;
+
+exit:
+    return error;
+}
+
+otbrError BinaryLogReader::DecodeArgs(const std::string &aFormat, std::string &aText)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    ConversionSpec spec;
+
+    aText.clear();
+
+    for (const char *p = aFormat.c_str(); *p != '\0'; p++)
+    {
+        std::string conversion;
+        int64_t     width;
+        int64_t     precision;
+
+        if (*p != '%')
+        {
+            aText.push_back(*p);
+            continue;
+        }
+
+        p = ParseSpec(p + 1, spec);
+        VerifyOrExit(p != nullptr, error = OTBR_ERROR_PARSE);
+
+        if (spec.mConversion == '%')
+        {
+            aText.push_back('%');
+            continue;
+        }
+
+        // The arguments of the width and the precision are written in the conversion specification.
+        conversion = "%" + spec.mFlags;
+
+        width = spec.mWidth;
+        if (spec.mWidth == kValueFromArg)
+        {
+            SuccessOrExit(error = ReadSigned(width));
+            if (width < 0)
+            {
+                conversion.push_back('-');
+                width = -width;
+            }
+        }
+        if (width >= 0)
+        {
+            conversion += std::to_string(width);
+        }
+
+        precision = spec.mPrecision;
+        if (spec.mPrecision == kValueFromArg)
+        {
+            SuccessOrExit(error = ReadSigned(precision));
+        }
+        if (precision >= 0)
+        {
+            conversion += "." + std::to_string(precision);
+        }
+
+        switch (spec.mConversion)
+        {
+        case 'd':
+        case 'i':
+        {
+            int64_t value;
+
+            SuccessOrExit(error = ReadSigned(value));
+            conversion += "ll";
+            conversion.push_back(spec.mConversion);
+            AppendFormatted(aText, conversion, static_cast<long long>(value));
+            break;
+        }
+
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            uint64_t value;
+
+            SuccessOrExit(error = ReadVarint(value));
+            conversion += "ll";
+            conversion.push_back(spec.mConversion);
+            AppendFormatted(aText, conversion, static_cast<unsigned long long>(value));
+            break;
+        }
+
+        case 'c':
+        case 'p':
+        {
+            uint64_t value;
+
+            SuccessOrExit(error = ReadVarint(value));
+            conversion.push_back(spec.mConversion);
+            if (spec.mConversion == 'c')
+            {
+                AppendFormatted(aText, conversion, static_cast<int>(value));
+            }
+            else
+            {
+                AppendFormatted(aText, conversion, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            }
+            break;
+        }
+
+        case 's':
+        case 'm':
+        {
+            std::string string;
+
+            SuccessOrExit(error = ReadString(string));
+            conversion.push_back('s');
+            AppendFormatted(aText, conversion, string.c_str());
+            break;
+        }
+
+        default:
+        {
+            double value;
+
+            SuccessOrExit(error = ReadDouble(value));
+            conversion.push_back(spec.mConversion);
+            AppendFormatted(aText, conversion, value);
+            break;
+        }
+        }
+    }
+
+exit:
+    return error;
+}
+
+} // namespace otbr
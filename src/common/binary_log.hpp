@@ -0,0 +1,231 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the binary log format.
+ */
+
+#ifndef OTBR_COMMON_BINARY_LOG_HPP_
+#define OTBR_COMMON_BINARY_LOG_HPP_
+
+#include "openthread-br/config.h"
+
+#ifndef OTBR_LOG_TAG
+#define OTBR_LOG_TAG "LOG"
+#endif
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common/logging.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the writer of the binary log format.
+ *
+ * A binary log is a sequence of records, each starting with its type:
+ *
+ * - Header: the magic `OTBRLOG` and the format version. It starts each session writing to the file and resets the
+ *   format dictionary.
+ * - Time: the absolute time in microseconds since the epoch, which the time of the following records is relative to.
+ * - Format: the identifier, the log tag and the format string of a logging call, written when it's first used.
+ * - Log: the level, the time since the previous record, the format identifier and the arguments.
+ * - Text: the level, the time since the previous record, the log tag and the formatted text, for the format strings
+ *   which can't be encoded, e.g. with positional arguments.
+ *
+ * Integers are LEB128 varints, zigzag encoded when signed. Strings are prefixed with their length. Floating point
+ * numbers are 8-byte little-endian IEEE 754 doubles.
+ *
+ * Records are buffered and written when the buffer is full or a log of level warning or more severe is written.
+ */
+class BinaryLogWriter
+{
+public:
+    /**
+     * This constructor initializes the writer.
+     */
+    BinaryLogWriter(void);
+
+    /**
+     * This destructor flushes and closes the writer.
+     */
+    ~BinaryLogWriter(void);
+
+    /**
+     * This method opens the file the logs are appended to and starts a session.
+     *
+     * @param[in] aPath  The path of the file.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the file.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the file.
+     */
+    otbrError Open(const char *aPath);
+
+    /**
+     * This method flushes and closes the file.
+     */
+    void Close(void);
+
+    /**
+     * This method writes a log.
+     *
+     * @param[in] aLevel   The log level.
+     * @param[in] aLogTag  The log tag, `nullptr` if the log has no tag.
+     * @param[in] aFormat  The format string as in printf.
+     * @param[in] aArgs    The arguments for the format specification.
+     */
+    void Write(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgs);
+
+    /**
+     * This method writes the buffered records to the file.
+     */
+    void Flush(void);
+
+private:
+    struct FormatKey
+    {
+        bool operator==(const FormatKey &aOther) const
+        {
+            return mLogTag == aOther.mLogTag && mFormat == aOther.mFormat;
+        }
+
+        const char *mLogTag;
+        const char *mFormat;
+    };
+
+    struct FormatKeyHash
+    {
+        size_t operator()(const FormatKey &aKey) const
+        {
+            return std::hash<const char *>()(aKey.mLogTag) * 31 + std::hash<const char *>()(aKey.mFormat);
+        }
+    };
+
+    // An argument of a format string. The conversion is one of `d`, `u`, `c`, `p`, `s`, `m` and `f`, or `*` for the
+    // width and the precision passed as arguments.
+    struct Argument
+    {
+        char    mConversion;
+        uint8_t mLength;
+        int     mPrecision;
+    };
+
+    // The strings are copied as a logging call may pass a buffer which is later reused. The arguments are parsed once
+    // so that encoding a log doesn't parse the format string.
+    struct Format
+    {
+        uint32_t              mId;
+        std::string           mLogTag;
+        std::string           mFormat;
+        std::vector<Argument> mArgs;
+        bool                  mIsEncodable;
+    };
+
+    static bool ParseArgs(const char *aFormat, std::vector<Argument> &aArgs);
+
+    const Format &GetFormat(const char *aLogTag, const char *aFormat);
+    void          EncodeArgs(const Format &aFormat, va_list aArgs, int aErrno);
+    void          AppendTime(uint64_t aTime);
+    void          WriteBuffer(void);
+
+    std::mutex                                           mMutex;
+    int                                                  mFd;
+    std::string                                          mBuffer;
+    std::unordered_map<FormatKey, Format, FormatKeyHash> mFormats;
+    uint32_t                                             mNextFormatId;
+    uint64_t                                             mLastTime;
+};
+
+/**
+ * This class implements the reader of the binary log format.
+ */
+class BinaryLogReader
+{
+public:
+    /**
+     * This structure represents a decoded log.
+     */
+    struct Log
+    {
+        otbrLogLevel mLevel;  ///< The log level.
+        uint64_t     mTime;   ///< The time in microseconds since the epoch.
+        std::string  mLogTag; ///< The log tag, empty if the log has no tag.
+        std::string  mText;   ///< The formatted text.
+    };
+
+    /**
+     * This constructor initializes the reader.
+     *
+     * @param[in] aFile  The file to read the logs from.
+     */
+    explicit BinaryLogReader(FILE *aFile);
+
+    /**
+     * This method reads the next log.
+     *
+     * @param[out] aLog  The decoded log.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read a log.
+     * @retval OTBR_ERROR_NOT_FOUND  There are no more logs.
+     * @retval OTBR_ERROR_PARSE      The file is not a valid binary log.
+     */
+    otbrError Read(Log &aLog);
+
+private:
+    struct Format
+    {
+        std::string mLogTag;
+        std::string mFormat;
+    };
+
+    otbrError ReadByte(uint8_t &aByte);
+    otbrError ReadVarint(uint64_t &aValue);
+    otbrError ReadSigned(int64_t &aValue);
+    otbrError ReadDouble(double &aValue);
+    otbrError ReadString(std::string &aString);
+    otbrError ReadLevelAndTime(Log &aLog);
+    otbrError DecodeArgs(const std::string &aFormat, std::string &aText);
+
+    FILE                                *mFile;
+    std::unordered_map<uint64_t, Format> mFormats;
+    uint64_t                             mTime;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_BINARY_LOG_HPP_
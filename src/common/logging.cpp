@@ -36,6 +36,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <signal.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -43,9 +44,16 @@
 #include <string.h>
 #include <sys/time.h>
 #include <syslog.h>
+#include <unistd.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
+#include "common/binary_log.hpp"
 #include "common/code_utils.hpp"
 #include "common/time.hpp"
 
@@ -55,8 +63,170 @@ static const char   sLevelString[][8] = {
 };
 static bool sSyslogDisabled = false;
 
+static constexpr uint8_t kMaxTagSize       = 7;
+static constexpr uint8_t kPrefixBufferSize = kMaxTagSize + 3;
+
 static otbrLogLevel sDefaultLevel = OTBR_LOG_INFO;
 
+namespace {
+
+/**
+ * This class implements a bounded lock-free ring buffer of formatted logs, which supports multiple producers and
+ * multiple consumers.
+ *
+ * Each record has a sequence number telling whether it's free for the producer or ready for the consumer of the
+ * current lap around the ring, so producers and consumers only contend on their positions. A record is formatted and
+ * written in place, and is only released once done.
+ */
+class LogRing
+{
+public:
+    static constexpr size_t kNumRecords = 256;
+    static constexpr size_t kRecordSize = 1024;
+
+    LogRing(void)
+        : mEnqueuePosition(0)
+        , mDequeuePosition(0)
+    {
+        for (size_t i = 0; i < kNumRecords; i++)
+        {
+            mRecords[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * This method adds a log to the ring.
+     *
+     * @param[in] aLevel      The log level.
+     * @param[in] aFormatter  The function which formats the log as `void(char *aText, size_t aSize)`.
+     *
+     * @returns Whether the log was added, false if the ring is full.
+     */
+    template <typename Formatter> bool Push(otbrLogLevel aLevel, Formatter aFormatter)
+    {
+        Record *record   = nullptr;
+        size_t  position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            intptr_t diff;
+
+            record = &mRecords[position % kNumRecords];
+            diff   = static_cast<intptr_t>(record->mSequence.load(std::memory_order_acquire) - position);
+
+            if (diff == 0)
+            {
+                if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                ExitNow(record = nullptr);
+            }
+            else
+            {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        record->mLevel = aLevel;
+        aFormatter(record->mText, sizeof(record->mText));
+        record->mSequence.store(position + 1, std::memory_order_release);
+
+    exit:
+        return record != nullptr;
+    }
+
+    /**
+     * This method removes the oldest log from the ring.
+     *
+     * @param[in] aWriter  The function which writes the log as `void(otbrLogLevel aLevel, const char *aText)`.
+     *
+     * @returns Whether a log was removed, false if the ring is empty.
+     */
+    template <typename Writer> bool Pop(Writer aWriter)
+    {
+        Record *record   = nullptr;
+        size_t  position = mDequeuePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            intptr_t diff;
+
+            record = &mRecords[position % kNumRecords];
+            diff   = static_cast<intptr_t>(record->mSequence.load(std::memory_order_acquire) - (position + 1));
+
+            if (diff == 0)
+            {
+                if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                ExitNow(record = nullptr);
+            }
+            else
+            {
+                position = mDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        aWriter(record->mLevel, record->mText);
+        record->mSequence.store(position + kNumRecords, std::memory_order_release);
+
+    exit:
+        return record != nullptr;
+    }
+
+    /**
+     * This method indicates whether the ring is empty.
+     *
+     * @returns Whether the ring is empty.
+     */
+    bool IsEmpty(void) const
+    {
+        size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+
+        return mRecords[position % kNumRecords].mSequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+private:
+    struct Record
+    {
+        std::atomic<size_t> mSequence;
+        otbrLogLevel        mLevel;
+        char                mText[kRecordSize];
+    };
+
+    Record              mRecords[kNumRecords];
+    std::atomic<size_t> mEnqueuePosition;
+    std::atomic<size_t> mDequeuePosition;
+};
+
+constexpr otbr::Milliseconds kLogWriterWakeUpInterval = otbr::Milliseconds(100);
+
+constexpr int kCrashSignals[] = {SIGABRT, SIGBUS, SIGFPE, SIGILL, SIGSEGV};
+
+// Allocated by the first `otbrLogAsyncStart()`, so processes which only log synchronously don't carry the ring. It's
+// kept afterwards as other threads may still be pushing to it when the asynchronous mode stops.
+std::unique_ptr<LogRing> sLogRing;
+struct sigaction         sPreviousCrashActions[sizeof(kCrashSignals) / sizeof(kCrashSignals[0])];
+std::atomic<bool>        sAsyncEnabled(false);
+std::atomic<bool>       sBinaryEnabled(false);
+otbr::BinaryLogWriter   sBinaryLogWriter;
+std::atomic<bool>       sLogWriterWaiting(false);
+std::atomic<uint32_t>   sDroppedCount(0);
+bool                    sLogWriterStopping = false;
+std::thread             sLogWriter;
+std::mutex              sLogWriterMutex;
+std::condition_variable sLogWriterCondition;
+
+} // namespace
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
@@ -105,29 +275,230 @@ void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStder
     sDefaultLevel = sLevel;
 }
 
-static const char *GetPrefix(const char *aLogTag)
+static const char *GetPrefix(const char *aLogTag, char (&aPrefix)[kPrefixBufferSize])
 {
     // Log prefix format : -xxx-----
-    const uint8_t kMaxTagSize = 7;
-    const uint8_t kBufferSize = kMaxTagSize + 3;
-    static char   prefix[kBufferSize];
-    uint8_t       tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
-    int           index     = 0;
+    uint8_t tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
+    int     index     = 0;
 
     if (strlen(aLogTag) > 0)
     {
-        prefix[0] = '-';
-        memcpy(&prefix[1], aLogTag, tagLength);
+        aPrefix[0] = '-';
+        memcpy(&aPrefix[1], aLogTag, tagLength);
 
         index = tagLength + 1;
 
-        memset(&prefix[index], '-', kMaxTagSize - tagLength + 1);
+        memset(&aPrefix[index], '-', kMaxTagSize - tagLength + 1);
         index += kMaxTagSize - tagLength + 1;
     }
 
-    prefix[index++] = '\0';
+    aPrefix[index++] = '\0';
+
+    return aPrefix;
+}
+
+static void WriteLog(otbrLogLevel aLevel, const char *aText)
+{
+    if (sSyslogDisabled)
+    {
+        printf("%s\n", aText);
+    }
+    else
+    {
+        syslog(static_cast<int>(aLevel), "%s", aText);
+    }
+}
+
+static void WriteLogOnCrash(otbrLogLevel aLevel, const char *aText)
+{
+    ssize_t rval;
+
+    OTBR_UNUSED_VARIABLE(aLevel);
+
+    // Only async-signal-safe functions can be used here.
+    rval = write(STDERR_FILENO, aText, strlen(aText));
+    rval = write(STDERR_FILENO, "\n", 1);
+    OTBR_UNUSED_VARIABLE(rval);
+}
+
+static void HandleCrash(int aSignal)
+{
+    // Only installed once the ring is allocated.
+    while (sLogRing->Pop(WriteLogOnCrash))
+    {
+    }
+
+    // The default action was restored when the signal was delivered.
+    raise(aSignal);
+}
+
+static void WakeUpLogWriter(void)
+{
+    // Pairs with the fence of the log writer, so either the log writer sees the new log or it's woken up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (sLogWriterWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(sLogWriterMutex);
 
-    return prefix;
+        sLogWriterCondition.notify_one();
+    }
+}
+
+static void RunLogWriter(void)
+{
+    uint32_t reportedDroppedCount = 0;
+    bool     isStopping           = false;
+
+    while (!isStopping)
+    {
+        uint32_t droppedCount;
+
+        while (sLogRing->Pop(WriteLog))
+        {
+        }
+
+        droppedCount = sDroppedCount.load(std::memory_order_relaxed);
+        if (droppedCount != reportedDroppedCount)
+        {
+            char prefix[kPrefixBufferSize];
+            char text[LogRing::kRecordSize];
+
+            snprintf(text, sizeof(text), "%s%s: %u logs were dropped as the log buffer was full",
+                     sLevelString[OTBR_LOG_WARNING], GetPrefix(OTBR_LOG_TAG, prefix),
+                     droppedCount - reportedDroppedCount);
+            WriteLog(OTBR_LOG_WARNING, text);
+            reportedDroppedCount = droppedCount;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(sLogWriterMutex);
+
+            sLogWriterWaiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (sLogRing->IsEmpty() && !sLogWriterStopping)
+            {
+                sLogWriterCondition.wait_for(lock, kLogWriterWakeUpInterval);
+            }
+
+            sLogWriterWaiting.store(false, std::memory_order_relaxed);
+            isStopping = sLogWriterStopping;
+        }
+    }
+}
+
+static void AsyncLogStop(void)
+{
+    VerifyOrExit(sAsyncEnabled);
+
+    sAsyncEnabled = false;
+
+    for (size_t i = 0; i < sizeof(kCrashSignals) / sizeof(kCrashSignals[0]); i++)
+    {
+        sigaction(kCrashSignals[i], &sPreviousCrashActions[i], nullptr);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sLogWriterMutex);
+
+        sLogWriterStopping = true;
+        sLogWriterCondition.notify_one();
+    }
+
+    sLogWriter.join();
+    otbrLogFlush();
+
+exit:
+    return;
+}
+
+// The writer thread must be joined before the static `std::thread` is destroyed, otherwise exiting terminates.
+static void HandleExit(void)
+{
+    AsyncLogStop();
+    otbrLogFlush();
+}
+
+static void RegisterFlushAtExit(void)
+{
+    static bool sIsAtExitRegistered = false;
+
+    if (!sIsAtExitRegistered)
+    {
+        atexit(HandleExit);
+        sIsAtExitRegistered = true;
+    }
+}
+
+void otbrLogAsyncStart(void)
+{
+    struct sigaction action;
+
+    VerifyOrExit(!sAsyncEnabled);
+
+    if (sLogRing == nullptr)
+    {
+        sLogRing.reset(new LogRing());
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = HandleCrash;
+    action.sa_flags   = static_cast<int>(SA_RESETHAND);
+    sigemptyset(&action.sa_mask);
+
+    for (size_t i = 0; i < sizeof(kCrashSignals) / sizeof(kCrashSignals[0]); i++)
+    {
+        sigaction(kCrashSignals[i], &action, &sPreviousCrashActions[i]);
+    }
+
+    RegisterFlushAtExit();
+
+    sLogWriterStopping = false;
+    sLogWriter         = std::thread(RunLogWriter);
+    sAsyncEnabled      = true;
+
+exit:
+    return;
+}
+
+otbrError otbrLogBinaryStart(const char *aPath)
+{
+    otbrError error;
+
+    SuccessOrExit(error = sBinaryLogWriter.Open(aPath));
+    RegisterFlushAtExit();
+    sBinaryEnabled = true;
+
+exit:
+    return error;
+}
+
+void otbrLogFlush(void)
+{
+    while (sLogRing != nullptr && sLogRing->Pop(WriteLog))
+    {
+    }
+
+    fflush(stdout);
+    sBinaryLogWriter.Flush();
+}
+
+uint32_t otbrLogGetDroppedCount(void)
+{
+    return sDroppedCount.load(std::memory_order_relaxed);
+}
+
+template <typename Formatter> static void AsyncLog(otbrLogLevel aLevel, Formatter aFormatter)
+{
+    if (sLogRing->Push(aLevel, aFormatter))
+    {
+        WakeUpLogWriter();
+    }
+    else
+    {
+        sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 /** log to the syslog or standard out */
@@ -136,24 +507,38 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
     const uint16_t kBufferSize = 1024;
     va_list        ap;
     char           buffer[kBufferSize];
+    char           prefix[kPrefixBufferSize];
 
     va_start(ap, aFormat);
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
+    VerifyOrExit(aLevel <= sLevel);
+
+    if (sBinaryEnabled.load(std::memory_order_relaxed))
+    {
+        sBinaryLogWriter.Write(aLevel, aLogTag, aFormat, ap);
+    }
+    else if (sAsyncEnabled.load(std::memory_order_relaxed))
+    {
+        AsyncLog(aLevel, [&](char *aText, size_t aSize) {
+            int length = snprintf(aText, aSize, "%s%s: ", sLevelString[aLevel], GetPrefix(aLogTag, prefix));
+
+            vsnprintf(aText + length, aSize - static_cast<size_t>(length), aFormat, ap);
+        });
+    }
+    else if (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0)
     {
         if (sSyslogDisabled)
         {
-            printf("%s%s: %s\n", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+            printf("%s%s: %s\n", sLevelString[aLevel], GetPrefix(aLogTag, prefix), buffer);
         }
         else
         {
-            syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+            syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag, prefix), buffer);
         }
     }
 
+exit:
     va_end(ap);
-
-    return;
 }
 
 /** log to the syslog or standard out */
@@ -170,7 +555,15 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 /** log to the syslog or standard out */
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
-    if (sSyslogDisabled)
+    if (sBinaryEnabled.load(std::memory_order_relaxed))
+    {
+        sBinaryLogWriter.Write(aLevel, nullptr, aFormat, aArgList);
+    }
+    else if (sAsyncEnabled.load(std::memory_order_relaxed))
+    {
+        AsyncLog(aLevel, [&](char *aText, size_t aSize) { vsnprintf(aText, aSize, aFormat, aArgList); });
+    }
+    else if (sSyslogDisabled)
     {
         vprintf(aFormat, aArgList);
         printf("\n");
@@ -295,5 +688,8 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+    AsyncLogStop();
+    sBinaryEnabled = false;
+    sBinaryLogWriter.Close();
     closelog();
 }
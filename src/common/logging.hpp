@@ -37,6 +37,7 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifndef OTBR_LOG_TAG
 #error "OTBR_LOG_TAG is not defined"
@@ -59,6 +60,15 @@ typedef enum
     OTBR_LOG_DEBUG,   ///< Debug level messages
 } otbrLogLevel;
 
+/**
+ * @def OTBR_COMPILE_LOG_LEVEL
+ *
+ * The most verbose log level compiled in. The logging macros of more verbose levels are removed at compile time.
+ */
+#ifndef OTBR_COMPILE_LOG_LEVEL
+#define OTBR_COMPILE_LOG_LEVEL OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level.
  */
@@ -91,6 +101,47 @@ void otbrLogSyslogSetEnabled(bool aEnabled);
  */
 void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStderr, bool aSyslogDisable);
 
+/**
+ * This function switches the logging service to the asynchronous mode.
+ *
+ * In the asynchronous mode, logs are formatted by the calling thread into a lock-free ring buffer and written to
+ * syslog or standard out by a background thread, so a slow log sink doesn't block the caller. Logs are dropped and
+ * counted when the ring buffer is full, which is allocated by the first call. The pending logs are flushed to standard
+ * error when the process crashes.
+ *
+ * It must be called after `otbrLogInit()`, the asynchronous mode is stopped by `otbrLogDeinit()`, which also restores
+ * the previous handlers of the crash signals.
+ */
+void otbrLogAsyncStart(void);
+
+/**
+ * This function switches the logging service to the binary mode.
+ *
+ * In the binary mode, logs are written to @p aPath in the compact binary format of `otbr::BinaryLogWriter` instead of
+ * syslog or standard out. The format strings are written once and each log only carries the arguments, so logs are
+ * neither formatted nor written in full. Use the `log-decoder` tool to read the logs.
+ *
+ * It must be called after `otbrLogInit()`, the binary mode is stopped by `otbrLogDeinit()`.
+ *
+ * @param[in] aPath  The path of the file the logs are appended to.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully switched to the binary mode.
+ * @retval OTBR_ERROR_ERRNO  Failed to open the file.
+ */
+otbrError otbrLogBinaryStart(const char *aPath);
+
+/**
+ * This function writes the pending logs of the asynchronous and the binary modes on the calling thread.
+ */
+void otbrLogFlush(void);
+
+/**
+ * This function returns the number of logs dropped because the ring buffer of the asynchronous mode was full.
+ *
+ * @returns The number of dropped logs.
+ */
+uint32_t otbrLogGetDroppedCount(void);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -161,6 +212,29 @@ void otbrLogDeinit(void);
                 ##__VA_ARGS__, otbrErrorString(_err));                                                    \
     } while (0)
 
+/**
+ * @def otbrLogIsEnabled
+ *
+ * This macro indicates whether logs of level @p aLevel are written.
+ *
+ * It's a compile-time constant false for the levels which are not compiled in. Use it to skip work which only builds
+ * arguments of the logs.
+ *
+ * @param[in] aLevel  The log level.
+ */
+#define otbrLogIsEnabled(aLevel) ((aLevel) <= OTBR_COMPILE_LOG_LEVEL && (aLevel) <= otbrLogGetLevel())
+
+/**
+ * @def otbrLogAtLevel
+ *
+ * Log at level @p aLevel. The arguments are only evaluated when logs of the level are written.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Arguments for the format specification.
+ */
+#define otbrLogAtLevel(aLevel, ...) \
+    (otbrLogIsEnabled(aLevel) ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__) : static_cast<void>(0))
+
 /**
  * @def otbrLogEmerg
  *
@@ -224,13 +298,13 @@ void otbrLogDeinit(void);
  *
  * @param[in] ...  Arguments for the format specification.
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogAtLevel(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogAtLevel(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogAtLevel(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogAtLevel(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogAtLevel(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogAtLevel(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogAtLevel(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogAtLevel(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
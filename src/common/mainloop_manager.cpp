@@ -25,36 +25,208 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MAINLOOP"
+
 #include <assert.h>
+#include <cxxabi.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <limits>
+#include <typeinfo>
 
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+constexpr Milliseconds MainloopManager::kDefaultStallBudget;
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     assert(aMainloopProcessor != nullptr);
-    mMainloopProcessorList.emplace_back(aMainloopProcessor);
+    mMainloopProcessorList.push_back({aMainloopProcessor, nullptr});
 }
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
-    mMainloopProcessorList.remove(aMainloopProcessor);
+    mMainloopProcessorList.remove_if([aMainloopProcessor](const Entry &aEntry) {
+        return aEntry.mProcessor == aMainloopProcessor;
+    });
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    if (mProfilingEnabled)
+    {
+        UpdateProfiled(aMainloop);
+    }
+    else
     {
-        mainloopProcessor->Update(aMainloop);
+        for (auto &entry : mMainloopProcessorList)
+        {
+            entry.mProcessor->Update(aMainloop);
+        }
     }
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    if (mProfilingEnabled)
+    {
+        ProcessProfiled(aMainloop);
+    }
+    else
+    {
+        for (auto &entry : mMainloopProcessorList)
+        {
+            entry.mProcessor->Process(aMainloop);
+        }
+    }
+}
+
+void MainloopManager::EnableProfiling(Milliseconds aStallBudget)
+{
+    for (auto &entry : mMainloopProcessorList)
+    {
+        entry.mStats = nullptr;
+    }
+
+    mStats.clear();
+    mIterationLatency.Clear();
+    mStallCount        = 0;
+    mStallBudget       = aStallBudget;
+    mIterationDuration = Microseconds(0);
+    mSlowestDuration   = Microseconds(0);
+    mSlowestStats      = nullptr;
+    mSlowestPhase      = nullptr;
+    mProfilingEnabled  = true;
+
+    otbrLogInfo("Mainloop profiling enabled, stall budget %lld ms", static_cast<long long>(aStallBudget.count()));
+}
+
+void MainloopManager::DisableProfiling(void)
+{
+    mProfilingEnabled = false;
+    mSlowestStats     = nullptr;
+}
+
+std::vector<MainloopManager::ProcessorStats> MainloopManager::GetProcessorStats(void) const
+{
+    std::vector<ProcessorStats> stats;
+
+    for (const auto &nameAndStats : mStats)
+    {
+        stats.push_back(nameAndStats.second);
+    }
+
+    return stats;
+}
+
+void MainloopManager::UpdateProfiled(MainloopContext &aMainloop)
+{
+    // The previous iteration ends right before the processors are updated for the next `select()`.
+    FinishIteration();
+
+    for (auto &entry : mMainloopProcessorList)
+    {
+        ProcessorStats &stats = GetStats(entry);
+        Timepoint       start = Clock::now();
+
+        entry.mProcessor->Update(aMainloop);
+        Record(stats, stats.mUpdateLatency, "::Update()", start);
+    }
+}
+
+void MainloopManager::ProcessProfiled(const MainloopContext &aMainloop)
+{
+    for (auto &entry : mMainloopProcessorList)
     {
-        mainloopProcessor->Process(aMainloop);
+        ProcessorStats &stats = GetStats(entry);
+        Timepoint       start = Clock::now();
+
+        entry.mProcessor->Process(aMainloop);
+        Record(stats, stats.mProcessLatency, "::Process()", start);
+    }
+}
+
+void MainloopManager::RecordSection(const char *aName, Timepoint aStart)
+{
+    ProcessorStats &stats = GetStats(aName);
+
+    Record(stats, stats.mProcessLatency, "", aStart);
+}
+
+void MainloopManager::Record(ProcessorStats &aStats, LatencyHistogram &aHistogram, const char *aPhase, Timepoint aStart)
+{
+    Microseconds duration = std::chrono::duration_cast<Microseconds>(Clock::now() - aStart);
+
+    aHistogram.Record(static_cast<uint32_t>(
+        std::min<Microseconds::rep>(duration.count(), std::numeric_limits<uint32_t>::max())));
+    mIterationDuration += duration;
+
+    if (mSlowestStats == nullptr || duration > mSlowestDuration)
+    {
+        mSlowestDuration = duration;
+        mSlowestStats    = &aStats;
+        mSlowestPhase    = aPhase;
+    }
+}
+
+void MainloopManager::FinishIteration(void)
+{
+    VerifyOrExit(mSlowestStats != nullptr);
+
+    mIterationLatency.Record(static_cast<uint32_t>(
+        std::min<Microseconds::rep>(mIterationDuration.count(), std::numeric_limits<uint32_t>::max())));
+
+    if (mStallBudget > Milliseconds(0) && mIterationDuration > mStallBudget)
+    {
+        mStallCount++;
+        mSlowestStats->mStallCount++;
+        otbrLogWarning("Mainloop iteration took %lld ms, exceeding the budget of %lld ms: %s%s took %lld ms",
+                       static_cast<long long>(std::chrono::duration_cast<Milliseconds>(mIterationDuration).count()),
+                       static_cast<long long>(mStallBudget.count()), mSlowestStats->mName.c_str(), mSlowestPhase,
+                       static_cast<long long>(std::chrono::duration_cast<Milliseconds>(mSlowestDuration).count()));
+    }
+
+    mIterationDuration = Microseconds(0);
+    mSlowestDuration   = Microseconds(0);
+    mSlowestStats      = nullptr;
+    mSlowestPhase      = nullptr;
+
+exit:
+    return;
+}
+
+MainloopManager::ProcessorStats &MainloopManager::GetStats(Entry &aEntry)
+{
+    if (aEntry.mStats == nullptr)
+    {
+        const char *mangledName = typeid(*aEntry.mProcessor).name();
+        int         status;
+        char       *name = abi::__cxa_demangle(mangledName, nullptr, nullptr, &status);
+
+        aEntry.mStats = &GetStats(name != nullptr ? name : mangledName);
+        free(name);
     }
+
+    return *aEntry.mStats;
+}
+
+MainloopManager::ProcessorStats &MainloopManager::GetStats(const std::string &aName)
+{
+    auto it = mStats.find(aName);
+
+    if (it == mStats.end())
+    {
+        ProcessorStats stats;
+
+        stats.mName       = aName;
+        stats.mStallCount = 0;
+        it                = mStats.emplace(aName, stats).first;
+    }
+
+    return it->second;
 }
 } // namespace otbr
@@ -39,19 +39,43 @@
 #include <openthread/openthread-system.h>
 
 #include <list>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "ncp/rcp_host.hpp"
 
 namespace otbr {
 
 /**
  * This class implements the mainloop manager.
+ *
+ * When profiling is enabled, the mainloop manager records the durations of `Update()` and `Process()` of each mainloop
+ * processor, and of the named sections which the mainloop runs outside of the processors. Processors are named after
+ * their class, so that instances of the same class share the statistics. An iteration is the time spent outside of
+ * `select()`, it's reported as stalled when it exceeds the stall budget, naming the processor or section which took
+ * the longest.
  */
 class MainloopManager : private NonCopyable
 {
 public:
+    static constexpr Milliseconds kDefaultStallBudget = Milliseconds(100);
+
+    /**
+     * This structure represents the latency statistics of a mainloop processor or section.
+     */
+    struct ProcessorStats
+    {
+        std::string      mName;           ///< The name of the processor or section.
+        uint32_t         mStallCount;     ///< The number of stalled iterations in which it took the longest.
+        LatencyHistogram mUpdateLatency;  ///< The durations of `Update()` in microseconds, empty for sections.
+        LatencyHistogram mProcessLatency; ///< The durations of `Process()`, or of the section, in microseconds.
+    };
+
     /**
      * The constructor to initialize the mainloop manager.
      */
@@ -94,8 +118,100 @@ public:
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method enables profiling and clears the statistics recorded before.
+     *
+     * @param[in] aStallBudget  The longest time an iteration may take before it's reported, zero to never report.
+     */
+    void EnableProfiling(Milliseconds aStallBudget);
+
+    /**
+     * This method disables profiling, the statistics recorded are kept.
+     */
+    void DisableProfiling(void);
+
+    /**
+     * This method indicates whether profiling is enabled.
+     *
+     * @retval TRUE   Profiling is enabled.
+     * @retval FALSE  Profiling is disabled.
+     */
+    bool IsProfilingEnabled(void) const { return mProfilingEnabled; }
+
+    /**
+     * This method returns the stall budget of an iteration.
+     *
+     * @returns The stall budget, zero if stalls are never reported.
+     */
+    Milliseconds GetStallBudget(void) const { return mStallBudget; }
+
+    /**
+     * This method returns the number of stalled iterations.
+     *
+     * @returns The number of iterations which exceeded the stall budget.
+     */
+    uint32_t GetStallCount(void) const { return mStallCount; }
+
+    /**
+     * This method returns the latency histogram of the iterations.
+     *
+     * @returns The durations of the iterations in microseconds.
+     */
+    const LatencyHistogram &GetIterationLatency(void) const { return mIterationLatency; }
+
+    /**
+     * This method returns the latency statistics of all processors and sections.
+     *
+     * @returns The statistics sorted by name.
+     */
+    std::vector<ProcessorStats> GetProcessorStats(void) const;
+
+    /**
+     * This method starts timing a section of the mainloop.
+     *
+     * @returns The start time of the section, which is only meaningful when profiling is enabled.
+     */
+    Timepoint StartSection(void) const { return mProfilingEnabled ? Clock::now() : Timepoint(); }
+
+    /**
+     * This method records the duration of a section of the mainloop.
+     *
+     * @param[in] aName   The name of the section.
+     * @param[in] aStart  The start time returned by `StartSection()`.
+     */
+    void EndSection(const char *aName, Timepoint aStart)
+    {
+        if (mProfilingEnabled && aStart != Timepoint())
+        {
+            RecordSection(aName, aStart);
+        }
+    }
+
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+    struct Entry
+    {
+        MainloopProcessor *mProcessor;
+        ProcessorStats    *mStats; // Resolved on first use, the processor is still being constructed when added.
+    };
+
+    void            UpdateProfiled(MainloopContext &aMainloop);
+    void            ProcessProfiled(const MainloopContext &aMainloop);
+    void            RecordSection(const char *aName, Timepoint aStart);
+    void            Record(ProcessorStats &aStats, LatencyHistogram &aHistogram, const char *aPhase, Timepoint aStart);
+    void            FinishIteration(void);
+    ProcessorStats &GetStats(Entry &aEntry);
+    ProcessorStats &GetStats(const std::string &aName);
+
+    std::list<Entry>                      mMainloopProcessorList;
+    std::map<std::string, ProcessorStats> mStats;
+    LatencyHistogram                      mIterationLatency;
+    bool                                  mProfilingEnabled  = false;
+    Milliseconds                          mStallBudget       = kDefaultStallBudget;
+    uint32_t                              mStallCount        = 0;
+    Microseconds                          mIterationDuration = Microseconds(0);
+    Microseconds                          mSlowestDuration   = Microseconds(0);
+    ProcessorStats                       *mSlowestStats      = nullptr;
+    const char                           *mSlowestPhase      = nullptr;
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,241 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines an open-addressing hash table with backward-shift deletion.
+ */
+
+#ifndef OTBR_COMMON_OPEN_ADDRESSING_TABLE_HPP_
+#define OTBR_COMMON_OPEN_ADDRESSING_TABLE_HPP_
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace otbr {
+
+/**
+ * This class implements an open-addressing hash table of values, the keys are left to the users of the table.
+ *
+ * A value is looked up by its hash and a function which matches the value against the key, so the keys may be stored
+ * in the values themselves or anywhere else. A value which converts to `false`, e.g. zero or `nullptr`, marks an empty
+ * slot and must not be inserted. Collisions are resolved with linear probing and removal shifts the following values
+ * back, so the table never accumulates deleted slots.
+ */
+template <typename ValueType> class OpenAddressingTable
+{
+public:
+    static constexpr size_t kNotFound = SIZE_MAX;
+
+    /**
+     * This method returns the number of values in the table.
+     *
+     * @returns The number of values.
+     */
+    size_t size(void) const { return mSize; }
+
+    /**
+     * This method returns the number of slots of the table.
+     *
+     * @returns The number of slots, the slots are indexed from zero to the number minus one.
+     */
+    size_t GetCapacity(void) const { return mSlots.size(); }
+
+    /**
+     * This method indicates whether a slot holds a value.
+     *
+     * @param[in] aSlot  The index of the slot.
+     *
+     * @returns Whether the slot holds a value.
+     */
+    bool IsOccupied(size_t aSlot) const { return static_cast<bool>(mSlots[aSlot].mValue); }
+
+    /**
+     * This method returns the value in a slot.
+     *
+     * @param[in] aSlot  The index of the slot.
+     *
+     * @returns The value in the slot.
+     */
+    ValueType       &GetValue(size_t aSlot) { return mSlots[aSlot].mValue; }
+    const ValueType &GetValue(size_t aSlot) const { return mSlots[aSlot].mValue; }
+
+    /**
+     * This method finds the slot of a value.
+     *
+     * @param[in] aHash   The hash of the key of the value.
+     * @param[in] aMatch  The function which returns whether a value has the key.
+     *
+     * @returns The index of the slot, `kNotFound` if no value has the key.
+     */
+    template <typename MatchFunc> size_t Find(uint32_t aHash, MatchFunc &&aMatch) const
+    {
+        size_t result = kNotFound;
+
+        if (!mSlots.empty())
+        {
+            for (size_t slot = aHash & GetMask(); IsOccupied(slot); slot = (slot + 1) & GetMask())
+            {
+                if (mSlots[slot].mHash == aHash && aMatch(mSlots[slot].mValue))
+                {
+                    result = slot;
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * This method inserts a value, the table grows to keep its load under one half.
+     *
+     * The table must not already hold a value with the same key.
+     *
+     * @param[in] aHash   The hash of the key of the value.
+     * @param[in] aValue  The value.
+     */
+    void Insert(uint32_t aHash, ValueType &&aValue)
+    {
+        assert(static_cast<bool>(aValue));
+
+        if ((mSize + 1) * 2 > mSlots.size())
+        {
+            Resize(mSlots.empty() ? kMinCapacity : mSlots.size() * 2);
+        }
+
+        Place(Slot{aHash, std::move(aValue)});
+        mSize++;
+    }
+
+    /**
+     * This method removes the value in a slot.
+     *
+     * The values in the following slots may be moved, so the indexes of slots found before are invalidated.
+     *
+     * @param[in] aSlot  The index of the slot.
+     *
+     * @returns The removed value.
+     */
+    ValueType Remove(size_t aSlot)
+    {
+        ValueType value = std::move(mSlots[aSlot].mValue);
+
+        ShiftBack(aSlot);
+        mSize--;
+
+        return value;
+    }
+
+    /**
+     * This method removes all values.
+     *
+     * The table is emptied before the values are destroyed, so it's safe to access the table from the destructors of
+     * the values.
+     */
+    void Clear(void)
+    {
+        std::vector<Slot> slots;
+
+        slots.swap(mSlots);
+        mSize = 0;
+    }
+
+private:
+    static constexpr size_t kMinCapacity = 16;
+
+    struct Slot
+    {
+        uint32_t  mHash;
+        ValueType mValue;
+    };
+
+    size_t GetMask(void) const { return mSlots.size() - 1; }
+
+    void Place(Slot &&aSlot)
+    {
+        size_t slot = aSlot.mHash & GetMask();
+
+        while (IsOccupied(slot))
+        {
+            slot = (slot + 1) & GetMask();
+        }
+
+        mSlots[slot] = std::move(aSlot);
+    }
+
+    void Resize(size_t aCapacity)
+    {
+        std::vector<Slot> slots(aCapacity);
+
+        assert((aCapacity & (aCapacity - 1)) == 0);
+
+        slots.swap(mSlots);
+        for (Slot &slot : slots)
+        {
+            if (slot.mValue)
+            {
+                Place(std::move(slot));
+            }
+        }
+    }
+
+    // Backward-shift deletion: moves the following values of the
+    // probing sequence into the emptied slot when that brings them
+    // closer to their home slots.
+    void ShiftBack(size_t aSlot)
+    {
+        size_t empty = aSlot;
+
+        for (size_t slot = (aSlot + 1) & GetMask(); IsOccupied(slot); slot = (slot + 1) & GetMask())
+        {
+            size_t home = mSlots[slot].mHash & GetMask();
+
+            if (((slot - home) & GetMask()) >= ((slot - empty) & GetMask()))
+            {
+                mSlots[empty] = std::move(mSlots[slot]);
+                empty         = slot;
+            }
+        }
+
+        mSlots[empty].mValue = ValueType();
+    }
+
+    std::vector<Slot> mSlots;
+    size_t            mSize = 0;
+};
+
+template <typename ValueType> constexpr size_t OpenAddressingTable<ValueType>::kNotFound;
+template <typename ValueType> constexpr size_t OpenAddressingTable<ValueType>::kMinCapacity;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_OPEN_ADDRESSING_TABLE_HPP_
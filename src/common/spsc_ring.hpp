@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a lock-free ring buffer for one producer thread and one consumer thread.
+ */
+
+#ifndef OTBR_COMMON_SPSC_RING_HPP_
+#define OTBR_COMMON_SPSC_RING_HPP_
+
+#include <atomic>
+#include <stddef.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a lock-free ring buffer of `kCapacity` slots for exactly one producer thread and one
+ * consumer thread.
+ *
+ * The slots are written and read in place: the producer fills the slot returned by `GetWriteSlot()` and publishes it
+ * with `CommitWrite()`, the consumer handles the slot returned by `GetReadSlot()` and releases it with
+ * `CommitRead()`.
+ */
+template <typename Type, size_t kCapacity> class SpscRing : private NonCopyable
+{
+    static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of two");
+
+public:
+    SpscRing(void)
+        : mReadIndex(0)
+        , mWriteIndex(0)
+    {
+    }
+
+    /**
+     * This method returns the slot to write next, it must only be called by the producer.
+     *
+     * @returns A pointer to the slot, `nullptr` if the ring is full.
+     */
+    Type *GetWriteSlot(void)
+    {
+        size_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+
+        return (writeIndex - mReadIndex.load(std::memory_order_acquire) < kCapacity) ? &mSlots[writeIndex % kCapacity]
+                                                                                      : nullptr;
+    }
+
+    /**
+     * This method publishes the slot returned by `GetWriteSlot()` to the consumer.
+     */
+    void CommitWrite(void)
+    {
+        mWriteIndex.store(mWriteIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * This method returns the slot to read next, it must only be called by the consumer.
+     *
+     * @returns A pointer to the slot, `nullptr` if the ring is empty.
+     */
+    Type *GetReadSlot(void)
+    {
+        size_t readIndex = mReadIndex.load(std::memory_order_relaxed);
+
+        return (readIndex != mWriteIndex.load(std::memory_order_acquire)) ? &mSlots[readIndex % kCapacity] : nullptr;
+    }
+
+    /**
+     * This method releases the slot returned by `GetReadSlot()` to the producer.
+     */
+    void CommitRead(void)
+    {
+        mReadIndex.store(mReadIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * This method indicates whether the ring is empty.
+     *
+     * @returns Whether the ring is empty.
+     */
+    bool IsEmpty(void) const
+    {
+        return mReadIndex.load(std::memory_order_acquire) == mWriteIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    Type mSlots[kCapacity];
+
+    // The indexes only grow, the slot of an index is `index % kCapacity`.
+    std::atomic<size_t> mReadIndex;  ///< Written by the consumer only.
+    std::atomic<size_t> mWriteIndex; ///< Written by the producer only.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_SPSC_RING_HPP_
@@ -26,7 +26,9 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <arpa/inet.h>
+#include <assert.h>
 #include <sstream>
 #include <sys/socket.h>
 
@@ -169,6 +171,106 @@ std::string MacAddress::ToString(void) const
     return std::string(strbuf);
 }
 
+void LatencyHistogram::Clear(void)
+{
+    memset(mBuckets, 0, sizeof(mBuckets));
+    mCount = 0;
+    mMax   = 0;
+}
+
+void LatencyHistogram::Record(uint32_t aValue)
+{
+    mBuckets[GetBucketIndex(aValue)]++;
+    mCount++;
+    mMax = std::max(mMax, aValue);
+}
+
+void LatencyHistogram::SetBucketCount(uint8_t aIndex, uint32_t aCount)
+{
+    assert(aIndex < kNumBuckets);
+
+    mCount           = mCount - mBuckets[aIndex] + aCount;
+    mBuckets[aIndex] = aCount;
+}
+
+uint32_t LatencyHistogram::GetPercentile(uint8_t aPercentile) const
+{
+    uint32_t value = 0;
+    uint64_t rank;
+    uint64_t cumulative = 0;
+
+    VerifyOrExit(mCount > 0);
+
+    rank = (static_cast<uint64_t>(mCount) * std::min<uint8_t>(aPercentile, 100) + 99) / 100;
+    rank = std::max<uint64_t>(rank, 1);
+
+    for (uint8_t i = 0; i < kNumBuckets; i++)
+    {
+        cumulative += mBuckets[i];
+
+        if (cumulative >= rank)
+        {
+            value = GetBucketUpperBound(i);
+            break;
+        }
+    }
+
+    value = std::min(value, mMax);
+
+exit:
+    return value;
+}
+
+uint8_t LatencyHistogram::GetBucketIndex(uint32_t aValue)
+{
+    uint8_t index;
+    uint8_t exponent;
+
+    VerifyOrExit(aValue >= kNumSubBuckets, index = static_cast<uint8_t>(aValue));
+    VerifyOrExit(aValue <= kMaxValue, index = kNumBuckets - 1);
+
+    exponent = 0;
+    while ((aValue >> (exponent + 1)) != 0)
+    {
+        exponent++;
+    }
+
+    index = static_cast<uint8_t>(kNumSubBuckets + (exponent - kSubBucketBits) * kNumSubBuckets +
+                                 ((aValue >> (exponent - kSubBucketBits)) & (kNumSubBuckets - 1)));
+
+exit:
+    return index;
+}
+
+uint32_t LatencyHistogram::GetBucketLowerBound(uint8_t aIndex)
+{
+    uint32_t bound;
+    uint8_t  shift;
+
+    assert(aIndex < kNumBuckets);
+
+    VerifyOrExit(aIndex >= kNumSubBuckets, bound = aIndex);
+
+    shift = (aIndex - kNumSubBuckets) / kNumSubBuckets;
+    bound = static_cast<uint32_t>(kNumSubBuckets + (aIndex - kNumSubBuckets) % kNumSubBuckets) << shift;
+
+exit:
+    return bound;
+}
+
+uint32_t LatencyHistogram::GetBucketUpperBound(uint8_t aIndex)
+{
+    uint32_t bound;
+
+    assert(aIndex < kNumBuckets);
+
+    VerifyOrExit(aIndex + 1 < kNumBuckets, bound = UINT32_MAX);
+    bound = GetBucketLowerBound(aIndex + 1) - 1;
+
+exit:
+    return bound;
+}
+
 otError OtbrErrorToOtError(otbrError aError)
 {
     otError error;
@@ -457,6 +457,124 @@ public:
     };
 };
 
+/**
+ * This class implements a fixed-size log-linear histogram of latency samples.
+ *
+ * Samples below `kNumSubBuckets` have a bucket each, larger samples are grouped into power-of-two ranges which are
+ * split into `kNumSubBuckets` linear sub-buckets, so the relative error of a bucket never exceeds 25%. Samples which
+ * are larger than `kMaxValue` are counted in the last bucket. The histogram is unit-agnostic, recording a sample never
+ * allocates memory.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr uint8_t  kSubBucketBits = 2;
+    static constexpr uint8_t  kNumSubBuckets = (1 << kSubBucketBits);
+    static constexpr uint8_t  kMaxExponent   = 24;
+    static constexpr uint8_t  kNumBuckets    = kNumSubBuckets + (kMaxExponent - kSubBucketBits) * kNumSubBuckets;
+    static constexpr uint32_t kMaxValue      = (1u << kMaxExponent) - 1;
+
+    /**
+     * This constructor initializes an empty histogram.
+     */
+    LatencyHistogram(void) { Clear(); }
+
+    /**
+     * This method removes all samples from the histogram.
+     */
+    void Clear(void);
+
+    /**
+     * This method records a sample.
+     *
+     * @param[in] aValue  The sample value.
+     */
+    void Record(uint32_t aValue);
+
+    /**
+     * This method returns the total number of samples.
+     *
+     * @returns The total number of samples.
+     */
+    uint32_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the largest sample recorded.
+     *
+     * @returns The largest sample, 0 if the histogram is empty.
+     */
+    uint32_t GetMax(void) const { return mMax; }
+
+    /**
+     * This method returns the number of samples in a bucket.
+     *
+     * @param[in] aIndex  The bucket index, must be less than `kNumBuckets`.
+     *
+     * @returns The number of samples in the bucket.
+     */
+    uint32_t GetBucketCount(uint8_t aIndex) const { return mBuckets[aIndex]; }
+
+    /**
+     * This method sets the number of samples in a bucket.
+     *
+     * This method is used to rebuild a histogram which was exported with `GetBucketCount()`.
+     *
+     * @param[in] aIndex  The bucket index, must be less than `kNumBuckets`.
+     * @param[in] aCount  The number of samples in the bucket.
+     */
+    void SetBucketCount(uint8_t aIndex, uint32_t aCount);
+
+    /**
+     * This method sets the largest sample recorded.
+     *
+     * @param[in] aMax  The largest sample.
+     */
+    void SetMax(uint32_t aMax) { mMax = aMax; }
+
+    /**
+     * This method returns an estimation of the given percentile.
+     *
+     * The estimation is the upper bound of the bucket containing the percentile, capped by the largest sample.
+     *
+     * @param[in] aPercentile  The percentile, in range [0, 100].
+     *
+     * @returns The estimated percentile, 0 if the histogram is empty.
+     */
+    uint32_t GetPercentile(uint8_t aPercentile) const;
+
+    /**
+     * This method returns the index of the bucket for a sample.
+     *
+     * @param[in] aValue  The sample value.
+     *
+     * @returns The bucket index.
+     */
+    static uint8_t GetBucketIndex(uint32_t aValue);
+
+    /**
+     * This method returns the smallest sample value of a bucket.
+     *
+     * @param[in] aIndex  The bucket index, must be less than `kNumBuckets`.
+     *
+     * @returns The smallest sample value of the bucket.
+     */
+    static uint32_t GetBucketLowerBound(uint8_t aIndex);
+
+    /**
+     * This method returns the largest sample value of a bucket.
+     *
+     * @param[in] aIndex  The bucket index, must be less than `kNumBuckets`.
+     *
+     * @returns The largest sample value of the bucket, UINT32_MAX for the last bucket.
+     */
+    static uint32_t GetBucketUpperBound(uint8_t aIndex);
+
+private:
+    uint32_t mBuckets[kNumBuckets];
+    uint32_t mCount;
+    uint32_t mMax;
+};
+
 struct MdnsResponseCounters
 {
     uint32_t mSuccess;        ///< The number of successful responses
@@ -469,6 +587,16 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+struct MdnsLatencyHistograms
+{
+    LatencyHistogram mHostRegistration;    ///< The latency histogram of host registrations in milliseconds
+    LatencyHistogram mKeyRegistration;     ///< The latency histogram of key registrations in milliseconds
+    LatencyHistogram mServiceRegistration; ///< The latency histogram of service registrations in milliseconds
+    LatencyHistogram mHostResolution;      ///< The latency histogram of host resolutions in milliseconds
+    LatencyHistogram mServiceResolution;   ///< The latency histogram of service resolutions in milliseconds
+    LatencyHistogram mServiceBrowse;       ///< The latency histogram of first browse results in milliseconds
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -489,6 +617,8 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    MdnsLatencyHistograms mLatencyHistograms; ///< The latency histograms of mDNS operations
 };
 
 static constexpr size_t kVendorOuiLength      = 3;
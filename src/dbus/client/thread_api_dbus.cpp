@@ -26,6 +26,7 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <map>
 #include <string.h>
 
@@ -96,6 +97,22 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aIn
     SubscribeDeviceRoleSignal();
 }
 
+ThreadApiDBus::~ThreadApiDBus(void)
+{
+    // The pending calls point to this object, canceling drops the reference of the connection and unreferencing frees
+    // the `AsyncCall`.
+    for (DBusPendingCall *pending : mPendingCalls)
+    {
+        dbus_pending_call_cancel(pending);
+        dbus_pending_call_unref(pending);
+    }
+
+    if (mIsFilterAdded)
+    {
+        dbus_connection_remove_filter(mConnection, sDBusMessageFilter, this);
+    }
+}
+
 ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
 {
     std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
@@ -107,7 +124,7 @@ ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
 
     VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
-    dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
+    mIsFilterAdded = dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
 exit:
     dbus_error_free(&error);
     return ret;
@@ -137,22 +154,31 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     VerifyOrExit(interfaceName == OTBR_DBUS_THREAD_INTERFACE);
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
-    dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
-
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
 
-    for (const auto &f : mDeviceRoleHandlers)
+    // The changes of one mainloop iteration of the server are sent in a
+    // single signal, look for the device role among them.
+    for (dbus_message_iter_recurse(&iter, &subIter); dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY;
+         dbus_message_iter_next(&subIter))
     {
-        f(role);
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+        VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
+
+        if (propertyName != OTBR_DBUS_PROPERTY_DEVICE_ROLE)
+        {
+            continue;
+        }
+
+        dbus_message_iter_recurse(&dictEntryIter, &valIter);
+        SuccessOrExit(DBusMessageExtract(&valIter, val));
+        SuccessOrExit(NameToDeviceRole(val, role));
+
+        for (const auto &f : mDeviceRoleHandlers)
+        {
+            f(role);
+        }
+        handled = DBUS_HANDLER_RESULT_HANDLED;
     }
-    handled = DBUS_HANDLER_RESULT_HANDLED;
 
 exit:
     return handled;
@@ -681,6 +707,11 @@ ClientError ThreadApiDBus::GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetr
     return GetProperty(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO, aMdnsTelemetryInfo);
 }
 
+ClientError ThreadApiDBus::GetMdnsLatencyHistograms(MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MDNS_LATENCY_HISTOGRAMS, aMdnsLatencyHistograms);
+}
+
 ClientError ThreadApiDBus::GetNat64State(Nat64ComponentState &aState)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_STATE, aState);
@@ -713,6 +744,16 @@ ClientError ThreadApiDBus::GetTelemetryData(std::vector<uint8_t> &aTelemetryData
     return GetProperty(OTBR_DBUS_PROPERTY_TELEMETRY_DATA, aTelemetryData);
 }
 
+ClientError ThreadApiDBus::GetTelemetrySectionStats(std::vector<TelemetrySectionStats> &aSectionStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_TELEMETRY_SECTION_STATS, aSectionStats);
+}
+
+ClientError ThreadApiDBus::GetMainloopLatency(MainloopLatency &aMainloopLatency)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MAINLOOP_LATENCY, aMainloopLatency);
+}
+
 ClientError ThreadApiDBus::GetCapabilities(std::vector<uint8_t> &aCapabilities)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_CAPABILITIES, aCapabilities);
@@ -723,6 +764,179 @@ std::string ThreadApiDBus::GetInterfaceName(void)
     return mInterfaceName;
 }
 
+ClientError ThreadApiDBus::GetProperties(const std::vector<std::string> &aPropertyNames, PropertyValues &aValues)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                           OTBR_DBUS_THREAD_INTERFACE,
+                                                           OTBR_DBUS_GET_PROPERTIES_DICT_METHOD));
+    ClientError       ret = ClientError::ERROR_NONE;
+    DBusError         error;
+    DBusMessageIter   iter;
+    DBusMessageIter   subIter;
+    DBusMessageIter   dictEntryIter;
+    std::string       propertyName;
+
+    dbus_error_init(&error);
+    aValues.mValues.clear();
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    aValues.mReply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(aValues.mReply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(aValues.mReply.get()));
+    VerifyOrExit(dbus_message_iter_init(aValues.mReply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+
+    for (dbus_message_iter_recurse(&iter, &subIter); dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY;
+         dbus_message_iter_next(&subIter))
+    {
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        VerifyOrExit(DBusMessageExtract(&dictEntryIter, propertyName) == OTBR_ERROR_NONE,
+                     ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT,
+                     ret = ClientError::ERROR_DBUS);
+        aValues.mValues[propertyName] = dictEntryIter;
+    }
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::CallMethodAsync(const std::string &aMethodName, const OtResultHandler &aHandler)
+{
+    ClientError       error   = ClientError::ERROR_NONE;
+    UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, aMethodName);
+
+    VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+    error = SendAsync(std::move(message), [aHandler](ClientError aError, DBusMessage *) { aHandler(aError); });
+
+exit:
+    return error;
+}
+
+int ThreadApiDBus::GetFd(void) const
+{
+    int fd = -1;
+
+    if (!dbus_connection_get_unix_fd(mConnection, &fd))
+    {
+        fd = -1;
+    }
+
+    return fd;
+}
+
+bool ThreadApiDBus::IsWritePending(void) const
+{
+    return dbus_connection_has_messages_to_send(mConnection);
+}
+
+void ThreadApiDBus::Process(void)
+{
+    dbus_connection_read_write(mConnection, 0);
+
+    while (dbus_connection_dispatch(mConnection) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+    }
+}
+
+UniqueDBusMessage ThreadApiDBus::NewMethodCall(const char *aInterfaceName, const std::string &aMethodName)
+{
+    return UniqueDBusMessage(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                          (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                          aInterfaceName, aMethodName.c_str()));
+}
+
+ClientError ThreadApiDBus::SendAsync(UniqueDBusMessage aMessage, ReplyHandler aHandler)
+{
+    ClientError      error   = ClientError::ERROR_NONE;
+    DBusPendingCall *pending = nullptr;
+    AsyncCall       *call    = new AsyncCall{this, std::move(aHandler)};
+
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, aMessage.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 error = ClientError::ERROR_DBUS);
+
+    // The connection holds a reference to the pending call until the reply or the timeout, and `call` is freed with
+    // the pending call. The reference kept here lets the destructor cancel the calls which are still pending.
+    VerifyOrExit(dbus_pending_call_set_notify(pending, sHandleAsyncReply, call, sFreeAsyncCall),
+                 error = ClientError::ERROR_DBUS);
+    call = nullptr;
+    mPendingCalls.push_back(pending);
+    pending = nullptr;
+
+exit:
+    delete call;
+    if (pending != nullptr)
+    {
+        dbus_pending_call_cancel(pending);
+        dbus_pending_call_unref(pending);
+    }
+    return error;
+}
+
+ClientError ThreadApiDBus::GetPropertyValueAsync(const std::string &aPropertyName, ValueHandler aHandler)
+{
+    ClientError       error   = ClientError::ERROR_NONE;
+    UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD);
+
+    VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) == OTBR_ERROR_NONE,
+                 error = ClientError::ERROR_DBUS);
+    error = SendAsync(std::move(message), [aHandler](ClientError aError, DBusMessage *aReply) {
+        DBusMessageIter iter;
+
+        if (aError == ClientError::ERROR_NONE && !dbus_message_iter_init(aReply, &iter))
+        {
+            aError = ClientError::ERROR_DBUS;
+        }
+
+        aHandler(aError, aError == ClientError::ERROR_NONE ? &iter : nullptr);
+    });
+
+exit:
+    return error;
+}
+
+void ThreadApiDBus::sHandleAsyncReply(DBusPendingCall *aPending, void *aAsyncCall)
+{
+    AsyncCall        *call  = static_cast<AsyncCall *>(aAsyncCall);
+    ClientError       error = ClientError::OT_ERROR_FAILED;
+    UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+    ReplyHandler      handler;
+
+    if (reply != nullptr)
+    {
+        error = CheckErrorMessage(reply.get());
+    }
+
+    // Removing the pending call may free `call`, and the handler may destroy the `ThreadApiDBus`.
+    handler = std::move(call->mHandler);
+    call->mApi->RemovePendingCall(aPending);
+    handler(error, reply.get());
+}
+
+void ThreadApiDBus::sFreeAsyncCall(void *aAsyncCall)
+{
+    delete static_cast<AsyncCall *>(aAsyncCall);
+}
+
+void ThreadApiDBus::RemovePendingCall(DBusPendingCall *aPending)
+{
+    auto it = std::find(mPendingCalls.begin(), mPendingCalls.end(), aPending);
+
+    if (it != mPendingCalls.end())
+    {
+        mPendingCalls.erase(it);
+        dbus_pending_call_unref(aPending);
+    }
+}
+
 ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName)
 {
     ClientError       ret = ClientError::ERROR_NONE;
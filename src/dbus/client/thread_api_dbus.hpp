@@ -37,11 +37,14 @@
 #include "openthread-br/config.h"
 
 #include <functional>
+#include <map>
 
 #include <dbus/dbus.h>
 
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -50,6 +53,51 @@ namespace DBus {
 
 bool IsThreadActive(DeviceRole aRole);
 
+/**
+ * This class holds the values of the properties fetched by `ThreadApiDBus::GetProperties()`.
+ */
+class PropertyValues
+{
+public:
+    /**
+     * This method gets the value of a property.
+     *
+     * @param[in]  aPropertyName  The property name.
+     * @param[out] aValue         The value of the property.
+     *
+     * @retval ERROR_NONE          Successfully got the value.
+     * @retval OT_ERROR_NOT_FOUND  The property wasn't fetched.
+     * @retval ERROR_DBUS          The value isn't of the requested type.
+     */
+    template <typename ValType> ClientError Get(const std::string &aPropertyName, ValType &aValue) const
+    {
+        ClientError     error = ClientError::ERROR_NONE;
+        auto            iter  = mValues.find(aPropertyName);
+        DBusMessageIter valueIter;
+
+        VerifyOrExit(iter != mValues.end(), error = ClientError::OT_ERROR_NOT_FOUND);
+        valueIter = iter->second;
+        VerifyOrExit(DBusMessageExtractFromVariant(&valueIter, aValue) == OTBR_ERROR_NONE,
+                     error = ClientError::ERROR_DBUS);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method returns the number of fetched properties.
+     *
+     * @returns The number of fetched properties.
+     */
+    size_t GetSize(void) const { return mValues.size(); }
+
+private:
+    friend class ThreadApiDBus;
+
+    UniqueDBusMessage                      mReply;
+    std::map<std::string, DBusMessageIter> mValues; ///< The iterators point to the variants in `mReply`.
+};
+
 class ThreadApiDBus
 {
 public:
@@ -58,6 +106,8 @@ public:
     using EnergyScanHandler = std::function<void(const std::vector<EnergyScanResult> &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    template <typename ValType> using PropertyHandler = std::function<void(ClientError, const ValType &)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -75,6 +125,13 @@ public:
      */
     ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName);
 
+    /**
+     * The destructor of a d-bus object.
+     *
+     * The pending asynchronous requests are canceled, their handlers are never invoked.
+     */
+    ~ThreadApiDBus(void);
+
     /**
      * This method adds a callback for device role change.
      *
@@ -758,6 +815,17 @@ public:
      */
     ClientError GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo);
 
+    /**
+     * This method gets the latency histograms of MDNS operations.
+     *
+     * @param[out] aMdnsLatencyHistograms  The latency histograms of MDNS operations.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMdnsLatencyHistograms(MdnsLatencyHistograms &aMdnsLatencyHistograms);
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     /**
      * This method gets the DNS-SD counters.
@@ -852,6 +920,28 @@ public:
      */
     ClientError GetTelemetryData(std::vector<uint8_t> &aTelemetryData);
 
+    /**
+     * This method gets the retrieval statistics of the telemetry data sections.
+     *
+     * @param[out] aSectionStats  The statistics of each telemetry data section.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetTelemetrySectionStats(std::vector<TelemetrySectionStats> &aSectionStats);
+
+    /**
+     * This method gets the latencies of the otbr-agent mainloop.
+     *
+     * @param[out] aMainloopLatency  The latencies of the mainloop iterations, processors and sections.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMainloopLatency(MainloopLatency &aMainloopLatency);
+
     /**
      * This method gets the capabilities data proto serialized byte data.
      *
@@ -864,7 +954,127 @@ public:
      */
     ClientError GetCapabilities(std::vector<uint8_t> &aCapabilities);
 
+    /**
+     * This method gets multiple properties in a single dbus call.
+     *
+     * @param[in]  aPropertyNames  The property names.
+     * @param[out] aValues         The values of the properties.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, PropertyValues &aValues);
+
+    /**
+     * This method gets a property asynchronously.
+     *
+     * The request is sent without waiting for the replies of the earlier requests, so that fetching many properties
+     * only costs about one round trip. The handler is called when the reply is dispatched by `Process()` or by the
+     * event loop which dispatches the connection.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aHandler       The handler of the property value, the value is default constructed on failure.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode error
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler)
+    {
+        return GetPropertyValueAsync(aPropertyName, [aHandler](ClientError aError, DBusMessageIter *aIter) {
+            ValType value{};
+
+            if (aError == ClientError::ERROR_NONE && DBusMessageExtractFromVariant(aIter, value) != OTBR_ERROR_NONE)
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+
+            aHandler(aError, value);
+        });
+    }
+
+    /**
+     * This method calls a method of the Thread interface asynchronously.
+     *
+     * @param[in] aMethodName  The method name.
+     * @param[in] aHandler     The handler of the method result.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode error
+     */
+    ClientError CallMethodAsync(const std::string &aMethodName, const OtResultHandler &aHandler);
+
+    /**
+     * This method calls a method of the Thread interface asynchronously.
+     *
+     * @param[in] aMethodName  The method name.
+     * @param[in] aArgs        The arguments of the method, as a tuple.
+     * @param[in] aHandler     The handler of the method result.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode error
+     */
+    template <typename ArgType>
+    ClientError CallMethodAsync(const std::string &aMethodName, const ArgType &aArgs, const OtResultHandler &aHandler)
+    {
+        ClientError       error   = ClientError::ERROR_NONE;
+        UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, aMethodName);
+
+        VerifyOrExit(message != nullptr, error = ClientError::ERROR_DBUS);
+        VerifyOrExit(TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+        error = SendAsync(std::move(message), [aHandler](ClientError aError, DBusMessage *) { aHandler(aError); });
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method returns the number of asynchronous requests which are waiting for their replies.
+     *
+     * @returns The number of pending asynchronous requests.
+     */
+    size_t GetPendingCallCount(void) const { return mPendingCalls.size(); }
+
+    /**
+     * This method returns the file descriptor of the dbus connection.
+     *
+     * An external event loop should call `Process()` when the file descriptor is readable, or writable while
+     * `IsWritePending()` is true.
+     *
+     * @returns The file descriptor, -1 if the connection isn't backed by a socket.
+     */
+    int GetFd(void) const;
+
+    /**
+     * This method indicates whether there are requests which are not yet written to the connection.
+     *
+     * @returns Whether there are requests to write.
+     */
+    bool IsWritePending(void) const;
+
+    /**
+     * This method reads and writes the connection without blocking and dispatches all received messages.
+     */
+    void Process(void);
+
 private:
+    using ReplyHandler = std::function<void(ClientError aError, DBusMessage *aReply)>;
+    using ValueHandler = std::function<void(ClientError aError, DBusMessageIter *aValueIter)>;
+
+    struct AsyncCall
+    {
+        ThreadApiDBus *mApi;
+        ReplyHandler   mHandler;
+    };
+
+    UniqueDBusMessage NewMethodCall(const char *aInterfaceName, const std::string &aMethodName);
+    ClientError       SendAsync(UniqueDBusMessage aMessage, ReplyHandler aHandler);
+    ClientError       GetPropertyValueAsync(const std::string &aPropertyName, ValueHandler aHandler);
+    static void       sHandleAsyncReply(DBusPendingCall *aPending, void *aAsyncCall);
+    static void       sFreeAsyncCall(void *aAsyncCall);
+    void              RemovePendingCall(DBusPendingCall *aPending);
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -910,6 +1120,9 @@ private:
     OtResultHandler   mJoinerHandler;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+
+    std::vector<DBusPendingCall *> mPendingCalls;
+    bool                           mIsFilterAdded = false;
 };
 
 } // namespace DBus
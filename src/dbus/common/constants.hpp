@@ -61,6 +61,7 @@
 #define OTBR_DBUS_ATTACH_ALL_NODES_TO_METHOD "AttachAllNodesTo"
 #define OTBR_DBUS_UPDATE_VENDOR_MESHCOP_TXT_METHOD "UpdateVendorMeshCopTxtEntries"
 #define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
+#define OTBR_DBUS_GET_PROPERTIES_DICT_METHOD "GetPropertiesDict"
 #define OTBR_DBUS_LEAVE_NETWORK_METHOD "LeaveNetwork"
 #define OTBR_DBUS_SET_NAT64_ENABLED_METHOD "SetNat64Enabled"
 #define OTBR_DBUS_ACTIVATE_EPHEMERAL_KEY_MODE_METHOD "ActivateEphemeralKeyMode"
@@ -109,6 +110,7 @@
 #define OTBR_DBUS_PROPERTY_THREAD_VERSION "ThreadVersion"
 #define OTBR_DBUS_PROPERTY_EUI64 "Eui64"
 #define OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO "MdnsTelemetryInfo"
+#define OTBR_DBUS_PROPERTY_MDNS_LATENCY_HISTOGRAMS "MdnsLatencyHistograms"
 #define OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS "RadioSpinelMetrics"
 #define OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS "RcpInterfaceMetrics"
 #define OTBR_DBUS_PROPERTY_UPTIME "Uptime"
@@ -124,6 +126,8 @@
 #define OTBR_DBUS_PROPERTY_DNS_UPSTREAM_QUERY_STATE "DnsUpstreamQueryState"
 #define OTBR_DBUS_PROPERTY_DHCP6_PD_STATE "Dhcp6PdState"
 #define OTBR_DBUS_PROPERTY_TELEMETRY_DATA "TelemetryData"
+#define OTBR_DBUS_PROPERTY_TELEMETRY_SECTION_STATS "TelemetrySectionStats"
+#define OTBR_DBUS_PROPERTY_MAINLOOP_LATENCY "MainloopLatency"
 #define OTBR_DBUS_PROPERTY_CAPABILITIES "Capabilities"
 
 #define OTBR_NAT64_STATE_NAME_DISABLED "disabled"
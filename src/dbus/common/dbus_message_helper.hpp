@@ -89,6 +89,10 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aLatencyHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aLatencyHistogram);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistograms &aMdnsLatencyHistograms);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistograms &aMdnsLatencyHistograms);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, DnssdCounters &aDnssdCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics);
@@ -119,6 +123,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TelemetrySectionStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TelemetrySectionStats &aStats);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorLatency &aLatency);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorLatency &aLatency);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopLatency &aLatency);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopLatency &aLatency);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -152,6 +162,22 @@ template <size_t SIZE> struct DBusTypeTrait<std::array<uint8_t, SIZE>>
     static constexpr const char *TYPE_AS_STRING = "ay";
 };
 
+/**
+ * This structure refers to an array of fixed-size values, which is encoded in place without being copied into a
+ * `std::vector` first.
+ */
+template <typename T> struct FixedArrayView
+{
+    const T *mValues; ///< The values, they must outlive the view.
+    size_t   mLength; ///< The number of values.
+};
+
+template <> struct DBusTypeTrait<FixedArrayView<uint8_t>>
+{
+    // array of bytes
+    static constexpr const char *TYPE_AS_STRING = "ay";
+};
+
 template <> struct DBusTypeTrait<Ip6Prefix>
 {
     // struct of {array of bytes, byte}
@@ -284,6 +310,17 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
 };
 
+template <> struct DBusTypeTrait<MdnsLatencyHistograms>
+{
+    // struct of { struct of { uint32, array of uint32 },
+    //              struct of { uint32, array of uint32 },
+    //              struct of { uint32, array of uint32 },
+    //              struct of { uint32, array of uint32 },
+    //              struct of { uint32, array of uint32 },
+    //              struct of { uint32, array of uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "((uau)(uau)(uau)(uau)(uau)(uau))";
+};
+
 template <> struct DBusTypeTrait<DnssdCounters>
 {
     // struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32 }
@@ -407,6 +444,32 @@ template <> struct DBusTypeTrait<InfraLinkInfo>
     static constexpr const char *TYPE_AS_STRING = "(sbbbuuu)";
 };
 
+template <> struct DBusTypeTrait<TelemetrySectionStats>
+{
+    // struct of { string, uint32, uint32, uint64, uint64, uint64, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(suutttu)";
+};
+
+template <> struct DBusTypeTrait<std::vector<TelemetrySectionStats>>
+{
+    // array of struct of { string, uint32, uint32, uint64, uint64, uint64, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(suutttu)";
+};
+
+template <> struct DBusTypeTrait<MainloopProcessorLatency>
+{
+    // struct of { string, uint32, struct of { uint32, array of uint32 }, struct of { uint32, array of uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "(su(uau)(uau))";
+};
+
+template <> struct DBusTypeTrait<MainloopLatency>
+{
+    // struct of { bool, uint32, uint32, struct of { uint32, array of uint32 },
+    //              array of struct of { string, uint32, struct of { uint32, array of uint32 },
+    //                                   struct of { uint32, array of uint32 } } }
+    static constexpr const char *TYPE_AS_STRING = "(buu(uau)a(su(uau)(uau)))";
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -609,7 +672,20 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
+/**
+ * This function encodes an array of fixed-size basic values with a single copy into the message.
+ *
+ * The d-bus wire format only allows this for arrays of basic types, arrays of structs have to be encoded element by
+ * element.
+ *
+ * @param[in] aIter    The message iterator.
+ * @param[in] aValues  The values.
+ * @param[in] aLength  The number of values.
+ *
+ * @retval OTBR_ERROR_NONE  Successfully encoded the array.
+ * @retval OTBR_ERROR_DBUS  Failed to encode the array.
+ */
+template <typename T> otbrError DBusMessageEncodeFixedArray(DBusMessageIter *aIter, const T *aValues, size_t aLength)
 {
     DBusMessageIter subIter;
     otbrError       error = OTBR_ERROR_NONE;
@@ -617,12 +693,10 @@ template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIte
     VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
                  error = OTBR_ERROR_DBUS);
 
-    if (!aValue.empty())
+    if (aLength > 0)
     {
-        const T *buf = &aValue.front();
-
-        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &buf,
-                                                          static_cast<int>(aValue.size())),
+        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &aValues,
+                                                          static_cast<int>(aLength)),
                      error = OTBR_ERROR_DBUS);
     }
     VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
@@ -630,26 +704,20 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageEncodePrimitive(DBusMessageIter *aIter, const std::vector<T> &aValue)
+{
+    return DBusMessageEncodeFixedArray(aIter, aValue.data(), aValue.size());
+}
+
 template <typename T, size_t SIZE>
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::array<T, SIZE> &aValue)
 {
-    DBusMessageIter subIter;
-    otbrError       error = OTBR_ERROR_NONE;
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBusTypeTrait<T>::TYPE_AS_STRING, &subIter),
-                 error = OTBR_ERROR_DBUS);
-
-    if (!aValue.empty())
-    {
-        const T *buf = &aValue.front();
+    return DBusMessageEncodeFixedArray(aIter, aValue.data(), SIZE);
+}
 
-        VerifyOrExit(dbus_message_iter_append_fixed_array(&subIter, DBusTypeTrait<T>::TYPE, &buf,
-                                                          static_cast<int>(aValue.size())),
-                     error = OTBR_ERROR_DBUS);
-    }
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const FixedArrayView<T> &aValue)
+{
+    return DBusMessageEncodeFixedArray(aIter, aValue.mValues, aValue.mLength);
 }
 
 template <size_t I, typename... FieldTypes> struct ElementType
@@ -765,6 +833,47 @@ exit:
     return error;
 }
 
+/**
+ * This function encodes an array to a d-bus variant, reading the elements one by one.
+ *
+ * Each element is encoded as soon as it's read, so that a table, for example read from an OpenThread iterator,
+ * doesn't need to be copied into a `std::vector` before being encoded. The same element object is reused for all
+ * the elements.
+ *
+ * @param[in] aIter     The message iterator.
+ * @param[in] aGetNext  The function filling the next element, it returns `false` when there are no more elements.
+ *
+ * @retval OTBR_ERROR_NONE  Successfully encoded the array.
+ * @retval OTBR_ERROR_DBUS  Failed to encode the array.
+ */
+template <typename ElementType, typename GetNextFunc>
+otbrError DBusMessageEncodeArrayToVariant(DBusMessageIter *aIter, GetNextFunc aGetNext)
+{
+    otbrError       error = OTBR_ERROR_NONE;
+    DBusMessageIter variantIter;
+    DBusMessageIter arrayIter;
+    ElementType     element{};
+
+    VerifyOrExit(
+        dbus_message_iter_open_container(aIter, DBUS_TYPE_VARIANT,
+                                         DBusTypeTrait<std::vector<ElementType>>::TYPE_AS_STRING, &variantIter),
+        error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_open_container(&variantIter, DBUS_TYPE_ARRAY,
+                                                  DBusTypeTrait<ElementType>::TYPE_AS_STRING, &arrayIter),
+                 error = OTBR_ERROR_DBUS);
+
+    while (aGetNext(element))
+    {
+        SuccessOrExit(error = DBusMessageEncode(&arrayIter, element));
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&variantIter, &arrayIter), error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &variantIter), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 /**
  * This function converts a d-bus variant to a value.
  *
@@ -736,6 +736,90 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aLatencyHistogram)
+{
+    DBusMessageIter                                     sub;
+    otbrError                                           error = OTBR_ERROR_NONE;
+    std::array<uint32_t, LatencyHistogram::kNumBuckets> bucketCounts;
+
+    for (uint8_t i = 0; i < LatencyHistogram::kNumBuckets; i++)
+    {
+        bucketCounts[i] = aLatencyHistogram.GetBucketCount(i);
+    }
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyHistogram.GetMax()));
+    SuccessOrExit(error = DBusMessageEncode(&sub, bucketCounts));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aLatencyHistogram)
+{
+    DBusMessageIter       sub;
+    otbrError             error = OTBR_ERROR_NONE;
+    uint32_t              max;
+    std::vector<uint32_t> bucketCounts;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, max));
+    SuccessOrExit(error = DBusMessageExtract(&sub, bucketCounts));
+    VerifyOrExit(bucketCounts.size() == LatencyHistogram::kNumBuckets, error = OTBR_ERROR_DBUS);
+
+    aLatencyHistogram.Clear();
+    aLatencyHistogram.SetMax(max);
+    for (uint8_t i = 0; i < LatencyHistogram::kNumBuckets; i++)
+    {
+        aLatencyHistogram.SetBucketCount(i, bucketCounts[i]);
+    }
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mHostRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mHostResolution));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mServiceResolution));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mServiceBrowse));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mHostRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mHostResolution));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mServiceResolution));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mServiceBrowse));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics)
 {
     DBusMessageIter sub;
@@ -1258,5 +1342,103 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TelemetrySectionStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aStats.mName, aStats.mRefreshCount, aStats.mCacheHitCount, aStats.mLastDurationUs,
+                                     aStats.mMaxDurationUs, aStats.mTotalDurationUs, aStats.mFragmentSize);
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TelemetrySectionStats &aStats)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    auto            args  = std::tie(aStats.mName, aStats.mRefreshCount, aStats.mCacheHitCount, aStats.mLastDurationUs,
+                                     aStats.mMaxDurationUs, aStats.mTotalDurationUs, aStats.mFragmentSize);
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+    SuccessOrExit(error = ConvertToTuple(&sub, args));
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopProcessorLatency &aLatency)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mName));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mStallCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mProcessLatency));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopProcessorLatency &aLatency)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mName));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mStallCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mUpdateLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mProcessLatency));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopLatency &aLatency)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mProfilingEnabled));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mStallBudgetMs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mStallCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mIterationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatency.mProcessors));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopLatency &aLatency)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mProfilingEnabled));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mStallBudgetMs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mStallCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mIterationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatency.mProcessors));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
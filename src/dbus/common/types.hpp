@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include "common/types.hpp"
 #include "dbus/common/error.hpp"
 
 #include <stdint.h>
@@ -684,6 +685,34 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+struct TelemetrySectionStats
+{
+    std::string mName;            ///< The name of the telemetry section.
+    uint32_t    mRefreshCount;    ///< The number of times the section was retrieved.
+    uint32_t    mCacheHitCount;   ///< The number of times the cached section was reused.
+    uint64_t    mLastDurationUs;  ///< The time spent by the last retrieval in microseconds.
+    uint64_t    mMaxDurationUs;   ///< The longest time spent by a retrieval in microseconds.
+    uint64_t    mTotalDurationUs; ///< The time spent by all retrievals in microseconds.
+    uint32_t    mFragmentSize;    ///< The size of the serialized section in bytes.
+};
+
+struct MainloopProcessorLatency
+{
+    std::string      mName;           ///< The name of the mainloop processor or section.
+    uint32_t         mStallCount;     ///< The number of stalled iterations in which it took the longest.
+    LatencyHistogram mUpdateLatency;  ///< The durations of `Update()` in microseconds, empty for sections.
+    LatencyHistogram mProcessLatency; ///< The durations of `Process()`, or of the section, in microseconds.
+};
+
+struct MainloopLatency
+{
+    bool                                  mProfilingEnabled; ///< Whether mainloop profiling is enabled.
+    uint32_t                              mStallBudgetMs;    ///< The stall budget of an iteration in milliseconds.
+    uint32_t                              mStallCount;       ///< The number of iterations over the stall budget.
+    LatencyHistogram                      mIterationLatency; ///< The durations of the iterations in microseconds.
+    std::vector<MainloopProcessorLatency> mProcessors;       ///< The latencies of each processor and section.
+};
+
 } // namespace DBus
 } // namespace otbr
 
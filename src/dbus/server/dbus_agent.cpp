@@ -141,7 +141,8 @@ void DBusAgent::Update(MainloopContext &aMainloop)
     int          fd;
     uint8_t      fdSetMask = MainloopContext::kErrorFdSet;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS ||
+        mThreadObject->HasQueuedPropertiesChanged())
     {
         aMainloop.mTimeout = {0, 0};
     }
@@ -215,6 +216,10 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
 
     while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
         ;
+
+    // Property changes of one mainloop iteration, e.g. the role and the
+    // dataset on attaching, are sent in a single signal.
+    mThreadObject->FlushPropertiesChanged();
 }
 
 } // namespace DBus
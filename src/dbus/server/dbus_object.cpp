@@ -137,7 +137,7 @@ DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMe
     if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
     {
         otbrLogDebug("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
         {
             DumpDBusMessage(*aMessage);
         }
@@ -180,7 +180,7 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 exit:
     if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
     {
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
         {
             otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
             DumpDBusMessage(*reply);
@@ -204,33 +204,25 @@ exit:
 
 void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
 {
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-    DBusMessageIter   iter, subIter, dictEntryIter;
-    std::string       interfaceName;
-    auto              args  = std::tie(interfaceName);
-    otError           error = OT_ERROR_NONE;
+    UniqueDBusMessage        reply{dbus_message_new_method_return(aRequest.GetMessage())};
+    DBusMessageIter          iter;
+    std::string              interfaceName;
+    auto                     args = std::tie(interfaceName);
+    std::vector<std::string> propertyNames;
+    otError                  error = OT_ERROR_NONE;
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-    dbus_message_iter_init_append(reply.get(), &iter);
 
-    for (auto &p : mGetPropertyHandlers.at(interfaceName))
+    for (const auto &p : mGetPropertyHandlers.at(interfaceName))
     {
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
-
-        SuccessOrExit(error = p.second(dictEntryIter));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
+        propertyNames.push_back(p.first);
     }
 
+    dbus_message_iter_init_append(reply.get(), &iter);
+    SuccessOrExit(error = EncodeProperties(iter, interfaceName, propertyNames));
+
 exit:
     if (error == OT_ERROR_NONE)
     {
@@ -242,6 +234,38 @@ exit:
     }
 }
 
+otError DBusObject::EncodeProperties(DBusMessageIter                &aIter,
+                                     const std::string              &aInterfaceName,
+                                     const std::vector<std::string> &aPropertyNames)
+{
+    otError         error         = OT_ERROR_NONE;
+    auto            interfaceIter = mGetPropertyHandlers.find(aInterfaceName);
+    DBusMessageIter subIter, dictEntryIter;
+
+    VerifyOrExit(interfaceIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(dbus_message_iter_open_container(&aIter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OT_ERROR_FAILED);
+
+    for (const std::string &propertyName : aPropertyNames)
+    {
+        auto handlerIter = interfaceIter->second.find(propertyName);
+
+        VerifyOrExit(handlerIter != interfaceIter->second.end(), error = OT_ERROR_NOT_FOUND);
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OT_ERROR_FAILED);
+        VerifyOrExit(DBusMessageEncode(&dictEntryIter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+        SuccessOrExit(error = handlerIter->second(dictEntryIter));
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&aIter, &subIter), error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
 void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
 {
     DBusMessageIter iter;
@@ -311,6 +335,74 @@ DBusObject::~DBusObject(void)
 {
 }
 
+otbrError DBusObject::FlushPropertiesChanged(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      queuedChanges(std::move(mQueuedPropertyChanges));
+
+    mQueuedPropertyChanges.clear();
+
+    for (const auto &interfaceChanges : queuedChanges)
+    {
+        otbrError signalError = SignalPropertiesChanged(interfaceChanges.first, interfaceChanges.second);
+
+        if (signalError != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal property changes of %s: %s", interfaceChanges.first.c_str(),
+                           otbrErrorString(signalError));
+            error = signalError;
+        }
+    }
+
+    return error;
+}
+
+otbrError DBusObject::SignalPropertiesChanged(const std::string                 &aInterfaceName,
+                                              const std::vector<PropertyChange> &aChanges)
+{
+    UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+    DBusMessageIter   iter, subIter, dictEntryIter;
+    otbrError         error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const PropertyChange &change : aChanges)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, change.first));
+        SuccessOrExit(error = change.second(dictEntryIter));
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+
+        otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), change.first.c_str());
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
+    {
+        DumpDBusMessage(*signalMsg);
+    }
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName)
 {
     return UniqueDBusMessage(dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
@@ -40,10 +40,13 @@
 #define OTBR_LOG_TAG "DBUS"
 #endif
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <dbus/dbus.h>
 
@@ -172,44 +175,60 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType   &aValue)
     {
-        UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
-        DBusMessageIter   iter, subIter, dictEntryIter;
-        otbrError         error = OTBR_ERROR_NONE;
+        PropertyEncoderType encoder = [&aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
 
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
-
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
-
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
-
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+        return SignalPropertiesChanged(aInterfaceName, {PropertyChange(aPropertyName, std::move(encoder))});
+    }
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    /**
+     * This method queues a property changed signal.
+     *
+     * The changes queued for an interface are sent in a single signal by `FlushPropertiesChanged()`, a property which
+     * changed more than once is sent with its last value.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     * @param[in] aValue          New value of the property.
+     */
+    template <typename ValueType>
+    void QueuePropertyChanged(const std::string &aInterfaceName,
+                              const std::string &aPropertyName,
+                              const ValueType   &aValue)
+    {
+        PropertyEncoderType encoder = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
+        auto &changes = mQueuedPropertyChanges[aInterfaceName];
+        auto  iter    = std::find_if(changes.begin(), changes.end(), [&aPropertyName](const PropertyChange &aChange) {
+            return aChange.first == aPropertyName;
+        });
+
+        if (iter != changes.end())
+        {
+            iter->second = std::move(encoder);
+        }
+        else
         {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
+            changes.emplace_back(aPropertyName, std::move(encoder));
         }
+    }
 
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+    /**
+     * This method indicates whether there are queued property changed signals.
+     *
+     * @returns Whether there are queued property changed signals.
+     */
+    bool HasQueuedPropertiesChanged(void) const { return !mQueuedPropertyChanges.empty(); }
 
-    exit:
-        return error;
-    }
+    /**
+     * This method sends the queued property changes, one signal per interface.
+     *
+     * @retval OTBR_ERROR_NONE  Signals successfully sent.
+     * @retval OTBR_ERROR_DBUS  Failed to send a signal.
+     */
+    otbrError FlushPropertiesChanged(void);
 
     /**
      * The destructor of a d-bus object.
@@ -224,7 +243,27 @@ public:
 protected:
     otbrError Initialize(bool aIsAsyncPropertyHandler);
 
+    /**
+     * This method encodes the values of properties as a dictionary of property names to variants.
+     *
+     * @param[in] aIter           The message iterator to append the dictionary to.
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyNames  The property names.
+     *
+     * @retval OT_ERROR_NONE       Successfully encoded the properties.
+     * @retval OT_ERROR_NOT_FOUND  A property has no get handler.
+     * @retval ...                 The error of a get handler or of encoding the dictionary.
+     */
+    otError EncodeProperties(DBusMessageIter                &aIter,
+                             const std::string              &aInterfaceName,
+                             const std::vector<std::string> &aPropertyNames);
+
 private:
+    using PropertyEncoderType = std::function<otbrError(DBusMessageIter &)>;
+    using PropertyChange      = std::pair<std::string, PropertyEncoderType>;
+
+    otbrError SignalPropertiesChanged(const std::string &aInterfaceName, const std::vector<PropertyChange> &aChanges);
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
     void GetPropertyMethodHandler(DBusRequest &aRequest);
     void SetPropertyMethodHandler(DBusRequest &aRequest);
@@ -242,6 +281,9 @@ private:
     std::unordered_map<std::string, PropertyHandlerType> mSetPropertyHandlers;
     DBusConnection                                      *mConnection;
     std::string                                          mObjectPath;
+
+    // The property changes to be signaled by interface, in the order they were queued.
+    std::unordered_map<std::string, std::vector<PropertyChange>> mQueuedPropertyChanges;
 };
 
 } // namespace DBus
@@ -57,6 +57,8 @@ otbrError DBusThreadObjectNcp::Init(void)
 
     RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                                     std::bind(&DBusThreadObjectNcp::AsyncGetDeviceRoleHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_IP6_COUNTERS,
+                               std::bind(&DBusThreadObjectNcp::GetIp6CountersHandler, this, _1));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOIN_METHOD,
                    std::bind(&DBusThreadObjectNcp::JoinHandler, this, _1));
@@ -77,6 +79,24 @@ void DBusThreadObjectNcp::AsyncGetDeviceRoleHandler(DBusRequest &aRequest)
     ReplyAsyncGetProperty(aRequest, GetDeviceRoleName(role));
 }
 
+otError DBusThreadObjectNcp::GetIp6CountersHandler(DBusMessageIter &aIter)
+{
+    const Ncp::NcpSpinel::Ip6TxCounters &txCounters = mHost.GetIp6TxCounters();
+    IpCounters                           counters;
+    otError                              error = OT_ERROR_NONE;
+
+    // Only the transmit path to the NCP is counted by the host, the NCP counts the rest.
+    counters.mTxSuccess = static_cast<uint32_t>(txCounters.mSentPackets);
+    counters.mTxFailure = static_cast<uint32_t>(txCounters.mDroppedPackets + txCounters.mFailedPackets);
+    counters.mRxSuccess = 0;
+    counters.mRxFailure = 0;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent)
 {
     UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
@@ -78,7 +78,8 @@ public:
     otbrError Init(void) override;
 
 private:
-    void AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
+    void    AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
+    otError GetIp6CountersHandler(DBusMessageIter &aIter);
     void ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
 
     void JoinHandler(DBusRequest &aRequest);
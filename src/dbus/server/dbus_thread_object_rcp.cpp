@@ -49,6 +49,7 @@
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
@@ -159,6 +160,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                    std::bind(&DBusThreadObjectRcp::UpdateMeshCopTxtHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
                    std::bind(&DBusThreadObjectRcp::GetPropertiesHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_DICT_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetPropertiesDictHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_LEAVE_NETWORK_METHOD,
                    std::bind(&DBusThreadObjectRcp::LeaveNetworkHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SET_NAT64_ENABLED_METHOD,
@@ -261,6 +264,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetSrpServerInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO,
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_LATENCY_HISTOGRAMS,
+                               std::bind(&DBusThreadObjectRcp::GetMdnsLatencyHistogramsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
@@ -301,6 +306,10 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetDnsUpstreamQueryState, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
                                std::bind(&DBusThreadObjectRcp::GetTelemetryDataHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_SECTION_STATS,
+                               std::bind(&DBusThreadObjectRcp::GetTelemetrySectionStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MAINLOOP_LATENCY,
+                               std::bind(&DBusThreadObjectRcp::GetMainloopLatencyHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
 
@@ -312,14 +321,14 @@ exit:
 
 void DBusThreadObjectRcp::DeviceRoleHandler(otDeviceRole aDeviceRole)
 {
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
+    QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
 }
 
 #if OTBR_ENABLE_DHCP6_PD
 void DBusThreadObjectRcp::Dhcp6PdStateHandler(otBorderRoutingDhcp6PdState aDhcp6PdState)
 {
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DHCP6_PD_STATE,
-                          GetDhcp6PdStateName(aDhcp6PdState));
+    QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DHCP6_PD_STATE,
+                         GetDhcp6PdStateName(aDhcp6PdState));
 }
 #endif
 
@@ -328,8 +337,8 @@ void DBusThreadObjectRcp::NcpResetHandler(void)
     mHost.GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObjectRcp::DeviceRoleHandler, this, _1));
     mHost.GetThreadHelper()->AddActiveDatasetChangeHandler(
         std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                          GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
+    QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+                         GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
 void DBusThreadObjectRcp::ScanHandler(DBusRequest &aRequest)
@@ -762,8 +771,9 @@ otError DBusThreadObjectRcp::GetNetworkKeyHandler(DBusMessageIter &aIter)
     otError      error = OT_ERROR_NONE;
 
     otThreadGetNetworkKey(threadHelper->GetInstance(), &networkKey);
-    std::vector<uint8_t> keyVal(networkKey.m8, networkKey.m8 + sizeof(networkKey.m8));
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, keyVal) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{networkKey.m8, sizeof(networkKey.m8)}) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -935,11 +945,10 @@ otError DBusThreadObjectRcp::GetNetworkDataHandler(DBusMessageIter &aIter)
     otError                 error               = OT_ERROR_NONE;
     uint8_t                 data[kNetworkDataMaxSize];
     uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
 
     SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/false, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{data, len}) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -952,11 +961,10 @@ otError DBusThreadObjectRcp::GetStableNetworkDataHandler(DBusMessageIter &aIter)
     otError                 error               = OT_ERROR_NONE;
     uint8_t                 data[kNetworkDataMaxSize];
     uint8_t                 len = sizeof(data);
-    std::vector<uint8_t>    networkData;
 
     SuccessOrExit(error = otNetDataGet(threadHelper->GetInstance(), /*stable=*/true, data, &len));
-    networkData = std::vector<uint8_t>(&data[0], &data[len]);
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, networkData) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{data, len}) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -994,23 +1002,30 @@ exit:
 otError DBusThreadObjectRcp::GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter)
 {
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
-    auto                        threadHelper = mHost.GetThreadHelper();
-    otError                     error        = OT_ERROR_NONE;
-    uint32_t                    channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
-    constexpr uint8_t           kNumChannels = sizeof(channelMask) * 8; // 8 bit per byte
-    std::vector<ChannelQuality> quality;
-
-    for (uint8_t i = 0; i < kNumChannels; i++)
-    {
-        if (channelMask & (1U << i))
+    auto              threadHelper = mHost.GetThreadHelper();
+    otError           error        = OT_ERROR_NONE;
+    uint32_t          channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
+    constexpr uint8_t kNumChannels = sizeof(channelMask) * 8; // 8 bit per byte
+    uint8_t           channel      = 0;
+    auto              getNext      = [&](ChannelQuality &aQuality) {
+        while (channel < kNumChannels && !(channelMask & (1U << channel)))
         {
-            uint16_t occupancy = otChannelMonitorGetChannelOccupancy(threadHelper->GetInstance(), i);
+            channel++;
+        }
 
-            quality.emplace_back(ChannelQuality{i, occupancy});
+        if (channel < kNumChannels)
+        {
+            aQuality.mChannel   = channel;
+            aQuality.mOccupancy = otChannelMonitorGetChannelOccupancy(threadHelper->GetInstance(), channel);
+            channel++;
+            return true;
         }
-    }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, quality) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        return false;
+    };
+
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<ChannelQuality>(&aIter, getNext) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1022,35 +1037,39 @@ exit:
 
 otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
 {
-    auto                   threadHelper = mHost.GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
-    uint16_t               childIndex   = 0;
-    otChildInfo            childInfo;
-    std::vector<ChildInfo> childTable;
+    auto     threadHelper = mHost.GetThreadHelper();
+    otError  error        = OT_ERROR_NONE;
+    uint16_t childIndex   = 0;
+    auto     getNext      = [&](ChildInfo &aInfo) {
+        otChildInfo childInfo;
+        bool        found =
+            (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE);
 
-    while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
-    {
-        ChildInfo info;
-
-        info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8);
-        info.mTimeout            = childInfo.mTimeout;
-        info.mAge                = childInfo.mAge;
-        info.mChildId            = childInfo.mChildId;
-        info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
-        info.mLinkQualityIn      = childInfo.mLinkQualityIn;
-        info.mAverageRssi        = childInfo.mAverageRssi;
-        info.mLastRssi           = childInfo.mLastRssi;
-        info.mFrameErrorRate     = childInfo.mFrameErrorRate;
-        info.mMessageErrorRate   = childInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice   = childInfo.mFullThreadDevice;
-        info.mFullNetworkData    = childInfo.mFullNetworkData;
-        info.mIsStateRestoring   = childInfo.mIsStateRestoring;
-        childTable.push_back(info);
-        childIndex++;
-    }
+        if (found)
+        {
+            aInfo.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8);
+            aInfo.mTimeout            = childInfo.mTimeout;
+            aInfo.mAge                = childInfo.mAge;
+            aInfo.mRloc16             = childInfo.mRloc16;
+            aInfo.mChildId            = childInfo.mChildId;
+            aInfo.mNetworkDataVersion = childInfo.mNetworkDataVersion;
+            aInfo.mLinkQualityIn      = childInfo.mLinkQualityIn;
+            aInfo.mAverageRssi        = childInfo.mAverageRssi;
+            aInfo.mLastRssi           = childInfo.mLastRssi;
+            aInfo.mFrameErrorRate     = childInfo.mFrameErrorRate;
+            aInfo.mMessageErrorRate   = childInfo.mMessageErrorRate;
+            aInfo.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
+            aInfo.mFullThreadDevice   = childInfo.mFullThreadDevice;
+            aInfo.mFullNetworkData    = childInfo.mFullNetworkData;
+            aInfo.mIsStateRestoring   = childInfo.mIsStateRestoring;
+            childIndex++;
+        }
+
+        return found;
+    };
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<ChildInfo>(&aIter, getNext) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1058,35 +1077,38 @@ exit:
 
 otError DBusThreadObjectRcp::GetNeighborTableHandler(DBusMessageIter &aIter)
 {
-    auto                      threadHelper = mHost.GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
-    otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    otNeighborInfo            neighborInfo;
-    std::vector<NeighborInfo> neighborTable;
+    auto                   threadHelper = mHost.GetThreadHelper();
+    otError                error        = OT_ERROR_NONE;
+    otNeighborInfoIterator iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    auto                   getNext      = [&](NeighborInfo &aInfo) {
+        otNeighborInfo neighborInfo;
+        bool           found =
+            (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE);
 
-    while (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE)
-    {
-        NeighborInfo info;
-
-        info.mExtAddress       = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8);
-        info.mAge              = neighborInfo.mAge;
-        info.mRloc16           = neighborInfo.mRloc16;
-        info.mLinkFrameCounter = neighborInfo.mLinkFrameCounter;
-        info.mMleFrameCounter  = neighborInfo.mMleFrameCounter;
-        info.mLinkQualityIn    = neighborInfo.mLinkQualityIn;
-        info.mAverageRssi      = neighborInfo.mAverageRssi;
-        info.mLastRssi         = neighborInfo.mLastRssi;
-        info.mFrameErrorRate   = neighborInfo.mFrameErrorRate;
-        info.mMessageErrorRate = neighborInfo.mMessageErrorRate;
-        info.mVersion          = neighborInfo.mVersion;
-        info.mRxOnWhenIdle     = neighborInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice = neighborInfo.mFullThreadDevice;
-        info.mFullNetworkData  = neighborInfo.mFullNetworkData;
-        info.mIsChild          = neighborInfo.mIsChild;
-        neighborTable.push_back(info);
-    }
+        if (found)
+        {
+            aInfo.mExtAddress       = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8);
+            aInfo.mAge              = neighborInfo.mAge;
+            aInfo.mRloc16           = neighborInfo.mRloc16;
+            aInfo.mLinkFrameCounter = neighborInfo.mLinkFrameCounter;
+            aInfo.mMleFrameCounter  = neighborInfo.mMleFrameCounter;
+            aInfo.mLinkQualityIn    = neighborInfo.mLinkQualityIn;
+            aInfo.mAverageRssi      = neighborInfo.mAverageRssi;
+            aInfo.mLastRssi         = neighborInfo.mLastRssi;
+            aInfo.mFrameErrorRate   = neighborInfo.mFrameErrorRate;
+            aInfo.mMessageErrorRate = neighborInfo.mMessageErrorRate;
+            aInfo.mVersion          = neighborInfo.mVersion;
+            aInfo.mRxOnWhenIdle     = neighborInfo.mRxOnWhenIdle;
+            aInfo.mFullThreadDevice = neighborInfo.mFullThreadDevice;
+            aInfo.mFullNetworkData  = neighborInfo.mFullNetworkData;
+            aInfo.mIsChild          = neighborInfo.mIsChild;
+        }
+
+        return found;
+    };
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<NeighborInfo>(&aIter, getNext) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1132,27 +1154,30 @@ exit:
 
 otError DBusThreadObjectRcp::GetExternalRoutesHandler(DBusMessageIter &aIter)
 {
-    auto                       threadHelper = mHost.GetThreadHelper();
-    otError                    error        = OT_ERROR_NONE;
-    otNetworkDataIterator      iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otExternalRouteConfig      config;
-    std::vector<ExternalRoute> externalRouteTable;
+    auto                  threadHelper = mHost.GetThreadHelper();
+    otError               error        = OT_ERROR_NONE;
+    otNetworkDataIterator iter         = OT_NETWORK_DATA_ITERATOR_INIT;
+    auto                  getNext      = [&](ExternalRoute &aRoute) {
+        otExternalRouteConfig config;
+        bool                  found =
+            (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE);
+
+        if (found)
+        {
+            // The element is reused, so assigning the prefix doesn't allocate memory after the first route.
+            aRoute.mPrefix.mPrefix.assign(&config.mPrefix.mPrefix.mFields.m8[0],
+                                          &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
+            aRoute.mPrefix.mLength      = config.mPrefix.mLength;
+            aRoute.mRloc16              = config.mRloc16;
+            aRoute.mPreference          = config.mPreference;
+            aRoute.mStable              = config.mStable;
+            aRoute.mNextHopIsThisDevice = config.mNextHopIsThisDevice;
+        }
 
-    while (otNetDataGetNextRoute(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
-    {
-        ExternalRoute route;
-
-        route.mPrefix.mPrefix      = std::vector<uint8_t>(&config.mPrefix.mPrefix.mFields.m8[0],
-                                                     &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
-        route.mPrefix.mLength      = config.mPrefix.mLength;
-        route.mRloc16              = config.mRloc16;
-        route.mPreference          = config.mPreference;
-        route.mStable              = config.mStable;
-        route.mNextHopIsThisDevice = config.mNextHopIsThisDevice;
-        externalRouteTable.push_back(route);
-    }
+        return found;
+    };
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, externalRouteTable) == OTBR_ERROR_NONE,
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<ExternalRoute>(&aIter, getNext) == OTBR_ERROR_NONE,
                  error = OT_ERROR_INVALID_ARGS);
 
 exit:
@@ -1161,33 +1186,37 @@ exit:
 
 otError DBusThreadObjectRcp::GetOnMeshPrefixesHandler(DBusMessageIter &aIter)
 {
-    auto                      threadHelper = mHost.GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
-    otNetworkDataIterator     iter         = OT_NETWORK_DATA_ITERATOR_INIT;
-    otBorderRouterConfig      config;
-    std::vector<OnMeshPrefix> onMeshPrefixes;
+    auto                  threadHelper = mHost.GetThreadHelper();
+    otError               error        = OT_ERROR_NONE;
+    otNetworkDataIterator iter         = OT_NETWORK_DATA_ITERATOR_INIT;
+    auto                  getNext      = [&](OnMeshPrefix &aPrefix) {
+        otBorderRouterConfig config;
+        bool                 found =
+            (otNetDataGetNextOnMeshPrefix(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE);
+
+        if (found)
+        {
+            aPrefix.mPrefix.mPrefix.assign(&config.mPrefix.mPrefix.mFields.m8[0],
+                                           &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
+            aPrefix.mPrefix.mLength = config.mPrefix.mLength;
+            aPrefix.mRloc16         = config.mRloc16;
+            aPrefix.mPreference     = config.mPreference;
+            aPrefix.mPreferred      = config.mPreferred;
+            aPrefix.mSlaac          = config.mSlaac;
+            aPrefix.mDhcp           = config.mDhcp;
+            aPrefix.mConfigure      = config.mConfigure;
+            aPrefix.mDefaultRoute   = config.mDefaultRoute;
+            aPrefix.mOnMesh         = config.mOnMesh;
+            aPrefix.mStable         = config.mStable;
+            aPrefix.mNdDns          = config.mNdDns;
+            aPrefix.mDp             = config.mDp;
+        }
 
-    while (otNetDataGetNextOnMeshPrefix(threadHelper->GetInstance(), &iter, &config) == OT_ERROR_NONE)
-    {
-        OnMeshPrefix prefix;
-
-        prefix.mPrefix.mPrefix = std::vector<uint8_t>(&config.mPrefix.mPrefix.mFields.m8[0],
-                                                      &config.mPrefix.mPrefix.mFields.m8[OTBR_IP6_PREFIX_SIZE]);
-        prefix.mPrefix.mLength = config.mPrefix.mLength;
-        prefix.mRloc16         = config.mRloc16;
-        prefix.mPreference     = config.mPreference;
-        prefix.mPreferred      = config.mPreferred;
-        prefix.mSlaac          = config.mSlaac;
-        prefix.mDhcp           = config.mDhcp;
-        prefix.mConfigure      = config.mConfigure;
-        prefix.mDefaultRoute   = config.mDefaultRoute;
-        prefix.mOnMesh         = config.mOnMesh;
-        prefix.mStable         = config.mStable;
-        prefix.mNdDns          = config.mNdDns;
-        prefix.mDp             = config.mDp;
-        onMeshPrefixes.push_back(prefix);
-    }
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, onMeshPrefixes) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        return found;
+    };
+
+    VerifyOrExit(DBusMessageEncodeArrayToVariant<OnMeshPrefix>(&aIter, getNext) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1214,13 +1243,13 @@ otError DBusThreadObjectRcp::GetActiveDatasetTlvsHandler(DBusMessageIter &aIter)
 {
     auto                     threadHelper = mHost.GetThreadHelper();
     otError                  error        = OT_ERROR_NONE;
-    std::vector<uint8_t>     data;
     otOperationalDatasetTlvs datasetTlvs;
 
     SuccessOrExit(error = otDatasetGetActiveTlvs(threadHelper->GetInstance(), &datasetTlvs));
-    data = std::vector<uint8_t>{std::begin(datasetTlvs.mTlvs), std::begin(datasetTlvs.mTlvs) + datasetTlvs.mLength};
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{datasetTlvs.mTlvs, datasetTlvs.mLength}) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1230,13 +1259,13 @@ otError DBusThreadObjectRcp::GetPendingDatasetTlvsHandler(DBusMessageIter &aIter
 {
     auto                     threadHelper = mHost.GetThreadHelper();
     otError                  error        = OT_ERROR_NONE;
-    std::vector<uint8_t>     data;
     otOperationalDatasetTlvs datasetTlvs;
 
     SuccessOrExit(error = otDatasetGetPendingTlvs(threadHelper->GetInstance(), &datasetTlvs));
-    data = std::vector<uint8_t>{std::begin(datasetTlvs.mTlvs), std::begin(datasetTlvs.mTlvs) + datasetTlvs.mLength};
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{datasetTlvs.mTlvs, datasetTlvs.mLength}) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1418,6 +1447,17 @@ exit:
     return error;
 }
 
+otError DBusThreadObjectRcp::GetMdnsLatencyHistogramsHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mPublisher->GetMdnsTelemetryInfo().mLatencyHistograms) ==
+                     OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetDnssdCountersHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -1477,22 +1517,50 @@ exit:
 otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API
-    otError                      error = OT_ERROR_NONE;
-    threadnetwork::TelemetryData telemetryData;
-    auto                         threadHelper = mHost.GetThreadHelper();
+    otError     error        = OT_ERROR_NONE;
+    auto        threadHelper = mHost.GetThreadHelper();
+    std::string telemetryDataBytes;
 
-    if (threadHelper->RetrieveTelemetryData(mPublisher, telemetryData) != OT_ERROR_NONE)
+    if (threadHelper->RetrieveTelemetryDataBytes(mPublisher, telemetryDataBytes) != OT_ERROR_NONE)
     {
-        otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+        otbrLogWarning("Some metrics were not populated in RetrieveTelemetryDataBytes");
     }
 
-    {
-        const std::string    telemetryDataBytes = telemetryData.SerializeAsString();
-        std::vector<uint8_t> data(telemetryDataBytes.begin(), telemetryDataBytes.end());
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, FixedArrayView<uint8_t>{
+                                                        reinterpret_cast<const uint8_t *>(telemetryDataBytes.data()),
+                                                        telemetryDataBytes.size()}) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
-        VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+#else
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+otError DBusThreadObjectRcp::GetTelemetrySectionStatsHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError                            error = OT_ERROR_NONE;
+    std::vector<TelemetrySectionStats> sectionStats;
+
+    for (const agent::TelemetryCache::SectionStats &stats : mHost.GetThreadHelper()->GetTelemetrySectionStats())
+    {
+        TelemetrySectionStats sectionStat;
+
+        sectionStat.mName            = stats.mName;
+        sectionStat.mRefreshCount    = stats.mRefreshCount;
+        sectionStat.mCacheHitCount   = stats.mCacheHitCount;
+        sectionStat.mLastDurationUs  = static_cast<uint64_t>(stats.mLastDuration.count());
+        sectionStat.mMaxDurationUs   = static_cast<uint64_t>(stats.mMaxDuration.count());
+        sectionStat.mTotalDurationUs = static_cast<uint64_t>(stats.mTotalDuration.count());
+        sectionStat.mFragmentSize    = static_cast<uint32_t>(stats.mFragmentSize);
+        sectionStats.push_back(sectionStat);
     }
 
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, sectionStats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
 exit:
     return error;
 #else
@@ -1501,6 +1569,34 @@ exit:
 #endif
 }
 
+otError DBusThreadObjectRcp::GetMainloopLatencyHandler(DBusMessageIter &aIter)
+{
+    const MainloopManager &manager = MainloopManager::GetInstance();
+    otError                error   = OT_ERROR_NONE;
+    MainloopLatency        latency;
+
+    latency.mProfilingEnabled = manager.IsProfilingEnabled();
+    latency.mStallBudgetMs    = static_cast<uint32_t>(manager.GetStallBudget().count());
+    latency.mStallCount       = manager.GetStallCount();
+    latency.mIterationLatency = manager.GetIterationLatency();
+
+    for (const MainloopManager::ProcessorStats &stats : manager.GetProcessorStats())
+    {
+        MainloopProcessorLatency processor;
+
+        processor.mName           = stats.mName;
+        processor.mStallCount     = stats.mStallCount;
+        processor.mUpdateLatency  = stats.mUpdateLatency;
+        processor.mProcessLatency = stats.mProcessLatency;
+        latency.mProcessors.push_back(processor);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, latency) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetCapabilitiesHandler(DBusMessageIter &aIter)
 {
     otError            error = OT_ERROR_NONE;
@@ -1561,6 +1657,33 @@ exit:
     }
 }
 
+void DBusThreadObjectRcp::GetPropertiesDictHandler(DBusRequest &aRequest)
+{
+    UniqueDBusMessage        reply(dbus_message_new_method_return(aRequest.GetMessage()));
+    DBusMessageIter          iter;
+    DBusMessageIter          replyIter;
+    std::vector<std::string> propertyNames;
+    otError                  error = OT_ERROR_NONE;
+
+    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
+    VerifyOrExit(DBusMessageExtract(&iter, propertyNames) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+
+    otbrLogDebug("GetPropertiesDictHandler getting %zu properties", propertyNames.size());
+    dbus_message_iter_init_append(reply.get(), &replyIter);
+    SuccessOrExit(error = EncodeProperties(replyIter, OTBR_DBUS_THREAD_INTERFACE, propertyNames));
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+    }
+    else
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusThreadObjectRcp::RegisterGetPropertyHandler(const std::string         &aInterfaceName,
                                                      const std::string         &aPropertyName,
                                                      const PropertyHandlerType &aHandler)
@@ -1757,7 +1880,7 @@ void DBusThreadObjectRcp::ActiveDatasetChangeHandler(const otOperationalDatasetT
 {
     std::vector<uint8_t> value(aDatasetTlvs.mLength);
     std::copy(aDatasetTlvs.mTlvs, aDatasetTlvs.mTlvs + aDatasetTlvs.mLength, value.begin());
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, value);
+    QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, value);
 }
 
 void DBusThreadObjectRcp::LeaveNetworkHandler(DBusRequest &aRequest)
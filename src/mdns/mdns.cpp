@@ -57,23 +57,33 @@ void Publisher::PublishService(const std::string &aHostName,
                                const TxtData     &aTxtData,
                                ResultCallback   &&aCallback)
 {
-    otbrError error;
+    otbrError            error;
+    ServiceRegistration *serviceReg = aName.empty() ? nullptr : FindServiceRegistration(aName, aType);
 
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+    // Lease refreshes from SRP clients typically carry exactly the same
+    // content, so report success right away without going through the
+    // mDNS implementation.
+    if (serviceReg != nullptr && serviceReg->IsCompleted() &&
+        !serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
+    {
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        ExitNow();
+    }
 
     error = PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
         UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, error);
     }
+
+exit:
+    return;
 }
 
 void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
 {
     otbrError error;
 
-    mHostRegistrationBeginTime[aName] = Clock::now();
-
     error = PublishHostImpl(aName, aAddresses, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
@@ -85,8 +95,6 @@ void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, Re
 {
     otbrError error;
 
-    mKeyRegistrationBeginTime[aName] = Clock::now();
-
     error = PublishKeyImpl(aName, aKeyData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
@@ -94,20 +102,37 @@ void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, Re
     }
 }
 
-void Publisher::OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode)
+void Publisher::OnServiceResolveFailed(std::string     aType,
+                                       std::string     aInstanceName,
+                                       int32_t         aErrorCode,
+                                       LatencyTracker *aLatencyTracker)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
+    UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mServiceResolution,
+                  aLatencyTracker, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
-void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
+void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode, LatencyTracker *aLatencyTracker)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
+    UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mHostResolution,
+                  aLatencyTracker, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
+void Publisher::OnServiceBrowsed(LatencyTracker &aLatencyTracker)
+{
+    VerifyOrExit(aLatencyTracker.IsRunning());
+
+    aLatencyTracker.Stop();
+    mTelemetryInfo.mLatencyHistograms.mServiceBrowse.Record(static_cast<uint32_t>(
+        std::chrono::duration_cast<Milliseconds>(Clock::now() - aLatencyTracker.GetBeginTime()).count()));
+
+exit:
+    return;
+}
+
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -204,7 +229,9 @@ uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanc
     return id;
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+void Publisher::OnServiceResolved(std::string            aType,
+                                  DiscoveredInstanceInfo aInstanceInfo,
+                                  LatencyTracker        *aLatencyTracker)
 {
     bool checkToInvoke = false;
 
@@ -212,7 +239,7 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size());
 
-    if (!aInstanceInfo.mRemoved)
+    if (!aInstanceInfo.mRemoved && otbrLogIsEnabled(OTBR_LOG_INFO))
     {
         std::string addressesString;
 
@@ -237,7 +264,8 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+    UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mServiceResolution,
+                  aLatencyTracker, OTBR_ERROR_NONE);
 
     // The `mDiscoverCallbacks` list can get updated as the callbacks
     // are invoked. We first mark `mShouldInvoke` on all non-null
@@ -281,10 +309,12 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
     instanceInfo.mNetifIndex = aNetifIndex;
     instanceInfo.mName       = aInstanceName;
 
-    OnServiceResolved(aType, instanceInfo);
+    OnServiceResolved(aType, instanceInfo, /* aLatencyTracker */ nullptr);
 }
 
-void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
+void Publisher::OnHostResolved(std::string                   aHostName,
+                               Publisher::DiscoveredHostInfo aHostInfo,
+                               LatencyTracker               *aLatencyTracker)
 {
     bool checkToInvoke = false;
 
@@ -297,7 +327,8 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
-    UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
+    UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mHostResolution,
+                  aLatencyTracker, OTBR_ERROR_NONE);
 
     // The `mDiscoverCallbacks` list can get updated as the callbacks
     // are invoked. We first mark `mShouldInvoke` on all non-null
@@ -333,13 +364,19 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
 
 Publisher::SubTypeList Publisher::SortSubTypeList(SubTypeList aSubTypeList)
 {
-    std::sort(aSubTypeList.begin(), aSubTypeList.end());
+    if (!std::is_sorted(aSubTypeList.begin(), aSubTypeList.end()))
+    {
+        std::sort(aSubTypeList.begin(), aSubTypeList.end());
+    }
     return aSubTypeList;
 }
 
 Publisher::AddressList Publisher::SortAddressList(AddressList aAddressList)
 {
-    std::sort(aAddressList.begin(), aAddressList.end());
+    if (!std::is_sorted(aAddressList.begin(), aAddressList.end()))
+    {
+        std::sort(aAddressList.begin(), aAddressList.end());
+    }
     return aAddressList;
 }
 
@@ -355,22 +392,20 @@ std::string Publisher::MakeFullName(const std::string &aName)
 
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
-    mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
+    mServiceRegistrations.Add(std::move(aServiceReg));
 }
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
-    VerifyOrExit(it != mServiceRegistrations.end());
 
     // Keep the ServiceRegistration around before calling `Complete`
     // to invoke the callback. This is for avoiding invalid access
     // to the ServiceRegistration when it's freed from the callback.
-    serviceReg = std::move(it->second);
-    mServiceRegistrations.erase(it);
+    serviceReg = mServiceRegistrations.Remove(NameKey(aName, aType));
+    VerifyOrExit(serviceReg != nullptr);
     serviceReg->Complete(aError);
 
 exit:
@@ -379,16 +414,12 @@ exit:
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
-
-    return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
+    return mServiceRegistrations.Find(NameKey(aName, aType));
 }
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aNameAndType)
 {
-    auto it = mServiceRegistrations.find(MakeFullName(aNameAndType));
-
-    return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
+    return mServiceRegistrations.Find(NameKey(aNameAndType));
 }
 
 Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const std::string &aHostName,
@@ -405,8 +436,18 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
 
     if (serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
     {
-        otbrLogInfo("Removing existing service %s.%s: outdated", aName.c_str(), aType.c_str());
-        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        if (serviceReg->IsCompleted() && serviceReg->IsTxtOnlyChange(aHostName, aSubTypeList, aPort) &&
+            UpdateServiceTxtImpl(*serviceReg, aTxtData) == OTBR_ERROR_NONE)
+        {
+            otbrLogInfo("Updated TXT data of service %s.%s in place", aName.c_str(), aType.c_str());
+            serviceReg->SetTxtData(aTxtData);
+            std::move(aCallback)(OTBR_ERROR_NONE);
+        }
+        else
+        {
+            otbrLogInfo("Removing existing service %s.%s: outdated", aName.c_str(), aType.c_str());
+            RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        }
     }
     else if (serviceReg->IsCompleted())
     {
@@ -471,22 +512,20 @@ exit:
 
 void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 {
-    mHostRegistrations.emplace(MakeFullHostName(aHostReg->mName), std::move(aHostReg));
+    mHostRegistrations.Add(std::move(aHostReg));
 }
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
-    VerifyOrExit(it != mHostRegistrations.end());
 
     // Keep the HostRegistration around before calling `Complete`
     // to invoke the callback. This is for avoiding invalid access
     // to the HostRegistration when it's freed from the callback.
-    hostReg = std::move(it->second);
-    mHostRegistrations.erase(it);
+    hostReg = mHostRegistrations.Remove(NameKey(aName));
+    VerifyOrExit(hostReg != nullptr);
     hostReg->Complete(aError);
     otbrLogInfo("Removed host %s", aName.c_str());
 
@@ -496,9 +535,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
-
-    return it != mHostRegistrations.end() ? it->second.get() : nullptr;
+    return mHostRegistrations.Find(NameKey(aName));
 }
 
 Publisher::ResultCallback Publisher::HandleDuplicateKeyRegistration(const std::string &aName,
@@ -540,22 +577,20 @@ exit:
 
 void Publisher::AddKeyRegistration(KeyRegistrationPtr &&aKeyReg)
 {
-    mKeyRegistrations.emplace(MakeFullKeyName(aKeyReg->mName), std::move(aKeyReg));
+    mKeyRegistrations.Add(std::move(aKeyReg));
 }
 
 void Publisher::RemoveKeyRegistration(const std::string &aName, otbrError aError)
 {
-    auto               it = mKeyRegistrations.find(MakeFullKeyName(aName));
     KeyRegistrationPtr keyReg;
 
     otbrLogInfo("Removing key %s", aName.c_str());
-    VerifyOrExit(it != mKeyRegistrations.end());
 
     // Keep the KeyRegistration around before calling `Complete`
     // to invoke the callback. This is for avoiding invalid access
     // to the KeyRegistration when it's freed from the callback.
-    keyReg = std::move(it->second);
-    mKeyRegistrations.erase(it);
+    keyReg = mKeyRegistrations.Remove(NameKey(aName));
+    VerifyOrExit(keyReg != nullptr);
     keyReg->Complete(aError);
     otbrLogInfo("Removed key %s", aName.c_str());
 
@@ -565,16 +600,20 @@ exit:
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName)
 {
-    auto it = mKeyRegistrations.find(MakeFullKeyName(aName));
-
-    return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
+    return mKeyRegistrations.Find(NameKey(aName));
 }
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mKeyRegistrations.find(MakeFullServiceName(aName, aType));
+    return mKeyRegistrations.Find(NameKey(aName, aType));
+}
 
-    return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
+otbrError Publisher::UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    OTBR_UNUSED_VARIABLE(aServiceReg);
+    OTBR_UNUSED_VARIABLE(aTxtData);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
 }
 
 Publisher::Registration::~Registration(void)
@@ -589,8 +628,26 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 uint16_t           aPort,
                                                 const TxtData     &aTxtData) const
 {
-    return !(mHostName == aHostName && mName == aName && mType == aType && mSubTypeList == aSubTypeList &&
-             mPort == aPort && mTxtData == aTxtData);
+    return !(mHostName == aHostName && mName == aName && mType == aType && mPort == aPort && mTxtData == aTxtData &&
+             HasSameSubTypes(aSubTypeList));
+}
+
+bool Publisher::ServiceRegistration::IsTxtOnlyChange(const std::string &aHostName,
+                                                     const SubTypeList &aSubTypeList,
+                                                     uint16_t           aPort) const
+{
+    return mPort == aPort && mHostName == aHostName && HasSameSubTypes(aSubTypeList);
+}
+
+void Publisher::ServiceRegistration::SetTxtData(const TxtData &aTxtData)
+{
+    mTxtData = aTxtData;
+}
+
+bool Publisher::ServiceRegistration::HasSameSubTypes(const SubTypeList &aSubTypeList) const
+{
+    // `mSubTypeList` is always sorted while `aSubTypeList` may be not.
+    return mSubTypeList.size() == aSubTypeList.size() && mSubTypeList == SortSubTypeList(aSubTypeList);
 }
 
 void Publisher::ServiceRegistration::Complete(otbrError aError)
@@ -604,7 +661,9 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
-        mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
+        mPublisher->UpdateLatency(mPublisher->mTelemetryInfo.mServiceRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mLatencyHistograms.mServiceRegistration, mBeginTime,
+                                  aError);
     }
 }
 
@@ -624,7 +683,8 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
-        mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
+        mPublisher->UpdateLatency(mPublisher->mTelemetryInfo.mHostRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mLatencyHistograms.mHostRegistration, mBeginTime, aError);
     }
 }
 
@@ -644,7 +704,8 @@ void Publisher::KeyRegistration::OnComplete(otbrError aError)
     if (!IsCompleted())
     {
         mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mKeyRegistrations, aError);
-        mPublisher->UpdateKeyRegistrationEmaLatency(mName, aError);
+        mPublisher->UpdateLatency(mPublisher->mTelemetryInfo.mKeyRegistrationEmaLatency,
+                                  mPublisher->mTelemetryInfo.mLatencyHistograms.mKeyRegistration, mBeginTime, aError);
     }
 }
 
@@ -700,68 +761,38 @@ exit:
     return;
 }
 
-void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                                    const std::string &aType,
-                                                    otbrError          aError)
-{
-    auto it = mServiceRegistrationBeginTime.find(std::make_pair(aInstanceName, aType));
-
-    if (it != mServiceRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
-        mServiceRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError)
+void Publisher::UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError)
 {
-    auto it = mHostRegistrationBeginTime.find(aHostName);
+    uint32_t latency;
 
-    if (it != mHostRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
-        mHostRegistrationBeginTime.erase(it);
-    }
-}
+    // Aborted requests don't reflect the responsiveness of the mDNS
+    // implementation. `UpdateEmaLatency()` has always skipped them, and
+    // the histograms skip them as well.
+    VerifyOrExit(aError != OTBR_ERROR_ABORTED);
 
-void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError)
-{
-    auto it = mKeyRegistrationBeginTime.find(aKeyName);
+    latency = static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(Clock::now() - aBeginTime).count());
+    UpdateEmaLatency(aEmaLatency, latency, aError);
+    aHistogram.Record(latency);
 
-    if (it != mKeyRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
-        mKeyRegistrationBeginTime.erase(it);
-    }
+exit:
+    return;
 }
 
-void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                          const std::string &aType,
-                                                          otbrError          aError)
+void Publisher::UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              LatencyTracker   *aLatencyTracker,
+                              otbrError         aError)
 {
-    auto it = mServiceInstanceResolutionBeginTime.find(std::make_pair(aInstanceName, aType));
+    VerifyOrExit(aLatencyTracker != nullptr && aLatencyTracker->IsRunning());
 
-    if (it != mServiceInstanceResolutionBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
-        mServiceInstanceResolutionBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError)
-{
-    auto it = mHostResolutionBeginTime.find(aHostName);
+    aLatencyTracker->Stop();
+    UpdateLatency(aEmaLatency, aHistogram, aLatencyTracker->GetBeginTime(), aError);
 
-    if (it != mHostResolutionBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
-        mHostResolutionBeginTime.erase(it);
-    }
+exit:
+    return;
 }
 
 void Publisher::AddAddress(AddressList &aAddressList, const Ip6Address &aAddress)
@@ -40,6 +40,13 @@
 #define OTBR_ENABLE_MDNS (OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD)
 #endif
 
+/**
+ * The default maximum number of service instance resolutions in flight per service subscription, 0 for no limit.
+ */
+#ifndef OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS
+#define OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS 16
+#endif
+
 #include <functional>
 #include <list>
 #include <map>
@@ -53,6 +60,8 @@
 #include "common/code_utils.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
+#include "mdns/registration_table.hpp"
+#include "mdns/resolution_queue.hpp"
 
 namespace otbr {
 
@@ -352,6 +361,26 @@ public:
      */
     void RemoveSubscriptionCallbacks(uint64_t aSubscriberId);
 
+    /**
+     * This method sets the maximum number of service instance resolutions in flight per service subscription.
+     *
+     * Instances discovered by browsing a service are resolved concurrently up to this limit, the others are resolved
+     * as earlier resolutions finish. The limit applies to subscriptions made after this call.
+     *
+     * @param[in] aMaxConcurrentResolutions  The maximum number of resolutions in flight, 0 for no limit.
+     */
+    void SetMaxConcurrentResolutions(uint16_t aMaxConcurrentResolutions)
+    {
+        mMaxConcurrentResolutions = aMaxConcurrentResolutions;
+    }
+
+    /**
+     * This method returns the maximum number of service instance resolutions in flight per service subscription.
+     *
+     * @returns The maximum number of resolutions in flight, 0 for no limit.
+     */
+    uint16_t GetMaxConcurrentResolutions(void) const { return mMaxConcurrentResolutions; }
+
     /**
      * This method returns the mDNS statistics information of the publisher.
      *
@@ -359,6 +388,13 @@ public:
      */
     const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const { return mTelemetryInfo; }
 
+    /**
+     * This method returns the name of the mDNS implementation behind this publisher.
+     *
+     * @returns The name of the mDNS implementation, e.g. "avahi".
+     */
+    virtual const char *GetBackendName(void) const = 0;
+
     virtual ~Publisher(void) = default;
 
     /**
@@ -419,10 +455,12 @@ protected:
     public:
         ResultCallback mCallback;
         Publisher     *mPublisher;
+        Timepoint      mBeginTime;
 
         Registration(ResultCallback &&aCallback, Publisher *aPublisher)
             : mCallback(std::move(aCallback))
             , mPublisher(aPublisher)
+            , mBeginTime(Clock::now())
         {
         }
         virtual ~Registration(void);
@@ -442,6 +480,27 @@ protected:
         }
     };
 
+    // Tracks the begin time of an mDNS query, so that the latency of
+    // the query is only recorded for its first result.
+    class LatencyTracker
+    {
+    public:
+        void Start(void)
+        {
+            mBeginTime = Clock::now();
+            mIsRunning = true;
+        }
+
+        void Stop(void) { mIsRunning = false; }
+
+        bool      IsRunning(void) const { return mIsRunning; }
+        Timepoint GetBeginTime(void) const { return mBeginTime; }
+
+    private:
+        Timepoint mBeginTime;
+        bool      mIsRunning = false;
+    };
+
     // TODO: We may need a registration ID to fetch the information of a registration.
     class ServiceRegistration : public Registration
     {
@@ -472,9 +531,12 @@ protected:
         }
         ~ServiceRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
 
+        NameKey GetNameKey(void) const { return NameKey(mName, mType); }
+
         void Complete(otbrError aError);
 
         // Tells whether this `ServiceRegistration` object is outdated comparing to the given parameters.
+        // The order of @p aSubTypeList doesn't matter.
         bool IsOutdated(const std::string &aHostName,
                         const std::string &aName,
                         const std::string &aType,
@@ -482,8 +544,15 @@ protected:
                         uint16_t           aPort,
                         const TxtData     &aTxtData) const;
 
+        // Tells whether the given parameters differ from this `ServiceRegistration` only in the TXT data.
+        bool IsTxtOnlyChange(const std::string &aHostName, const SubTypeList &aSubTypeList, uint16_t aPort) const;
+
+        // Replaces the TXT data after it has been updated in place by the mDNS implementation.
+        void SetTxtData(const TxtData &aTxtData);
+
     private:
         void OnComplete(otbrError aError);
+        bool HasSameSubTypes(const SubTypeList &aSubTypeList) const;
     };
 
     class HostRegistration : public Registration
@@ -501,6 +570,8 @@ protected:
 
         ~HostRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
 
+        NameKey GetNameKey(void) const { return NameKey(mName); }
+
         void Complete(otbrError aError);
 
         // Tells whether this `HostRegistration` object is outdated comparing to the given parameters.
@@ -525,6 +596,8 @@ protected:
 
         ~KeyRegistration(void) { OnComplete(OTBR_ERROR_ABORTED); }
 
+        NameKey GetNameKey(void) const { return NameKey(mName); }
+
         void Complete(otbrError aError);
 
         // Tells whether this `KeyRegistration` object is outdated comparing to the given parameters.
@@ -534,12 +607,14 @@ protected:
         void OnComplete(otbrError aError);
     };
 
+    // The registrations are keyed by their names without the ".local" domain,
+    // i.e. "<instance>.<service type>" for services and "<name>" for hosts and keys.
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = RegistrationTable<ServiceRegistration>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = RegistrationTable<HostRegistration>;
     using KeyRegistrationPtr     = std::unique_ptr<KeyRegistration>;
-    using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
+    using KeyRegistrationMap     = RegistrationTable<KeyRegistration>;
 
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
@@ -562,6 +637,22 @@ protected:
 
     virtual otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) = 0;
 
+    /**
+     * This method updates the TXT record of an already registered service in place.
+     *
+     * mDNS implementations which can replace the TXT record without unregistering the service should override
+     * this method. The default implementation returns `OTBR_ERROR_NOT_IMPLEMENTED`, in which case the service is
+     * unpublished and published again.
+     *
+     * @param[in] aServiceReg  The completed service registration to update.
+     * @param[in] aTxtData     The new TXT data.
+     *
+     * @retval OTBR_ERROR_NONE             Successfully updated the TXT record.
+     * @retval OTBR_ERROR_NOT_IMPLEMENTED  In-place TXT update is not supported.
+     * @retval ...                         Failed to update the TXT record.
+     */
+    virtual otbrError UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData);
+
     virtual void OnServiceResolveFailedImpl(const std::string &aType,
                                             const std::string &aInstanceName,
                                             int32_t            aErrorCode) = 0;
@@ -575,11 +666,19 @@ protected:
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     ServiceRegistration *FindServiceRegistration(const std::string &aNameAndType);
 
-    void OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo);
-    void OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode);
+    // The `aLatencyTracker` is the tracker of the query which produced
+    // the result, it can be `nullptr` if the latency shouldn't be recorded.
+    void OnServiceResolved(std::string            aType,
+                           DiscoveredInstanceInfo aInstanceInfo,
+                           LatencyTracker        *aLatencyTracker);
+    void OnServiceResolveFailed(std::string     aType,
+                                std::string     aInstanceName,
+                                int32_t         aErrorCode,
+                                LatencyTracker *aLatencyTracker);
     void OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName);
-    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
-    void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
+    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo, LatencyTracker *aLatencyTracker);
+    void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode, LatencyTracker *aLatencyTracker);
+    void OnServiceBrowsed(LatencyTracker &aLatencyTracker);
 
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
@@ -611,16 +710,14 @@ protected:
 
     static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
-
-    void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                             const std::string &aType,
-                                             otbrError          aError);
-    void UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError);
-    void UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError);
-    void UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                   const std::string &aType,
-                                                   otbrError          aError);
-    void UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError);
+    static void UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError);
+    static void UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              LatencyTracker   *aLatencyTracker,
+                              otbrError         aError);
 
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
@@ -647,21 +744,11 @@ protected:
         bool                              mShouldInvoke;
     };
 
-    uint64_t mNextSubscriberId = 1;
+    uint64_t mNextSubscriberId        = 1;
+    uint16_t mMaxConcurrentResolutions = OTBR_MDNS_MAX_CONCURRENT_RESOLUTIONS;
 
     std::list<DiscoverCallback> mDiscoverCallbacks;
 
-    // {instance name, service type} -> the timepoint to begin service registration
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
-    // host name -> the timepoint to begin host registration
-    std::map<std::string, Timepoint> mHostRegistrationBeginTime;
-    // key name -> the timepoint to begin key registration
-    std::map<std::string, Timepoint> mKeyRegistrationBeginTime;
-    // {instance name, service type} -> the timepoint to begin service resolution
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceInstanceResolutionBeginTime;
-    // host name -> the timepoint to begin host resolution
-    std::map<std::string, Timepoint> mHostResolutionBeginTime;
-
     MdnsTelemetryInfo mTelemetryInfo{};
 };
 
@@ -52,6 +52,7 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/time.hpp"
+#include "mdns/timeout_heap.hpp"
 
 namespace otbr {
 namespace Mdns {
@@ -65,13 +66,12 @@ struct AvahiWatch
 {
     typedef otbr::Mdns::AvahiPoller AvahiPoller;
 
-    int                mFd;           ///< The file descriptor to watch.
-    AvahiWatchEvent    mEvents;       ///< The interested events.
-    int                mHappened;     ///< The events happened.
-    AvahiWatchCallback mCallback;     ///< The function to be called to report events happened on `mFd`.
-    void              *mContext;      ///< A pointer to application-specific context to use with `mCallback`.
-    bool               mShouldReport; ///< Whether or not we need to report events (invoking callback).
-    AvahiPoller       &mPoller;       ///< The poller owning this watch.
+    int                mFd;       ///< The file descriptor to watch.
+    AvahiWatchEvent    mEvents;   ///< The interested events.
+    int                mHappened; ///< The events happened.
+    AvahiWatchCallback mCallback; ///< The function to be called to report events happened on `mFd`.
+    void              *mContext;  ///< A pointer to application-specific context to use with `mCallback`.
+    AvahiPoller       &mPoller;   ///< The poller owning this watch.
 
     /**
      * The constructor to initialize an Avahi watch.
@@ -85,9 +85,9 @@ struct AvahiWatch
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, AvahiPoller &aPoller)
         : mFd(aFd)
         , mEvents(aEvents)
+        , mHappened(0)
         , mCallback(aCallback)
         , mContext(aContext)
-        , mShouldReport(false)
         , mPoller(aPoller)
     {
     }
@@ -100,34 +100,27 @@ struct AvahiTimeout
 {
     typedef otbr::Mdns::AvahiPoller AvahiPoller;
 
-    otbr::Timepoint      mTimeout;      ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback;     ///< The function to be called when timeout.
-    void                *mContext;      ///< The pointer to application-specific context.
-    bool                 mShouldReport; ///< Whether or not timeout occurred and need to reported (invoking callback).
-    AvahiPoller         &mPoller;       ///< The poller created this timer.
+    otbr::Timepoint      mTimeout;   ///< Absolute time when this timer timeout.
+    AvahiTimeoutCallback mCallback;  ///< The function to be called when timeout.
+    void                *mContext;   ///< The pointer to application-specific context.
+    AvahiPoller         &mPoller;    ///< The poller created this timer.
+    size_t               mHeapIndex; ///< The position in the timeout heap of the poller, only valid when armed.
 
     /**
      * The constructor to initialize an AvahiTimeout.
      *
-     * @param[in] aTimeout   A pointer to the time after which the callback should be called.
+     * The timeout is not armed until it's added to the timeout heap of the poller.
+     *
      * @param[in] aCallback  The function to be called after timeout.
      * @param[in] aContext   A pointer to application-specific context.
      * @param[in] aPoller    The AvahiPoller this timeout belongs to.
      */
-    AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
+    AvahiTimeout(AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
         : mCallback(aCallback)
         , mContext(aContext)
-        , mShouldReport(false)
         , mPoller(aPoller)
+        , mHeapIndex(otbr::Mdns::TimeoutHeap<AvahiTimeout>::kNotInHeap)
     {
-        if (aTimeout)
-        {
-            mTimeout = otbr::Clock::now() + otbr::FromTimeval<otbr::Microseconds>(*aTimeout);
-        }
-        else
-        {
-            mTimeout = otbr::Timepoint::min();
-        }
     }
 };
 
@@ -186,6 +179,7 @@ public:
 private:
     typedef std::vector<AvahiWatch *>   Watches;
     typedef std::vector<AvahiTimeout *> Timers;
+    typedef TimeoutHeap<AvahiTimeout>   TimerHeap;
 
     static AvahiWatch     *WatchNew(const struct AvahiPoll *aPoll,
                                     int                     aFd,
@@ -207,7 +201,9 @@ private:
     void                   TimeoutFree(AvahiTimeout &aTimer);
 
     Watches   mWatches;
-    Timers    mTimers;
+    Watches   mReadyWatches;
+    TimerHeap mTimerHeap;
+    Timers    mDueTimers;
     AvahiPoll mAvahiPoll;
 };
 
@@ -264,6 +260,7 @@ void AvahiPoller::WatchFree(AvahiWatch &aWatch)
         if (*it == &aWatch)
         {
             mWatches.erase(it);
+            std::replace(mReadyWatches.begin(), mReadyWatches.end(), &aWatch, static_cast<AvahiWatch *>(nullptr));
             delete &aWatch;
             break;
         }
@@ -281,19 +278,30 @@ AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, *this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aCallback, aContext, *this);
+
+    TimeoutUpdate(timer, aTimeout);
+
+    return timer;
 }
 
 void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
+    AvahiPoller &poller    = aTimer->mPoller;
+    TimerHeap   &timerHeap = poller.mTimerHeap;
+
+    // A due timeout which is disarmed or re-armed by an earlier callback
+    // of the same `Process()` must not fire anymore.
+    std::replace(poller.mDueTimers.begin(), poller.mDueTimers.end(), aTimer, static_cast<AvahiTimeout *>(nullptr));
+
     if (aTimeout == nullptr)
     {
-        aTimer->mTimeout = Timepoint::min();
+        timerHeap.Remove(*aTimer);
     }
     else
     {
         aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        timerHeap.Update(*aTimer);
     }
 }
 
@@ -304,21 +312,13 @@ void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
 
 void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
-    {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
-    }
+    mTimerHeap.Remove(aTimer);
+    std::replace(mDueTimers.begin(), mDueTimers.end(), &aTimer, static_cast<AvahiTimeout *>(nullptr));
+    delete &aTimer;
 }
 
 void AvahiPoller::Update(MainloopContext &aMainloop)
 {
-    Timepoint now = Clock::now();
-
     for (AvahiWatch *watch : mWatches)
     {
         int             fd     = watch->mFd;
@@ -349,19 +349,16 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
         watch->mHappened = 0;
     }
 
-    for (AvahiTimeout *timer : mTimers)
+    // Only armed timeouts are kept in the heap, so the earliest one
+    // determines the mainloop timeout.
+    if (!mTimerHeap.IsEmpty())
     {
-        Timepoint timeout = timer->mTimeout;
-
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
+        Timepoint now     = Clock::now();
+        Timepoint timeout = mTimerHeap.GetTop()->mTimeout;
 
         if (timeout <= now)
         {
             aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
         }
         else
         {
@@ -377,8 +374,7 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
 
 void AvahiPoller::Process(const MainloopContext &aMainloop)
 {
-    Timepoint now          = Clock::now();
-    bool      shouldReport = false;
+    Timepoint now = Clock::now();
 
     for (AvahiWatch *watch : mWatches)
     {
@@ -404,66 +400,48 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
 
         if (watch->mHappened != 0)
         {
-            watch->mShouldReport = true;
-            shouldReport         = true;
+            mReadyWatches.push_back(watch);
         }
     }
 
     // When we invoke the callback for an `AvahiWatch` or `AvahiTimeout`,
     // the Avahi module can call any of `mAvahiPoll` APIs we provided to
     // it. For example, it can update or free any of `AvahiWatch/Timeout`
-    // entries, which in turn, modifies our `mWatches` or `mTimers` list.
-    // So, before invoking the callback, we update the entry's state and
-    // then restart the iteration over the `mWacthes` list to find the
-    // next entry to report, as the list may have changed.
+    // entries. Freed entries are cleared from `mReadyWatches` and
+    // `mDueTimers`, so only the entries which are still alive are
+    // reported, each one exactly once.
 
-    while (shouldReport)
+    for (size_t i = 0; i < mReadyWatches.size(); i++)
     {
-        shouldReport = false;
+        AvahiWatch *watch = mReadyWatches[i];
 
-        for (AvahiWatch *watch : mWatches)
+        if (watch != nullptr)
         {
-            if (watch->mShouldReport)
-            {
-                shouldReport         = true;
-                watch->mShouldReport = false;
-                watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
-
-                break;
-            }
+            watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
         }
     }
+    mReadyWatches.clear();
 
-    for (AvahiTimeout *timer : mTimers)
+    // Due timeouts are disarmed before they are reported, as Avahi
+    // expects a timeout to fire only once unless it's updated again.
+    while (!mTimerHeap.IsEmpty() && mTimerHeap.GetTop()->mTimeout <= now)
     {
-        if (timer->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
+        AvahiTimeout *timer = mTimerHeap.GetTop();
 
-        if (timer->mTimeout <= now)
-        {
-            timer->mShouldReport = true;
-            shouldReport         = true;
-        }
+        mTimerHeap.Remove(*timer);
+        mDueTimers.push_back(timer);
     }
 
-    while (shouldReport)
+    for (size_t i = 0; i < mDueTimers.size(); i++)
     {
-        shouldReport = false;
+        AvahiTimeout *timer = mDueTimers[i];
 
-        for (AvahiTimeout *timer : mTimers)
+        if (timer != nullptr)
         {
-            if (timer->mShouldReport)
-            {
-                shouldReport         = true;
-                timer->mShouldReport = false;
-                timer->mCallback(timer, timer->mContext);
-
-                break;
-            }
+            timer->mCallback(timer, timer->mContext);
         }
     }
+    mDueTimers.clear();
 }
 
 PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
@@ -770,6 +748,33 @@ exit:
     return error;
 }
 
+otbrError PublisherAvahi::UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    otbrError        error      = OTBR_ERROR_NONE;
+    int              avahiError = AVAHI_OK;
+    AvahiEntryGroup *group      = static_cast<AvahiServiceRegistration &>(aServiceReg).GetEntryGroup();
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+
+    avahiError = avahi_entry_group_update_service_txt_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                             AvahiPublishFlags{}, aServiceReg.mName.c_str(),
+                                                             aServiceReg.mType.c_str(), /* domain */ nullptr, txtHead);
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogWarning("Failed to update TXT record of service %s.%s: %s", aServiceReg.mName.c_str(),
+                       aServiceReg.mType.c_str(), avahi_strerror(avahiError));
+        error = OTBR_ERROR_MDNS;
+    }
+
+exit:
+    return error;
+}
+
 void PublisherAvahi::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -956,12 +961,12 @@ Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const Av
 {
     ServiceRegistration *result = nullptr;
 
-    for (const auto &kv : mServiceRegistrations)
+    for (const auto &entry : mServiceRegistrations)
     {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
+        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*entry);
         if (serviceReg.GetEntryGroup() == aEntryGroup)
         {
-            result = kv.second.get();
+            result = entry.get();
             break;
         }
     }
@@ -973,12 +978,12 @@ Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEnt
 {
     HostRegistration *result = nullptr;
 
-    for (const auto &kv : mHostRegistrations)
+    for (const auto &entry : mHostRegistrations)
     {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
+        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*entry);
         if (hostReg.GetEntryGroup() == aEntryGroup)
         {
-            result = kv.second.get();
+            result = entry.get();
             break;
         }
     }
@@ -992,10 +997,10 @@ Publisher::KeyRegistration *PublisherAvahi::FindKeyRegistration(const AvahiEntry
 
     for (const auto &entry : mKeyRegistrations)
     {
-        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry.second);
+        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry);
         if (keyReg.GetEntryGroup() == aEntryGroup)
         {
-            result = entry.second.get();
+            result = entry.get();
             break;
         }
     }
@@ -1125,6 +1130,7 @@ void PublisherAvahi::ServiceSubscription::Browse(void)
     assert(mPublisherAvahi->mClient != nullptr);
 
     otbrLogInfo("Browse service %s", mType.c_str());
+    mBrowseLatencyTracker.Start();
     mServiceBrowser =
         avahi_service_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, mType.c_str(),
                                   /* domain */ nullptr, static_cast<AvahiLookupFlags>(0), HandleBrowseResult, this);
@@ -1139,6 +1145,10 @@ void PublisherAvahi::ServiceSubscription::Release(void)
 {
     std::vector<std::string> instanceNames;
 
+    // Forget the queued resolutions first so that removing the
+    // resolvers below doesn't start them.
+    mResolutionQueue.Clear();
+
     for (const auto &resolvers : mServiceResolvers)
     {
         instanceNames.push_back(resolvers.first);
@@ -1190,6 +1200,7 @@ void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser
     switch (aEvent)
     {
     case AVAHI_BROWSER_NEW:
+        mPublisherAvahi->OnServiceBrowsed(mBrowseLatencyTracker);
         Resolve(aInterfaceIndex, aProtocol, aName, aType);
         break;
     case AVAHI_BROWSER_REMOVE:
@@ -1201,7 +1212,8 @@ void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser
         // do nothing
         break;
     case AVAHI_BROWSER_FAILURE:
-        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahi_client_errno(mPublisherAvahi->mClient));
+        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahi_client_errno(mPublisherAvahi->mClient),
+                                                /* aLatencyTracker */ nullptr);
         break;
     }
 }
@@ -1211,14 +1223,32 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceI
                                                   const std::string &aInstanceName,
                                                   const std::string &aType)
 {
-    auto serviceResolver = MakeUnique<ServiceResolver>();
+    // The latency is measured from discovery, so it includes the time
+    // spent in the queue.
+    LatencyTracker latencyTracker;
 
-    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
+    latencyTracker.Start();
+    mResolutionQueue.Add(aInstanceName, [this, aInterfaceIndex, aProtocol, aInstanceName, aType, latencyTracker]() {
+        StartResolver(aInterfaceIndex, aProtocol, aInstanceName, aType, latencyTracker);
+    });
+}
 
-    otbrLogInfo("Resolve service %s.%s inf %" PRIu32, aInstanceName.c_str(), aType.c_str(), aInterfaceIndex);
+void PublisherAvahi::ServiceSubscription::StartResolver(uint32_t              aInterfaceIndex,
+                                                        AvahiProtocol         aProtocol,
+                                                        const std::string    &aInstanceName,
+                                                        const std::string    &aType,
+                                                        const LatencyTracker &aLatencyTracker)
+{
+    auto serviceResolver = MakeUnique<ServiceResolver>();
+
+    otbrLogInfo("Resolve service %s.%s inf %" PRIu32 " (%u in flight, %zu queued)", aInstanceName.c_str(),
+                aType.c_str(), aInterfaceIndex, mResolutionQueue.GetInFlightCount(),
+                mResolutionQueue.GetPendingCount());
 
     serviceResolver->mType            = aType;
     serviceResolver->mPublisherAvahi  = this->mPublisherAvahi;
+    serviceResolver->mSubscription    = this;
+    serviceResolver->mLatencyTracker  = aLatencyTracker;
     serviceResolver->mServiceResolver = avahi_service_resolver_new(
         mPublisherAvahi->mClient, aInterfaceIndex, aProtocol, aInstanceName.c_str(), aType.c_str(),
         /* domain */ nullptr, AVAHI_PROTO_UNSPEC, static_cast<AvahiLookupFlags>(AVAHI_LOOKUP_NO_ADDRESS),
@@ -1232,6 +1262,7 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceI
     {
         otbrLogErr("Failed to resolve serivce %s: %s", mType.c_str(),
                    avahi_strerror(avahi_client_errno(mPublisherAvahi->mClient)));
+        mResolutionQueue.Finish();
     }
 }
 
@@ -1333,7 +1364,8 @@ exit:
     }
     if (!resolved && avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahiError);
+        FinishResolution();
+        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahiError, &mLatencyTracker);
     }
 }
 
@@ -1367,7 +1399,6 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
     OTBR_UNUSED_VARIABLE(aRecordBrowser);
     OTBR_UNUSED_VARIABLE(aInterfaceIndex);
     OTBR_UNUSED_VARIABLE(aProtocol);
-    OTBR_UNUSED_VARIABLE(aEvent);
     OTBR_UNUSED_VARIABLE(aClazz);
     OTBR_UNUSED_VARIABLE(aType);
     OTBR_UNUSED_VARIABLE(aFlags);
@@ -1381,6 +1412,7 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
             aName, aInterfaceIndex, aProtocol, aClazz, aType, aSize, static_cast<int>(aFlags),
             static_cast<int>(aEvent));
 
+    VerifyOrExit(aEvent != AVAHI_BROWSER_FAILURE, avahiError = avahi_client_errno(mPublisherAvahi->mClient));
     VerifyOrExit(aEvent == AVAHI_BROWSER_NEW || aEvent == AVAHI_BROWSER_REMOVE);
     VerifyOrExit(aSize == OTBR_IP6_ADDRESS_SIZE || aSize == OTBR_IP4_ADDRESS_SIZE,
                  otbrLogErr("Unexpected address data length: %zu", aSize), avahiError = AVAHI_ERR_INVALID_ADDRESS);
@@ -1403,14 +1435,36 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
     resolved = true;
 
 exit:
+    // Ignored addresses don't finish the resolution, the host may still
+    // have a routable address. Once all the addresses known for now are
+    // reported, the host has none and the resolution finishes anyway so
+    // that it doesn't hold its slot of the resolution queue.
+    if (resolved || aEvent == AVAHI_BROWSER_ALL_FOR_NOW ||
+        (avahiError != AVAHI_OK && avahiError != AVAHI_ERR_INVALID_ADDRESS))
+    {
+        FinishResolution();
+    }
+
     if (resolved)
     {
         // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
-        mPublisherAvahi->OnServiceResolved(mType, mInstanceInfo);
+        mPublisherAvahi->OnServiceResolved(mType, mInstanceInfo, &mLatencyTracker);
     }
     else if (avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceInfo.mName, avahiError);
+        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceInfo.mName, avahiError, &mLatencyTracker);
+    }
+}
+
+void PublisherAvahi::ServiceResolver::FinishResolution(void)
+{
+    // Lets the subscription start the next queued resolution. This is
+    // done before reporting the result since the resolver may be freed
+    // by the callbacks.
+    if (mIsInFlight)
+    {
+        mIsInFlight = false;
+        mSubscription->mResolutionQueue.Finish();
     }
 }
 
@@ -1427,12 +1481,15 @@ void PublisherAvahi::ServiceSubscription::RemoveServiceResolver(const std::strin
 {
     int numResolvers = 0;
 
+    mResolutionQueue.Cancel(aInstanceName);
+
     VerifyOrExit(mServiceResolvers.find(aInstanceName) != mServiceResolvers.end());
 
     numResolvers = mServiceResolvers[aInstanceName].size();
 
     for (auto resolver : mServiceResolvers[aInstanceName])
     {
+        resolver->FinishResolution();
         delete resolver;
     }
 
@@ -1456,7 +1513,7 @@ void PublisherAvahi::HostSubscription::Resolve(void)
 {
     std::string fullHostName = MakeFullHostName(mHostName);
 
-    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = Clock::now();
+    mLatencyTracker.Start();
 
     otbrLogInfo("Resolve host %s inf %d", fullHostName.c_str(), static_cast<int>(AVAHI_IF_UNSPEC));
     mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
@@ -1512,6 +1569,7 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
             aName, aInterfaceIndex, aProtocol, aClazz, aType, aSize, static_cast<int>(aFlags),
             static_cast<int>(aEvent));
 
+    VerifyOrExit(aEvent != AVAHI_BROWSER_FAILURE, avahiError = avahi_client_errno(mPublisherAvahi->mClient));
     VerifyOrExit(aEvent == AVAHI_BROWSER_NEW || aEvent == AVAHI_BROWSER_REMOVE);
     VerifyOrExit(aSize == OTBR_IP6_ADDRESS_SIZE || aSize == OTBR_IP4_ADDRESS_SIZE,
                  otbrLogErr("Unexpected address data length: %zu", aSize), avahiError = AVAHI_ERR_INVALID_ADDRESS);
@@ -1542,11 +1600,11 @@ exit:
     if (resolved)
     {
         // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
-        mPublisherAvahi->OnHostResolved(mHostName, mHostInfo);
+        mPublisherAvahi->OnHostResolved(mHostName, mHostInfo, &mLatencyTracker);
     }
     else if (avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnHostResolveFailed(mHostName, avahiError);
+        mPublisherAvahi->OnHostResolveFailed(mHostName, avahiError, &mLatencyTracker);
     }
 }
 
@@ -86,6 +86,8 @@ public:
     bool      IsStarted(void) const override;
     void      Stop(void) override;
 
+    const char *GetBackendName(void) const override { return "avahi"; }
+
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
                                  const std::string &aName,
@@ -98,6 +100,7 @@ protected:
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    otbrError UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
@@ -135,6 +138,7 @@ private:
 
         ~AvahiServiceRegistration(void) override;
         const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        AvahiEntryGroup       *GetEntryGroup(void) { return mEntryGroup; }
 
     private:
         AvahiEntryGroup *mEntryGroup;
@@ -229,8 +233,11 @@ private:
         std::string         mHostName;
         DiscoveredHostInfo  mHostInfo;
         AvahiRecordBrowser *mRecordBrowser;
+        LatencyTracker      mLatencyTracker;
     };
 
+    struct ServiceSubscription;
+
     struct ServiceResolver
     {
         ~ServiceResolver()
@@ -295,12 +302,18 @@ private:
                                      size_t                 aSize,
                                      AvahiLookupResultFlags aFlags);
 
+        void FinishResolution(void);
+
         std::string            mType;
         PublisherAvahi        *mPublisherAvahi;
+        ServiceSubscription   *mSubscription;
         AvahiServiceResolver  *mServiceResolver = nullptr;
         AvahiRecordBrowser    *mRecordBrowser   = nullptr;
+        bool                   mIsInFlight      = true;
         DiscoveredInstanceInfo mInstanceInfo;
+        LatencyTracker         mLatencyTracker;
     };
+
     struct ServiceSubscription : public Subscription
     {
         explicit ServiceSubscription(PublisherAvahi &aPublisherAvahi, std::string aType, std::string aInstanceName)
@@ -308,6 +321,7 @@ private:
             , mType(std::move(aType))
             , mInstanceName(std::move(aInstanceName))
             , mServiceBrowser(nullptr)
+            , mResolutionQueue(aPublisherAvahi.GetMaxConcurrentResolutions())
         {
         }
 
@@ -319,6 +333,11 @@ private:
                      AvahiProtocol      aProtocol,
                      const std::string &aInstanceName,
                      const std::string &aType);
+        void StartResolver(uint32_t              aInterfaceIndex,
+                           AvahiProtocol         aProtocol,
+                           const std::string    &aInstanceName,
+                           const std::string    &aType,
+                           const LatencyTracker &aLatencyTracker);
         void AddServiceResolver(const std::string &aInstanceName, ServiceResolver *aServiceResolver);
         void RemoveServiceResolver(const std::string &aInstanceName);
 
@@ -344,6 +363,8 @@ private:
         std::string          mType;
         std::string          mInstanceName;
         AvahiServiceBrowser *mServiceBrowser;
+        LatencyTracker       mBrowseLatencyTracker;
+        ResolutionQueue      mResolutionQueue;
 
         using ServiceResolversMap = std::map<std::string, std::set<ServiceResolver *>>;
         ServiceResolversMap mServiceResolvers;
@@ -237,6 +237,18 @@ bool PublisherMDnsSd::IsStarted(void) const
     return mState == State::kReady;
 }
 
+size_t PublisherMDnsSd::GetServiceResolutionCount(void) const
+{
+    size_t count = 0;
+
+    for (const auto &service : mSubscribedServices)
+    {
+        count += service->mResolvingInstances.size();
+    }
+
+    return count;
+}
+
 void PublisherMDnsSd::Stop(StopMode aStopMode)
 {
     VerifyOrExit(mState == State::kReady);
@@ -299,9 +311,9 @@ exit:
 
 void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 {
-    for (auto &kv : mServiceRegistrations)
+    for (auto &entry : mServiceRegistrations)
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
+        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*entry);
 
         serviceReg.Update(aMainloop);
     }
@@ -330,9 +342,9 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
 {
     mServiceRefsToProcess.clear();
 
-    for (auto &kv : mServiceRegistrations)
+    for (auto &entry : mServiceRegistrations)
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
+        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*entry);
 
         serviceReg.Process(aMainloop, mServiceRefsToProcess);
     }
@@ -487,6 +499,22 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
+otbrError PublisherMDnsSd::DnssdServiceRegistration::UpdateTxtRecord(const TxtData &aTxtData)
+{
+    DNSServiceErrorType dnsError = kDNSServiceErr_BadReference;
+
+    VerifyOrExit(mServiceRef != nullptr);
+
+    // A null `DNSRecordRef` refers to the primary TXT record of the service.
+    dnsError = DNSServiceUpdateRecord(mServiceRef, /* aRecordRef */ nullptr, /* flags */ 0, aTxtData.size(),
+                                      aTxtData.data(), /* ttl */ 0);
+
+exit:
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Update TXT record of service %s.%s: %s", mName.c_str(),
+                  mType.c_str(), DNSErrorToString(dnsError));
+    return GetPublisher().DnsErrorToOtbrError(dnsError);
+}
+
 void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
 {
     DnssdKeyRegistration *keyReg = mRelatedKeyReg;
@@ -814,6 +842,17 @@ exit:
     return error;
 }
 
+otbrError PublisherMDnsSd::UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    error = static_cast<DnssdServiceRegistration &>(aServiceReg).UpdateTxtRecord(aTxtData);
+
+exit:
+    return error;
+}
+
 void PublisherMDnsSd::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -1065,6 +1104,7 @@ void PublisherMDnsSd::ServiceSubscription::Browse(void)
     assert(mServiceRef == nullptr);
 
     otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
+    mBrowseLatencyTracker.Start();
     DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
                      /* domain */ nullptr, HandleBrowseResult, this);
 }
@@ -1101,17 +1141,19 @@ void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef
 
     if (aFlags & kDNSServiceFlagsAdd)
     {
+        mPublisher.OnServiceBrowsed(mBrowseLatencyTracker);
         Resolve(aInterfaceIndex, aInstanceName, aType, aDomain);
     }
     else
     {
+        CancelQueuedResolutions(aInstanceName);
         mPublisher.OnServiceRemoved(aInterfaceIndex, mType, aInstanceName);
     }
 
 exit:
     if (aErrorCode != kDNSServiceErr_NoError)
     {
-        mPublisher.OnServiceResolveFailed(mType, mInstanceName, aErrorCode);
+        mPublisher.OnServiceResolveFailed(mType, mInstanceName, aErrorCode, /* aLatencyTracker */ nullptr);
         Release();
     }
 }
@@ -1121,9 +1163,40 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterface
                                                    const std::string &aType,
                                                    const std::string &aDomain)
 {
+    ServiceInstanceResolution *resolution;
+
     mResolvingInstances.push_back(
         MakeUnique<ServiceInstanceResolution>(*this, aInstanceName, aType, aDomain, aInterfaceIndex));
-    mResolvingInstances.back()->Resolve();
+    resolution = mResolvingInstances.back().get();
+
+    // The latency is measured from discovery, so it includes the time
+    // spent in the queue.
+    resolution->mLatencyTracker.Start();
+    mResolutionQueue.Add(aInstanceName, [resolution]() { resolution->Resolve(); });
+}
+
+void PublisherMDnsSd::ServiceSubscription::RemoveInstanceResolution(ServiceInstanceResolution &aResolution)
+{
+    auto it = std::find_if(mResolvingInstances.begin(), mResolvingInstances.end(),
+                           [&aResolution](const std::unique_ptr<ServiceInstanceResolution> &aInstance) {
+                               return aInstance.get() == &aResolution;
+                           });
+
+    assert(it != mResolvingInstances.end());
+    mResolvingInstances.erase(it);
+}
+
+void PublisherMDnsSd::ServiceSubscription::CancelQueuedResolutions(const std::string &aInstanceName)
+{
+    // The queued resolutions have neither started nor allocated a service ref.
+    mResolutionQueue.Cancel(aInstanceName);
+    mResolvingInstances.erase(
+        std::remove_if(mResolvingInstances.begin(), mResolvingInstances.end(),
+                       [&aInstanceName](const std::unique_ptr<ServiceInstanceResolution> &aInstance) {
+                           return aInstance->mInstanceName == aInstanceName && aInstance->mServiceRef == nullptr &&
+                                  !aInstance->mIsInFlight;
+                       }),
+        mResolvingInstances.end());
 }
 
 void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
@@ -1149,13 +1222,30 @@ void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext
 
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
 
-    mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
+    otbrLogInfo("DNSServiceResolve %s %s inf %u (%u in flight, %zu queued)", mInstanceName.c_str(), mType.c_str(),
+                mNetifIndex, mSubscription->mResolutionQueue.GetInFlightCount(),
+                mSubscription->mResolutionQueue.GetPendingCount());
+    dnsError = DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
+                                 mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        mIsInFlight = true;
+    }
+    else
+    {
+        ServiceSubscription *subscription = mSubscription;
 
-    otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(dnsError));
+
+        // NOTE: This `ServiceInstanceResolution` object is freed here.
+        subscription->RemoveInstanceResolution(*this);
+        subscription->mResolutionQueue.Finish();
+    }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1215,7 +1305,8 @@ exit:
 
     if (aErrorCode != kDNSServiceErr_NoError || error != OTBR_ERROR_NONE)
     {
-        mSubscription->mPublisher.OnServiceResolveFailed(mSubscription->mType, mInstanceName, aErrorCode);
+        mSubscription->mPublisher.OnServiceResolveFailed(mSubscription->mType, mInstanceName, aErrorCode,
+                                                         &mLatencyTracker);
         FinishResolution();
     }
 }
@@ -1228,7 +1319,9 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
+    // The query times out so that the resolution finishes even if the host has no routable IPv6 address, which would
+    // otherwise hold a slot of the resolution queue forever.
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, aInterfaceIndex,
                                      kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
                                      mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
 
@@ -1269,8 +1362,9 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServ
 
     otbrLog(aErrorCode == kDNSServiceErr_NoError ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "DNSServiceGetAddrInfo reply: flags=%" PRIu32 ", host=%s, sa_family=%u, error=%" PRId32, aFlags, aHostName,
-            static_cast<unsigned int>(aAddress->sa_family), aErrorCode);
+            static_cast<unsigned int>(aAddress != nullptr ? aAddress->sa_family : AF_UNSPEC), aErrorCode);
 
+    // The address is null when the query times out.
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
     VerifyOrExit(aAddress->sa_family == AF_INET6);
 
@@ -1304,8 +1398,16 @@ void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
     std::string            serviceName  = mSubscription->mType;
     DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
 
+    // Lets the subscription start the next queued resolution before
+    // reporting the result.
+    if (mIsInFlight)
+    {
+        mIsInFlight = false;
+        subscription->mResolutionQueue.Finish();
+    }
+
     // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo, &mLatencyTracker);
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
@@ -1314,7 +1416,7 @@ void PublisherMDnsSd::HostSubscription::Resolve(void)
 
     assert(mServiceRef == nullptr);
 
-    mPublisher.mHostResolutionBeginTime[mHostName] = Clock::now();
+    mLatencyTracker.Start();
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
@@ -1351,8 +1453,9 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
 
     otbrLog(aErrorCode == kDNSServiceErr_NoError ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG,
             "DNSServiceGetAddrInfo reply: flags=%" PRIu32 ", host=%s, sa_family=%u, error=%" PRId32, aFlags, aHostName,
-            static_cast<unsigned int>(aAddress->sa_family), aErrorCode);
+            static_cast<unsigned int>(aAddress != nullptr ? aAddress->sa_family : AF_UNSPEC), aErrorCode);
 
+    // The address is null when the query times out.
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
     VerifyOrExit(aAddress->sa_family == AF_INET6);
 
@@ -1376,12 +1479,12 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
     mHostInfo.mTtl        = aTtl;
 
     // NOTE: This `HostSubscription` object may be freed in `OnHostResolved`.
-    mPublisher.OnHostResolved(mHostName, mHostInfo);
+    mPublisher.OnHostResolved(mHostName, mHostInfo, &mLatencyTracker);
 
 exit:
     if (aErrorCode != kDNSServiceErr_NoError)
     {
-        mPublisher.OnHostResolveFailed(aHostName, aErrorCode);
+        mPublisher.OnHostResolveFailed(aHostName, aErrorCode, &mLatencyTracker);
     }
 }
 
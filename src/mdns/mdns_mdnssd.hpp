@@ -78,6 +78,15 @@ public:
     bool      IsStarted(void) const override;
     void      Stop(void) override { Stop(kNormalStop); }
 
+    const char *GetBackendName(void) const override { return "mDNSResponder"; }
+
+    /**
+     * This method returns the number of service instance resolutions kept by the service subscriptions.
+     *
+     * @returns The number of service instance resolutions, started or queued.
+     */
+    size_t GetServiceResolutionCount(void) const;
+
     // Implementation of MainloopProcessor.
 
     void Update(MainloopContext &aMainloop) override;
@@ -95,6 +104,7 @@ protected:
                               const AddressList &aAddress,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    otbrError UpdateServiceTxtImpl(ServiceRegistration &aServiceReg, const TxtData &aTxtData) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
@@ -124,6 +134,7 @@ private:
         void      Update(MainloopContext &aMainloop) const;
         void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
+        otbrError UpdateTxtRecord(const TxtData &aTxtData);
 
     private:
         void             Unregister(void);
@@ -270,7 +281,9 @@ private:
         std::string            mType;
         std::string            mDomain;
         uint32_t               mNetifIndex;
+        bool                   mIsInFlight = false;
         DiscoveredInstanceInfo mInstanceInfo;
+        LatencyTracker         mLatencyTracker;
     };
 
     struct ServiceSubscription : public ServiceRef
@@ -279,6 +292,7 @@ private:
             : ServiceRef(aPublisher)
             , mType(std::move(aType))
             , mInstanceName(std::move(aInstanceName))
+            , mResolutionQueue(aPublisher.GetMaxConcurrentResolutions())
         {
         }
 
@@ -287,6 +301,8 @@ private:
                      const std::string &aInstanceName,
                      const std::string &aType,
                      const std::string &aDomain);
+        void RemoveInstanceResolution(ServiceInstanceResolution &aResolution);
+        void CancelQueuedResolutions(const std::string &aInstanceName);
         void UpdateAll(MainloopContext &aMainloop) const;
         void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
@@ -306,8 +322,10 @@ private:
                                        const char         *aType,
                                        const char         *aDomain);
 
-        std::string mType;
-        std::string mInstanceName;
+        std::string     mType;
+        std::string     mInstanceName;
+        LatencyTracker  mBrowseLatencyTracker;
+        ResolutionQueue mResolutionQueue;
 
         std::vector<std::unique_ptr<ServiceInstanceResolution>> mResolvingInstances;
     };
@@ -339,6 +357,7 @@ private:
 
         std::string        mHostName;
         DiscoveredHostInfo mHostInfo;
+        LatencyTracker     mLatencyTracker;
     };
 
     using ServiceSubscriptionList = std::vector<std::unique_ptr<ServiceSubscription>>;
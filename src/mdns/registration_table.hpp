@@ -0,0 +1,314 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the hash table of mDNS registrations.
+ */
+
+#ifndef OTBR_AGENT_MDNS_REGISTRATION_TABLE_HPP_
+#define OTBR_AGENT_MDNS_REGISTRATION_TABLE_HPP_
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+
+#include "common/open_addressing_table.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class represents a DNS name which is the concatenation of one or two strings joined with a dot, for example
+ * the instance name and the service type of a service instance.
+ *
+ * The key only refers to the strings, so building a key to look up a registration never allocates memory.
+ */
+class NameKey
+{
+public:
+    /**
+     * This constructor initializes a key with a single name.
+     *
+     * @param[in] aName  The name, it must outlive the key.
+     */
+    explicit NameKey(const std::string &aName)
+        : mFirst(&aName)
+        , mSecond(nullptr)
+    {
+    }
+
+    /**
+     * This constructor initializes a key with the name `<aName>.<aType>`.
+     *
+     * @param[in] aName  The first part of the name, it must outlive the key.
+     * @param[in] aType  The second part of the name, it must outlive the key.
+     */
+    NameKey(const std::string &aName, const std::string &aType)
+        : mFirst(&aName)
+        , mSecond(&aType)
+    {
+    }
+
+    /**
+     * This method returns the length of the name.
+     *
+     * @returns The length of the name.
+     */
+    size_t GetLength(void) const { return mFirst->size() + (mSecond != nullptr ? mSecond->size() + 1 : 0); }
+
+    /**
+     * This method returns the hash of the name.
+     *
+     * Keys of equal names have the same hash regardless of how the names are split.
+     *
+     * @returns The hash of the name.
+     */
+    uint32_t GetHash(void) const
+    {
+        uint32_t hash = kFnvOffsetBasis;
+
+        hash = Hash(hash, *mFirst);
+        if (mSecond != nullptr)
+        {
+            hash = Hash(hash, '.');
+            hash = Hash(hash, *mSecond);
+        }
+
+        return hash;
+    }
+
+    /**
+     * This method indicates whether two keys refer to the same name.
+     *
+     * @param[in] aOther  The other key.
+     *
+     * @returns Whether the two keys refer to the same name.
+     */
+    bool operator==(const NameKey &aOther) const
+    {
+        bool   isEqual = (GetLength() == aOther.GetLength());
+        size_t length  = GetLength();
+
+        if (isEqual && mFirst->size() == aOther.mFirst->size())
+        {
+            // Fast path for keys which are split at the same position.
+            isEqual = (*mFirst == *aOther.mFirst) && (mSecond == nullptr || *mSecond == *aOther.mSecond);
+        }
+        else
+        {
+            for (size_t i = 0; isEqual && i < length; i++)
+            {
+                isEqual = (CharAt(i) == aOther.CharAt(i));
+            }
+        }
+
+        return isEqual;
+    }
+
+private:
+    static constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+    static constexpr uint32_t kFnvPrime       = 16777619u;
+
+    static uint32_t Hash(uint32_t aHash, char aChar) { return (aHash ^ static_cast<uint8_t>(aChar)) * kFnvPrime; }
+
+    static uint32_t Hash(uint32_t aHash, const std::string &aString)
+    {
+        for (char c : aString)
+        {
+            aHash = Hash(aHash, c);
+        }
+
+        return aHash;
+    }
+
+    char CharAt(size_t aIndex) const
+    {
+        char c;
+
+        if (aIndex < mFirst->size())
+        {
+            c = (*mFirst)[aIndex];
+        }
+        else if (aIndex == mFirst->size())
+        {
+            c = '.';
+        }
+        else
+        {
+            c = (*mSecond)[aIndex - mFirst->size() - 1];
+        }
+
+        return c;
+    }
+
+    const std::string *mFirst;
+    const std::string *mSecond;
+};
+
+/**
+ * This class implements an open-addressing hash table of registrations which are keyed by their names.
+ *
+ * The registration type `RegistrationType` must provide a `NameKey GetNameKey(void) const` method. The key refers to
+ * the names stored in the registration, so that adding a registration doesn't copy the names and looking up a
+ * registration doesn't allocate memory.
+ */
+template <typename RegistrationType> class RegistrationTable
+{
+public:
+    using RegistrationPtr = std::unique_ptr<RegistrationType>;
+
+    /**
+     * This class implements an iterator over the registrations of the table.
+     */
+    class Iterator
+    {
+    public:
+        RegistrationPtr &operator*(void) const { return mTable->mRegistrations.GetValue(mSlot); }
+        RegistrationPtr *operator->(void) const { return &mTable->mRegistrations.GetValue(mSlot); }
+        bool             operator!=(const Iterator &aOther) const { return mSlot != aOther.mSlot; }
+
+        Iterator &operator++(void)
+        {
+            mSlot++;
+            SkipEmptySlots();
+            return *this;
+        }
+
+    private:
+        friend class RegistrationTable;
+
+        Iterator(RegistrationTable &aTable, size_t aSlot)
+            : mTable(&aTable)
+            , mSlot(aSlot)
+        {
+            SkipEmptySlots();
+        }
+
+        void SkipEmptySlots(void)
+        {
+            while (mSlot < mTable->mRegistrations.GetCapacity() && !mTable->mRegistrations.IsOccupied(mSlot))
+            {
+                mSlot++;
+            }
+        }
+
+        RegistrationTable *mTable;
+        size_t             mSlot;
+    };
+
+    /**
+     * This method returns the number of registrations in the table.
+     *
+     * @returns The number of registrations.
+     */
+    size_t size(void) const { return mRegistrations.size(); }
+
+    /**
+     * This method indicates whether the table is empty.
+     *
+     * @returns Whether the table is empty.
+     */
+    bool empty(void) const { return mRegistrations.size() == 0; }
+
+    Iterator begin(void) { return Iterator(*this, 0); }
+    Iterator end(void) { return Iterator(*this, mRegistrations.GetCapacity()); }
+
+    /**
+     * This method adds a registration to the table.
+     *
+     * The registration is dropped if there is already a registration with the same name.
+     *
+     * @param[in] aRegistration  The registration to add.
+     */
+    void Add(RegistrationPtr &&aRegistration)
+    {
+        NameKey  key  = aRegistration->GetNameKey();
+        uint32_t hash = key.GetHash();
+
+        if (FindSlot(key, hash) == Table::kNotFound)
+        {
+            mRegistrations.Insert(hash, std::move(aRegistration));
+        }
+    }
+
+    /**
+     * This method finds the registration with the given name.
+     *
+     * @param[in] aKey  The name of the registration.
+     *
+     * @returns A pointer to the registration, `nullptr` if not found.
+     */
+    RegistrationType *Find(const NameKey &aKey) const
+    {
+        size_t slot = FindSlot(aKey, aKey.GetHash());
+
+        return slot != Table::kNotFound ? mRegistrations.GetValue(slot).get() : nullptr;
+    }
+
+    /**
+     * This method removes the registration with the given name from the table.
+     *
+     * @param[in] aKey  The name of the registration.
+     *
+     * @returns The removed registration, `nullptr` if not found.
+     */
+    RegistrationPtr Remove(const NameKey &aKey)
+    {
+        size_t slot = FindSlot(aKey, aKey.GetHash());
+
+        return slot != Table::kNotFound ? mRegistrations.Remove(slot) : nullptr;
+    }
+
+    /**
+     * This method removes and frees all registrations.
+     *
+     * The table is emptied before the registrations are freed, so it's safe to access the table from the destructors
+     * of the registrations.
+     */
+    void clear(void) { mRegistrations.Clear(); }
+
+private:
+    using Table = OpenAddressingTable<RegistrationPtr>;
+
+    size_t FindSlot(const NameKey &aKey, uint32_t aHash) const
+    {
+        return mRegistrations.Find(aHash, [&aKey](const RegistrationPtr &aRegistration) {
+            return aRegistration->GetNameKey() == aKey;
+        });
+    }
+
+    Table mRegistrations;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_REGISTRATION_TABLE_HPP_
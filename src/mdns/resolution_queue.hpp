@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for limiting concurrent mDNS service instance resolutions.
+ */
+
+#ifndef OTBR_AGENT_MDNS_RESOLUTION_QUEUE_HPP_
+#define OTBR_AGENT_MDNS_RESOLUTION_QUEUE_HPP_
+
+#include <deque>
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <utility>
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class limits the number of service instance resolutions which are in flight at the same time.
+ *
+ * Resolutions are started right away while fewer than the limit are in flight, the others are queued and started in
+ * discovery order as soon as earlier resolutions finish. Every started resolution must be reported finished exactly
+ * once with `Finish()`, no matter whether it succeeded, failed or was canceled.
+ */
+class ResolutionQueue
+{
+public:
+    typedef std::function<void(void)> StartHandler; ///< Starts a resolution.
+
+    /**
+     * This constructor initializes the queue.
+     *
+     * @param[in] aMaxInFlight  The maximum number of resolutions in flight, 0 for no limit.
+     */
+    explicit ResolutionQueue(uint16_t aMaxInFlight)
+        : mMaxInFlight(aMaxInFlight)
+        , mInFlight(0)
+        , mIsStarting(false)
+    {
+    }
+
+    /**
+     * This method starts or queues the resolution of a service instance.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     * @param[in] aStartHandler  The function which starts the resolution.
+     */
+    void Add(const std::string &aInstanceName, StartHandler aStartHandler)
+    {
+        mPending.emplace_back(aInstanceName, std::move(aStartHandler));
+        StartPending();
+    }
+
+    /**
+     * This method reports a started resolution as finished and starts queued resolutions.
+     */
+    void Finish(void)
+    {
+        if (mInFlight > 0)
+        {
+            mInFlight--;
+        }
+
+        StartPending();
+    }
+
+    /**
+     * This method removes the queued resolutions of a service instance which have not started yet.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     */
+    void Cancel(const std::string &aInstanceName)
+    {
+        for (auto it = mPending.begin(); it != mPending.end();)
+        {
+            it = (it->first == aInstanceName) ? mPending.erase(it) : it + 1;
+        }
+    }
+
+    /**
+     * This method removes all queued resolutions and forgets the resolutions in flight.
+     */
+    void Clear(void)
+    {
+        mPending.clear();
+        mInFlight = 0;
+    }
+
+    /**
+     * This method returns the number of resolutions in flight.
+     *
+     * @returns The number of resolutions in flight.
+     */
+    uint16_t GetInFlightCount(void) const { return mInFlight; }
+
+    /**
+     * This method returns the number of queued resolutions.
+     *
+     * @returns The number of queued resolutions.
+     */
+    size_t GetPendingCount(void) const { return mPending.size(); }
+
+private:
+    bool CanStart(void) const { return mMaxInFlight == 0 || mInFlight < mMaxInFlight; }
+
+    void StartPending(void)
+    {
+        // A start handler may finish its resolution right away (e.g. on
+        // failure), the outer loop picks up the next queued resolution
+        // instead of recursing.
+        if (!mIsStarting)
+        {
+            mIsStarting = true;
+
+            while (!mPending.empty() && CanStart())
+            {
+                StartHandler startHandler = std::move(mPending.front().second);
+
+                mPending.pop_front();
+                mInFlight++;
+                startHandler();
+            }
+
+            mIsStarting = false;
+        }
+    }
+
+    uint16_t                                         mMaxInFlight;
+    uint16_t                                         mInFlight;
+    bool                                             mIsStarting;
+    std::deque<std::pair<std::string, StartHandler>> mPending;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_RESOLUTION_QUEUE_HPP_
@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the min-heap of mDNS timeouts.
+ */
+
+#ifndef OTBR_AGENT_MDNS_TIMEOUT_HEAP_HPP_
+#define OTBR_AGENT_MDNS_TIMEOUT_HEAP_HPP_
+
+#include <assert.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements an intrusive binary min-heap of armed timeouts ordered by their expiration time.
+ *
+ * The timeout type `TimeoutType` must provide a `mTimeout` member holding the expiration time and a `size_t
+ * mHeapIndex` member which is owned by the heap and must be initialized to `kNotInHeap`. The heap stores the position
+ * of each timeout in `mHeapIndex`, so that finding the earliest timeout is O(1) while adding, updating and removing a
+ * timeout are O(log n). The heap doesn't own the timeouts.
+ */
+template <typename TimeoutType> class TimeoutHeap
+{
+public:
+    static constexpr size_t kNotInHeap = SIZE_MAX; ///< The `mHeapIndex` of timeouts which are not in the heap.
+
+    /**
+     * This method indicates whether the heap is empty.
+     *
+     * @returns Whether the heap is empty.
+     */
+    bool IsEmpty(void) const { return mHeap.empty(); }
+
+    /**
+     * This method returns the number of timeouts in the heap.
+     *
+     * @returns The number of timeouts.
+     */
+    size_t GetSize(void) const { return mHeap.size(); }
+
+    /**
+     * This method returns the timeout which expires first.
+     *
+     * @returns A pointer to the earliest timeout, `nullptr` if the heap is empty.
+     */
+    TimeoutType *GetTop(void) const { return mHeap.empty() ? nullptr : mHeap.front(); }
+
+    /**
+     * This method indicates whether a timeout is in the heap.
+     *
+     * @param[in] aTimeout  The timeout.
+     *
+     * @returns Whether the timeout is in the heap.
+     */
+    static bool Contains(const TimeoutType &aTimeout) { return aTimeout.mHeapIndex != kNotInHeap; }
+
+    /**
+     * This method adds a timeout to the heap or moves it to its new position after its expiration time has changed.
+     *
+     * @param[in] aTimeout  The timeout.
+     */
+    void Update(TimeoutType &aTimeout)
+    {
+        if (!Contains(aTimeout))
+        {
+            aTimeout.mHeapIndex = mHeap.size();
+            mHeap.push_back(&aTimeout);
+        }
+
+        SiftDown(SiftUp(aTimeout.mHeapIndex));
+    }
+
+    /**
+     * This method removes a timeout from the heap.
+     *
+     * Nothing happens if the timeout isn't in the heap.
+     *
+     * @param[in] aTimeout  The timeout.
+     */
+    void Remove(TimeoutType &aTimeout)
+    {
+        size_t index = aTimeout.mHeapIndex;
+
+        if (index != kNotInHeap)
+        {
+            assert(mHeap[index] == &aTimeout);
+
+            Swap(index, mHeap.size() - 1);
+            mHeap.pop_back();
+            aTimeout.mHeapIndex = kNotInHeap;
+
+            if (index < mHeap.size())
+            {
+                SiftDown(SiftUp(index));
+            }
+        }
+    }
+
+private:
+    bool IsEarlier(size_t aIndex, size_t aOtherIndex) const
+    {
+        return mHeap[aIndex]->mTimeout < mHeap[aOtherIndex]->mTimeout;
+    }
+
+    void Swap(size_t aIndex, size_t aOtherIndex)
+    {
+        std::swap(mHeap[aIndex], mHeap[aOtherIndex]);
+        mHeap[aIndex]->mHeapIndex      = aIndex;
+        mHeap[aOtherIndex]->mHeapIndex = aOtherIndex;
+    }
+
+    size_t SiftUp(size_t aIndex)
+    {
+        while (aIndex > 0 && IsEarlier(aIndex, (aIndex - 1) / 2))
+        {
+            Swap(aIndex, (aIndex - 1) / 2);
+            aIndex = (aIndex - 1) / 2;
+        }
+
+        return aIndex;
+    }
+
+    void SiftDown(size_t aIndex)
+    {
+        while (true)
+        {
+            size_t earliest = aIndex;
+            size_t left     = 2 * aIndex + 1;
+            size_t right    = left + 1;
+
+            if (left < mHeap.size() && IsEarlier(left, earliest))
+            {
+                earliest = left;
+            }
+
+            if (right < mHeap.size() && IsEarlier(right, earliest))
+            {
+                earliest = right;
+            }
+
+            if (earliest == aIndex)
+            {
+                break;
+            }
+
+            Swap(aIndex, earliest);
+            aIndex = earliest;
+        }
+    }
+
+    std::vector<TimeoutType *> mHeap;
+};
+
+template <typename TimeoutType> constexpr size_t TimeoutHeap<TimeoutType>::kNotInHeap;
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_TIMEOUT_HEAP_HPP_
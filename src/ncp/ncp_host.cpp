@@ -66,6 +66,9 @@ void NcpNetworkProperties::SetDeviceRole(otDeviceRole aRole)
 NcpHost::NcpHost(const char *aInterfaceName, bool aDryRun)
     : mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
     , mNetif(mNcpSpinel)
+#if OTBR_ENABLE_NCP_IO_THREAD
+    , mIoTransport(mSpinelDriver)
+#endif
 {
     memset(&mConfig, 0, sizeof(mConfig));
     mConfig.mInterfaceName = aInterfaceName;
@@ -82,6 +85,9 @@ void NcpHost::Init(void)
 {
     otSysInit(&mConfig);
     mNcpSpinel.Init(mSpinelDriver, *this);
+#if OTBR_ENABLE_NCP_IP6_TX_TAIL_DROP
+    mNcpSpinel.Ip6SetTxDropPolicy(NcpSpinel::Ip6TxDropPolicy::kTailDrop);
+#endif
     mNetif.Init(mConfig.mInterfaceName);
 
     mNcpSpinel.Ip6SetAddressCallback(
@@ -91,10 +97,26 @@ void NcpHost::Init(void)
     mNcpSpinel.NetifSetStateChangedCallback([this](bool aState) { mNetif.SetNetifState(aState); });
     mNcpSpinel.Ip6SetReceiveCallback(
         [this](const uint8_t *aData, uint16_t aLength) { mNetif.Ip6Receive(aData, aLength); });
+
+#if OTBR_ENABLE_NCP_IO_THREAD
+    mIoThread.reset(new NcpIoThread(mIoTransport, mNetif.DelegateTunIo(), mSpinelDriver.GetIid()));
+    mNcpSpinel.SetTransportMutex(&mIoThread->GetTransportMutex());
+    SuccessOrDie(mIoThread->Start([this](const uint8_t *aFrame,
+                                         uint16_t aLength) { mNcpSpinel.HandleReceivedFrame(aFrame, aLength); }),
+                 "Failed to start the NCP I/O thread");
+#endif
 }
 
 void NcpHost::Deinit(void)
 {
+#if OTBR_ENABLE_NCP_IO_THREAD
+    if (mIoThread != nullptr)
+    {
+        mIoThread->Stop();
+        mNcpSpinel.SetTransportMutex(nullptr);
+        mIoThread.reset();
+    }
+#endif
     mNcpSpinel.Deinit();
     mNetif.Deinit();
     otSysDeinit();
@@ -175,19 +197,31 @@ exit:
 
 void NcpHost::Process(const MainloopContext &aMainloop)
 {
-    mSpinelDriver.Process(&aMainloop);
+#if OTBR_ENABLE_NCP_IO_THREAD
+    // The I/O thread receives the frames and hands the control frames to
+    // the mainloop by its own `Process()`.
+    if (mIoThread == nullptr)
+#endif
+    {
+        mSpinelDriver.Process(&aMainloop);
+    }
 
     mNetif.Process(&aMainloop);
 }
 
 void NcpHost::Update(MainloopContext &aMainloop)
 {
-    mSpinelDriver.GetSpinelInterface()->UpdateFdSet(&aMainloop);
-
-    if (mSpinelDriver.HasPendingFrame())
+#if OTBR_ENABLE_NCP_IO_THREAD
+    if (mIoThread == nullptr)
+#endif
     {
-        aMainloop.mTimeout.tv_sec  = 0;
-        aMainloop.mTimeout.tv_usec = 0;
+        mSpinelDriver.GetSpinelInterface()->UpdateFdSet(&aMainloop);
+
+        if (mSpinelDriver.HasPendingFrame())
+        {
+            aMainloop.mTimeout.tv_sec  = 0;
+            aMainloop.mTimeout.tv_usec = 0;
+        }
     }
 
     mNetif.UpdateFdSet(&aMainloop);
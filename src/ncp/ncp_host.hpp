@@ -34,10 +34,15 @@
 #ifndef OTBR_AGENT_NCP_HOST_HPP_
 #define OTBR_AGENT_NCP_HOST_HPP_
 
+#include "openthread-br/config.h"
+
+#include <memory>
+
 #include "lib/spinel/coprocessor_type.h"
 #include "lib/spinel/spinel_driver.hpp"
 
 #include "common/mainloop.hpp"
+#include "ncp/ncp_io_thread.hpp"
 #include "ncp/ncp_spinel.hpp"
 #include "ncp/thread_host.hpp"
 #include "posix/netif.hpp"
@@ -100,6 +105,13 @@ public:
     void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+    /**
+     * This method returns the counters of the IPv6 transmit path to the NCP.
+     *
+     * @returns The IPv6 transmit counters.
+     */
+    const NcpSpinel::Ip6TxCounters &GetIp6TxCounters(void) const { return mNcpSpinel.GetIp6TxCounters(); }
+
     // MainloopProcessor methods
     void Update(MainloopContext &aMainloop) override;
     void Process(const MainloopContext &aMainloop) override;
@@ -110,6 +122,10 @@ private:
     NcpSpinel                 mNcpSpinel;
     TaskRunner                mTaskRunner;
     Netif                     mNetif;
+#if OTBR_ENABLE_NCP_IO_THREAD
+    NcpIoThread::SpinelDriverTransport mIoTransport;
+    std::unique_ptr<NcpIoThread>       mIoThread;
+#endif
 };
 
 } // namespace Ncp
@@ -0,0 +1,397 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "NcpIoThread"
+
+#include "ncp_io_thread.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+constexpr uint16_t NcpIoThread::kMaxFrameSize;
+
+NcpIoThread::NcpIoThread(Transport &aTransport, int aTunFd, spinel_iid_t aIid)
+    : mTransport(aTransport)
+    , mTunFd(aTunFd)
+    , mIid(aIid)
+    , mShouldStop(false)
+    , mThreadEventFd{-1, -1}
+    , mMainloopEventFd{-1, -1}
+    , mPacketsToNcp(0)
+    , mPacketsFromNcp(0)
+    , mDroppedPackets(0)
+    , mNumControlFrames(0)
+    , mNumDeferredControlFrames(0)
+{
+}
+
+NcpIoThread::~NcpIoThread(void)
+{
+    Stop();
+}
+
+otbrError NcpIoThread::Start(FrameHandler aControlFrameHandler)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!IsRunning(), error = OTBR_ERROR_INVALID_STATE);
+
+    VerifyOrExit(pipe(mThreadEventFd) == 0 && pipe(mMainloopEventFd) == 0, error = OTBR_ERROR_ERRNO);
+
+    for (int fd : {mThreadEventFd[kRead], mThreadEventFd[kWrite], mMainloopEventFd[kRead], mMainloopEventFd[kWrite]})
+    {
+        VerifyOrExit(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) == 0, error = OTBR_ERROR_ERRNO);
+    }
+
+    mControlFrameHandler = std::move(aControlFrameHandler);
+    mShouldStop          = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mTransportMutex);
+
+        mTransport.SetReceiveHandler(
+            [this](const uint8_t *aFrame, uint16_t aLength) { HandleReceivedFrame(aFrame, aLength); });
+    }
+
+    mThread = std::thread(&NcpIoThread::Run, this);
+
+exit:
+    if (error == OTBR_ERROR_ERRNO)
+    {
+        otbrLogWarning("Failed to start the I/O thread: %s", strerror(errno));
+        ClosePipes();
+    }
+
+    return error;
+}
+
+void NcpIoThread::Stop(void)
+{
+    VerifyOrExit(IsRunning());
+
+    mShouldStop = true;
+    WakeUp(mThreadEventFd[kWrite]);
+    mThread.join();
+
+    // Hand the control frames which are still queued to the mainloop.
+    HandleControlFrames();
+    ClosePipes();
+
+exit:
+    return;
+}
+
+NcpIoThread::Counters NcpIoThread::GetCounters(void) const
+{
+    Counters counters;
+
+    counters.mPacketsToNcp          = mPacketsToNcp;
+    counters.mPacketsFromNcp        = mPacketsFromNcp;
+    counters.mDroppedPackets        = mDroppedPackets;
+    counters.mControlFrames         = mNumControlFrames;
+    counters.mDeferredControlFrames = mNumDeferredControlFrames;
+
+    return counters;
+}
+
+void NcpIoThread::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(IsRunning());
+
+    aMainloop.AddFdToReadSet(mMainloopEventFd[kRead]);
+
+    if (!mControlFrames.IsEmpty())
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+
+exit:
+    return;
+}
+
+void NcpIoThread::Process(const MainloopContext &aMainloop)
+{
+    VerifyOrExit(IsRunning());
+
+    if (FD_ISSET(mMainloopEventFd[kRead], &aMainloop.mReadFdSet))
+    {
+        ClearWakeUps(mMainloopEventFd[kRead]);
+    }
+
+    HandleControlFrames();
+
+exit:
+    return;
+}
+
+void NcpIoThread::HandleControlFrames(void)
+{
+    Frame *frame;
+
+    // The frames are handled in place, the slot is released afterwards.
+    while ((frame = mControlFrames.GetReadSlot()) != nullptr)
+    {
+        mControlFrameHandler(frame->mData, frame->mLength);
+        mControlFrames.CommitRead();
+    }
+}
+
+void NcpIoThread::Run(void)
+{
+    while (!mShouldStop)
+    {
+        MainloopContext context;
+        int             rval;
+
+        context.mMaxFd   = -1;
+        context.mTimeout = ToTimeval(Seconds(1));
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        PushDeferredControlFrames();
+
+        if (!mDeferredControlFrames.empty())
+        {
+            // Nothing tells when the mainloop makes room in the ring, check
+            // again shortly.
+            context.mTimeout = ToTimeval(Milliseconds(1));
+        }
+
+        context.AddFdToReadSet(mThreadEventFd[kRead]);
+        context.AddFdToReadSet(mTunFd);
+
+        {
+            std::lock_guard<std::mutex> lock(mTransportMutex);
+
+            mTransport.UpdateFdSet(context);
+        }
+
+        rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                      &context.mTimeout);
+
+        if (rval < 0)
+        {
+            VerifyOrDie(errno == EINTR, strerror(errno));
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mTransportMutex);
+
+            mTransport.Process(context);
+        }
+
+        if (FD_ISSET(mTunFd, &context.mReadFdSet))
+        {
+            ProcessTun();
+        }
+
+        if (FD_ISSET(mThreadEventFd[kRead], &context.mReadFdSet))
+        {
+            ClearWakeUps(mThreadEventFd[kRead]);
+        }
+    }
+}
+
+void NcpIoThread::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    uint8_t        header;
+    unsigned int   command;
+    unsigned int   key;
+    const uint8_t *data;
+    spinel_size_t  dataLength;
+    const uint8_t *packet;
+    unsigned int   packetLength;
+
+    // Packets from Thread are only in unsolicited `PROP_VALUE_IS(STREAM_NET)`
+    // frames, everything else is left to the mainloop.
+    VerifyOrExit(spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &command, &key, &data, &dataLength) > 0);
+    VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0 && command == SPINEL_CMD_PROP_VALUE_IS &&
+                 key == SPINEL_PROP_STREAM_NET);
+    VerifyOrExit(spinel_datatype_unpack(data, dataLength, SPINEL_DATATYPE_DATA_WLEN_S, &packet, &packetLength) > 0);
+
+    if (write(mTunFd, packet, packetLength) == static_cast<ssize_t>(packetLength))
+    {
+        mPacketsFromNcp++;
+    }
+    else
+    {
+        mDroppedPackets++;
+        otbrLogDebug("Failed to write to Tun Fd: %s", strerror(errno));
+    }
+
+    return;
+
+exit:
+    PushControlFrame(aFrame, aLength);
+}
+
+void NcpIoThread::PushControlFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    Frame *frame = nullptr;
+
+    mNumControlFrames++;
+
+    // Frames which don't fit in a slot, and any frame received after them, wait
+    // in order until there is room in the ring.
+    if (mDeferredControlFrames.empty() && aLength <= kMaxFrameSize)
+    {
+        frame = mControlFrames.GetWriteSlot();
+    }
+
+    if (frame != nullptr)
+    {
+        memcpy(frame->mData, aFrame, aLength);
+        frame->mLength = aLength;
+        mControlFrames.CommitWrite();
+        WakeUp(mMainloopEventFd[kWrite]);
+    }
+    else
+    {
+        mDeferredControlFrames.emplace_back(aFrame, aFrame + aLength);
+        mNumDeferredControlFrames++;
+    }
+}
+
+void NcpIoThread::PushDeferredControlFrames(void)
+{
+    auto it = mDeferredControlFrames.begin();
+
+    for (; it != mDeferredControlFrames.end(); ++it)
+    {
+        Frame *frame = mControlFrames.GetWriteSlot();
+
+        if (frame == nullptr)
+        {
+            break;
+        }
+
+        if (it->size() > kMaxFrameSize)
+        {
+            otbrLogWarning("Dropped a control frame of %zu bytes", it->size());
+            continue;
+        }
+
+        memcpy(frame->mData, it->data(), it->size());
+        frame->mLength = static_cast<uint16_t>(it->size());
+        mControlFrames.CommitWrite();
+    }
+
+    if (it != mDeferredControlFrames.begin())
+    {
+        mDeferredControlFrames.erase(mDeferredControlFrames.begin(), it);
+        WakeUp(mMainloopEventFd[kWrite]);
+    }
+}
+
+void NcpIoThread::ProcessTun(void)
+{
+    uint8_t packet[kMaxFrameSize];
+    uint8_t frame[kMaxFrameSize];
+
+    for (size_t i = 0; i < kMaxTunPacketsPerRound; i++)
+    {
+        ssize_t        packetLength = read(mTunFd, packet, sizeof(packet));
+        spinel_ssize_t frameLength;
+        otError        error;
+
+        if (packetLength <= 0)
+        {
+            break;
+        }
+
+        frameLength = spinel_datatype_pack(frame, sizeof(frame), "Cii" SPINEL_DATATYPE_DATA_WLEN_S,
+                                           SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid), SPINEL_CMD_PROP_VALUE_SET,
+                                           SPINEL_PROP_STREAM_NET, packet, static_cast<uint16_t>(packetLength));
+
+        if (frameLength <= 0 || static_cast<size_t>(frameLength) > sizeof(frame))
+        {
+            mDroppedPackets++;
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mTransportMutex);
+
+            error = mTransport.SendFrame(frame, static_cast<uint16_t>(frameLength));
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            mPacketsToNcp++;
+        }
+        else
+        {
+            mDroppedPackets++;
+            otbrLogDebug("Failed to send a packet to the NCP: %s", otThreadErrorToString(error));
+        }
+    }
+}
+
+void NcpIoThread::ClosePipes(void)
+{
+    for (int *fd : {&mThreadEventFd[kRead], &mThreadEventFd[kWrite], &mMainloopEventFd[kRead],
+                    &mMainloopEventFd[kWrite]})
+    {
+        if (*fd >= 0)
+        {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void NcpIoThread::WakeUp(int aFd)
+{
+    const uint8_t kOne = 1;
+
+    // A full pipe already wakes up the reader.
+    OTBR_UNUSED_VARIABLE(write(aFd, &kOne, sizeof(kOne)));
+}
+
+void NcpIoThread::ClearWakeUps(int aFd)
+{
+    uint8_t buffer[64];
+
+    while (read(aFd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,279 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the thread which forwards IPv6 packets between the TUN device and the NCP.
+ */
+
+#ifndef OTBR_AGENT_NCP_IO_THREAD_HPP_
+#define OTBR_AGENT_NCP_IO_THREAD_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#include "lib/spinel/spinel.h"
+#include "lib/spinel/spinel_driver.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/spsc_ring.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class implements a dedicated thread which forwards IPv6 packets between the TUN device and the NCP.
+ *
+ * The thread owns the TUN device and the receive path of the spinel transport. `STREAM_NET` frames from the NCP are
+ * written to the TUN device, and packets read from the TUN device are sent to the NCP as `STREAM_NET` frames with TID
+ * 0, which the NCP doesn't respond to. Neither waits for the mainloop, so a slow handler on the mainloop doesn't delay
+ * forwarded packets.
+ *
+ * All the other frames received from the NCP are control frames. They are handed to the mainloop through a lock-free
+ * ring and passed to the handler given to `Start()` by `Process()`. The mainloop still sends its control frames
+ * itself, holding the lock returned by `GetTransportMutex()`.
+ */
+class NcpIoThread : public MainloopProcessor, private NonCopyable
+{
+public:
+    using FrameHandler = std::function<void(const uint8_t *aFrame, uint16_t aLength)>;
+
+    /**
+     * This class defines the spinel transport used by the I/O thread.
+     */
+    class Transport
+    {
+    public:
+        virtual ~Transport(void) = default;
+
+        /**
+         * This method sets the handler of the frames received by `Process()`.
+         *
+         * @param[in] aHandler  The handler of received frames.
+         */
+        virtual void SetReceiveHandler(FrameHandler aHandler) = 0;
+
+        /**
+         * This method adds the file descriptors of the transport to a mainloop context.
+         *
+         * @param[in,out] aContext  The mainloop context.
+         */
+        virtual void UpdateFdSet(MainloopContext &aContext) = 0;
+
+        /**
+         * This method receives the frames which are ready and passes them to the receive handler.
+         *
+         * @param[in] aContext  The mainloop context.
+         */
+        virtual void Process(const MainloopContext &aContext) = 0;
+
+        /**
+         * This method sends a frame.
+         *
+         * @param[in] aFrame   A pointer to the frame.
+         * @param[in] aLength  The length of the frame.
+         *
+         * @returns The error of sending the frame.
+         */
+        virtual otError SendFrame(const uint8_t *aFrame, uint16_t aLength) = 0;
+    };
+
+    /**
+     * This class implements the transport over a spinel driver.
+     */
+    class SpinelDriverTransport : public Transport
+    {
+    public:
+        explicit SpinelDriverTransport(ot::Spinel::SpinelDriver &aSpinelDriver)
+            : mSpinelDriver(aSpinelDriver)
+        {
+        }
+
+        void SetReceiveHandler(FrameHandler aHandler) override
+        {
+            mReceiveHandler = std::move(aHandler);
+            mSpinelDriver.SetFrameHandler(&HandleReceivedFrame, &HandleSavedFrame, this);
+        }
+
+        void UpdateFdSet(MainloopContext &aContext) override
+        {
+            mSpinelDriver.GetSpinelInterface()->UpdateFdSet(&aContext);
+        }
+
+        void Process(const MainloopContext &aContext) override { mSpinelDriver.Process(&aContext); }
+
+        otError SendFrame(const uint8_t *aFrame, uint16_t aLength) override
+        {
+            return mSpinelDriver.GetSpinelInterface()->SendFrame(aFrame, aLength);
+        }
+
+    private:
+        static void HandleReceivedFrame(const uint8_t *aFrame,
+                                        uint16_t       aLength,
+                                        uint8_t        aHeader,
+                                        bool          &aSave,
+                                        void          *aContext)
+        {
+            OTBR_UNUSED_VARIABLE(aHeader);
+
+            static_cast<SpinelDriverTransport *>(aContext)->mReceiveHandler(aFrame, aLength);
+            aSave = false;
+        }
+
+        static void HandleSavedFrame(const uint8_t *aFrame, uint16_t aLength, void *aContext)
+        {
+            /* Intentionally Empty */
+            OTBR_UNUSED_VARIABLE(aFrame);
+            OTBR_UNUSED_VARIABLE(aLength);
+            OTBR_UNUSED_VARIABLE(aContext);
+        }
+
+        ot::Spinel::SpinelDriver &mSpinelDriver;
+        FrameHandler              mReceiveHandler;
+    };
+
+    /**
+     * This structure represents the counters of the I/O thread.
+     */
+    struct Counters
+    {
+        uint64_t mPacketsToNcp;          ///< The number of packets read from the TUN device and sent to the NCP.
+        uint64_t mPacketsFromNcp;        ///< The number of packets from the NCP written to the TUN device.
+        uint64_t mDroppedPackets;        ///< The number of packets which failed to be sent or written.
+        uint64_t mControlFrames;         ///< The number of control frames handed to the mainloop.
+        uint64_t mDeferredControlFrames; ///< The number of control frames which waited for room in the ring.
+    };
+
+    /**
+     * This constructor initializes the I/O thread.
+     *
+     * @param[in] aTransport  The spinel transport.
+     * @param[in] aTunFd      The file descriptor of the TUN device, the I/O thread is its only user while running.
+     * @param[in] aIid        The spinel Interface ID of the frames sent to the NCP.
+     */
+    NcpIoThread(Transport &aTransport, int aTunFd, spinel_iid_t aIid);
+
+    ~NcpIoThread(void) override;
+
+    /**
+     * This method starts the I/O thread.
+     *
+     * @param[in] aControlFrameHandler  The handler of control frames, which is called on the mainloop.
+     *
+     * @retval OTBR_ERROR_NONE           Successfully started the I/O thread.
+     * @retval OTBR_ERROR_INVALID_STATE  The I/O thread is already running.
+     * @retval OTBR_ERROR_ERRNO          Failed to start the I/O thread.
+     */
+    otbrError Start(FrameHandler aControlFrameHandler);
+
+    /**
+     * This method stops the I/O thread and waits for it to exit.
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the I/O thread is running.
+     *
+     * @returns Whether the I/O thread is running.
+     */
+    bool IsRunning(void) const { return mThread.joinable(); }
+
+    /**
+     * This method returns the lock which must be held by other threads while using the spinel transport.
+     *
+     * @returns The lock of the spinel transport.
+     */
+    std::mutex &GetTransportMutex(void) { return mTransportMutex; }
+
+    /**
+     * This method returns the counters of the I/O thread.
+     *
+     * @returns The counters.
+     */
+    Counters GetCounters(void) const;
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+private:
+    static constexpr uint16_t kMaxFrameSize          = SPINEL_FRAME_MAX_SIZE;
+    static constexpr size_t   kControlRingSize       = 64;
+    static constexpr size_t   kMaxTunPacketsPerRound = 64;
+    static constexpr int      kRead                  = 0;
+    static constexpr int      kWrite                 = 1;
+
+    struct Frame
+    {
+        uint16_t mLength;
+        uint8_t  mData[kMaxFrameSize];
+    };
+
+    void Run(void);
+    void HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength);
+    void PushControlFrame(const uint8_t *aFrame, uint16_t aLength);
+    void PushDeferredControlFrames(void);
+    void HandleControlFrames(void);
+    void ProcessTun(void);
+    void ClosePipes(void);
+
+    static void WakeUp(int aFd);
+    static void ClearWakeUps(int aFd);
+
+    Transport   &mTransport;
+    int          mTunFd;
+    spinel_iid_t mIid;
+    FrameHandler mControlFrameHandler;
+    std::thread  mThread;
+    std::mutex   mTransportMutex;
+
+    std::atomic<bool> mShouldStop;
+    int               mThreadEventFd[2];   ///< Wakes up the I/O thread.
+    int               mMainloopEventFd[2]; ///< Wakes up the mainloop.
+
+    SpscRing<Frame, kControlRingSize> mControlFrames;         ///< From the I/O thread to the mainloop.
+    std::vector<std::vector<uint8_t>> mDeferredControlFrames; ///< Used by the I/O thread only.
+
+    std::atomic<uint64_t> mPacketsToNcp;
+    std::atomic<uint64_t> mPacketsFromNcp;
+    std::atomic<uint64_t> mDroppedPackets;
+    std::atomic<uint64_t> mNumControlFrames;
+    std::atomic<uint64_t> mNumDeferredControlFrames;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_NCP_IO_THREAD_HPP_
@@ -30,6 +30,7 @@
 
 #include "ncp_spinel.hpp"
 
+#include <netinet/in.h>
 #include <stdarg.h>
 
 #include <algorithm>
@@ -49,17 +50,31 @@ namespace Ncp {
 
 static constexpr char kSpinelDataUnpackFormat[] = "CiiD";
 
+constexpr Milliseconds NcpSpinel::kResponseTimeout;
+constexpr Milliseconds NcpSpinel::kSlowResponseTimeout;
+constexpr Milliseconds NcpSpinel::kIp6TxRetryDelay;
+
 NcpSpinel::NcpSpinel(void)
     : mSpinelDriver(nullptr)
+    , mTransportMutex(nullptr)
     , mCmdTidsInUse(0)
+    , mCmdTidsTimedOut(0)
     , mCmdNextTid(1)
+    , mTransactionMetrics()
+    , mIsTransactionTimerScheduled(false)
     , mNcpBuffer(mTxBuffer, kTxBufferSize)
     , mEncoder(mNcpBuffer)
     , mIid(SPINEL_HEADER_INVALID_IID)
     , mPropsObserver(nullptr)
+    , mIp6TxDropPolicy(Ip6TxDropPolicy::kPrioritizeIcmp6)
+    , mIp6TxCounters()
+    , mIsIp6TxRetryScheduled(false)
 {
-    std::fill_n(mWaitingKeyTable, SPINEL_PROP_LAST_STATUS, sizeof(mWaitingKeyTable));
-    memset(mCmdTable, 0, sizeof(mCmdTable));
+    for (Transaction &transaction : mTransactions)
+    {
+        transaction.mCmd = SPINEL_CMD_NOOP;
+        transaction.mKey = SPINEL_PROP_LAST_STATUS;
+    }
 }
 
 void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aObserver)
@@ -75,6 +90,7 @@ void NcpSpinel::Deinit(void)
     mSpinelDriver              = nullptr;
     mIp6AddressTableCallback   = nullptr;
     mNetifStateChangedCallback = nullptr;
+    mIp6TxQueue.clear();
 }
 
 otbrError NcpSpinel::SpinelDataUnpack(const uint8_t *aDataIn, spinel_size_t aDataLen, const char *aPackFormat, ...)
@@ -100,10 +116,7 @@ void NcpSpinel::DatasetSetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDa
         return mEncoder.WriteData(aActiveOpDatasetTlvs.mTlvs, aActiveOpDatasetTlvs.mLength);
     };
 
-    VerifyOrExit(mDatasetSetActiveTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc));
-    mDatasetSetActiveTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -137,10 +150,7 @@ void NcpSpinel::Ip6SetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [this, aEnable] { return mEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mIp6SetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc));
-    mIp6SetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_IF_UP, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -153,24 +163,154 @@ exit:
 
 otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
-    otbrError    error        = OTBR_ERROR_NONE;
+    otbrError error = OTBR_ERROR_NONE;
+
+    // A packet may only bypass the queue when the queue is empty, otherwise packets would be reordered.
+    if (mIp6TxQueue.empty())
+    {
+        otError sendError = SendIp6Packet(aData, aLength);
+
+        VerifyOrExit(sendError != OT_ERROR_NONE);
+        VerifyOrExit(IsIp6TxBusyError(sendError), error = OTBR_ERROR_OPENTHREAD);
+    }
+
+    error = EnqueueIp6Packet(aData, aLength);
+
+exit:
+    return error;
+}
+
+bool NcpSpinel::IsIcmp6Packet(const uint8_t *aData, uint16_t aLength)
+{
+    static constexpr uint16_t kIp6HeaderSize       = 40;
+    static constexpr uint16_t kIp6NextHeaderOffset = 6;
+
+    bool     isIcmp6 = false;
+    uint8_t  nextHeader;
+    uint32_t offset = kIp6HeaderSize;
+
+    VerifyOrExit(aLength >= kIp6HeaderSize);
+
+    nextHeader = aData[kIp6NextHeaderOffset];
+
+    // MLD messages are carried after a Hop-by-Hop Options header, other extension headers may precede ICMPv6 too.
+    while (nextHeader == IPPROTO_HOPOPTS || nextHeader == IPPROTO_ROUTING || nextHeader == IPPROTO_DSTOPTS ||
+           nextHeader == IPPROTO_FRAGMENT)
+    {
+        uint32_t headerSize;
+
+        VerifyOrExit(aLength >= offset + 2);
+
+        if (nextHeader == IPPROTO_FRAGMENT)
+        {
+            // Only the first fragment, whose Fragment Offset is zero, carries the ICMPv6 header.
+            VerifyOrExit(aLength >= offset + 4);
+            VerifyOrExit(aData[offset + 2] == 0 && (aData[offset + 3] & 0xf8) == 0);
+            headerSize = 8;
+        }
+        else
+        {
+            headerSize = (aData[offset + 1] + 1) * 8;
+        }
+
+        nextHeader = aData[offset];
+        offset += headerSize;
+    }
+
+    isIcmp6 = (nextHeader == IPPROTO_ICMPV6 && aLength > offset);
+
+exit:
+    return isIcmp6;
+}
+
+otError NcpSpinel::SendIp6Packet(const uint8_t *aData, uint16_t aLength)
+{
     EncodingFunc encodingFunc = [this, aData, aLength] { return mEncoder.WriteDataWithLen(aData, aLength); };
+    otError      error        = SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc);
 
-    SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc), error = OTBR_ERROR_OPENTHREAD);
+    if (error == OT_ERROR_NONE)
+    {
+        mIp6TxCounters.mSentPackets++;
+    }
+    else if (!IsIp6TxBusyError(error))
+    {
+        mIp6TxCounters.mFailedPackets++;
+        otbrLogWarning("Failed to send IPv6 packet to NCP: %s", otThreadErrorToString(error));
+    }
+
+    return error;
+}
+
+otbrError NcpSpinel::EnqueueIp6Packet(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error   = OTBR_ERROR_NONE;
+    bool      isIcmp6 = IsIcmp6Packet(aData, aLength);
+
+    if (mIp6TxQueue.size() >= kIp6TxQueueMaxLength)
+    {
+        auto victim = mIp6TxQueue.end();
+
+        // Make room for a new ICMPv6 (e.g. ND and MLD) packet by dropping the oldest other packet.
+        if (isIcmp6 && mIp6TxDropPolicy == Ip6TxDropPolicy::kPrioritizeIcmp6)
+        {
+            victim = std::find_if(mIp6TxQueue.begin(), mIp6TxQueue.end(),
+                                  [](const Ip6TxPacket &aPacket) { return !aPacket.mIsIcmp6; });
+        }
+
+        mIp6TxCounters.mDroppedPackets++;
+        VerifyOrExit(victim != mIp6TxQueue.end(), error = OTBR_ERROR_DROPPED);
+        mIp6TxQueue.erase(victim);
+    }
+
+    mIp6TxQueue.push_back(Ip6TxPacket{std::vector<uint8_t>(aData, aData + aLength), isIcmp6});
+    mIp6TxCounters.mQueuedPackets++;
+    mIp6TxCounters.mMaxQueueDepth = std::max(mIp6TxCounters.mMaxQueueDepth, GetIp6TxQueueDepth());
+    ScheduleIp6TxRetry();
 
 exit:
     return error;
 }
 
+void NcpSpinel::SendQueuedIp6Packets(void)
+{
+    while (!mIp6TxQueue.empty())
+    {
+        const Ip6TxPacket &packet = mIp6TxQueue.front();
+
+        if (IsIp6TxBusyError(SendIp6Packet(packet.mData.data(), static_cast<uint16_t>(packet.mData.size()))))
+        {
+            break;
+        }
+
+        // The packet is either sent or dropped because of a non-transient error.
+        mIp6TxQueue.pop_front();
+    }
+
+    ScheduleIp6TxRetry();
+}
+
+void NcpSpinel::ScheduleIp6TxRetry(void)
+{
+    // The queue is drained whenever a response frees a TID. Only when there is no ongoing
+    // transaction (e.g. the spinel interface itself is out of buffers) a retry is needed.
+    VerifyOrExit(!mIp6TxQueue.empty() && GetNumTransactionsInFlight() == 0 && !mIsIp6TxRetryScheduled);
+
+    mIsIp6TxRetryScheduled = true;
+    mTaskRunner.Post(kIp6TxRetryDelay, [this]() {
+        mIsIp6TxRetryScheduled = false;
+        SendQueuedIp6Packets();
+    });
+
+exit:
+    return;
+}
+
 void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
 {
     otError      error        = OT_ERROR_NONE;
     EncodingFunc encodingFunc = [this, aEnable] { return mEncoder.WriteBool(aEnable); };
 
-    VerifyOrExit(mThreadSetEnabledTask == nullptr, error = OT_ERROR_BUSY);
-
-    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc));
-    mThreadSetEnabledTask = aAsyncTask;
+    SuccessOrExit(error = SetProperty(SPINEL_PROP_NET_STACK_UP, encodingFunc, aAsyncTask));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -204,13 +344,14 @@ void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
     otError      error = OT_ERROR_NONE;
     spinel_tid_t tid   = GetNextTid();
 
-    VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
+    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
+    {
+        std::unique_lock<std::mutex> lock = LockTransport();
 
-    SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
+        SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
+    }
 
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
-    mThreadErasePersistentInfoTask = aAsyncTask;
+    BeginTransaction(tid, SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, aAsyncTask);
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -230,6 +371,17 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame,
     static_cast<NcpSpinel *>(aContext)->HandleReceivedFrame(aFrame, aLength, aHeader, aSave);
 }
 
+void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    bool shouldSaveFrame;
+
+    VerifyOrExit(aLength > 0);
+    HandleReceivedFrame(aFrame, aLength, aFrame[0], shouldSaveFrame);
+
+exit:
+    return;
+}
+
 void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uint8_t aHeader, bool &aShouldSaveFrame)
 {
     spinel_tid_t tid = SPINEL_HEADER_GET_TID(aHeader);
@@ -283,12 +435,23 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
     uint8_t          *data = nullptr;
     uint32_t          cmd;
     uint8_t           header;
+    bool              isLate;
     otbrError         error          = OTBR_ERROR_NONE;
     FailureHandler    failureHandler = nullptr;
 
+    VerifyOrExit((mCmdTidsInUse & (1 << aTid)) != 0, otbrLogWarning("Received unexpected response for tid:%u", aTid));
+
+    isLate = (mCmdTidsTimedOut & (1 << aTid)) != 0;
+    ReleaseTimedOutTids(aTid);
+    VerifyOrExit(!isLate, otbrLogWarning("Dropped late response for tid:%u", aTid));
+
     SuccessOrExit(error = SpinelDataUnpack(aFrame, aLength, kSpinelDataUnpackFormat, &header, &cmd, &key, &data, &len));
 
-    switch (mCmdTable[aTid])
+    mTransactionMetrics.mCompleted++;
+    mTransactionMetrics.mLatency.Record(static_cast<uint32_t>(
+        std::chrono::duration_cast<Microseconds>(Clock::now() - mTransactions[aTid].mSentTime).count()));
+
+    switch (mTransactions[aTid].mCmd)
     {
     case SPINEL_CMD_PROP_VALUE_SET:
     {
@@ -310,7 +473,7 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
         spinel_status_t status = SPINEL_STATUS_OK;
 
         SuccessOrExit(error = SpinelDataUnpack(data, len, SPINEL_DATATYPE_UINT_PACKED_S, &status));
-        CallAndClear(mThreadErasePersistentInfoTask, ot::Spinel::SpinelStatusToOtError(status));
+        CallAndClear(mTransactions[aTid].mAsyncTask, ot::Spinel::SpinelStatusToOtError(status));
         break;
     }
     default:
@@ -321,13 +484,20 @@ exit:
     if (error == OTBR_ERROR_INVALID_STATE)
     {
         otbrLogCrit("Received unexpected response with (cmd:%u, key:%u), waiting (cmd:%u, key:%u) for tid:%u", cmd, key,
-                    mCmdTable[aTid], mWaitingKeyTable[aTid], aTid);
+                    mTransactions[aTid].mCmd, mTransactions[aTid].mKey, aTid);
+        CallAndClear(mTransactions[aTid].mAsyncTask, OT_ERROR_FAILED, "Unexpected response from NCP!");
     }
     else if (error == OTBR_ERROR_PARSE)
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
+        CallAndClear(mTransactions[aTid].mAsyncTask, OT_ERROR_PARSE, "Failed to parse response from NCP!");
     }
     FreeTidTableItem(aTid);
+
+    if (!mIp6TxQueue.empty())
+    {
+        SendQueuedIp6Packets();
+    }
 }
 
 void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
@@ -343,6 +513,12 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
         SuccessOrExit(error = SpinelDataUnpack(aBuffer, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status));
 
         otbrLogInfo("NCP last status: %s", spinel_status_to_cstr(status));
+
+        if (status >= SPINEL_STATUS_RESET__BEGIN && status <= SPINEL_STATUS_RESET__END)
+        {
+            // The NCP has dropped all requests it received before the reset.
+            ReleaseTimedOutTids(0);
+        }
         break;
     }
 
@@ -433,16 +609,16 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
 
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions[aTid].mKey)
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         VerifyOrExit(aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mDatasetSetActiveTask, OT_ERROR_NONE);
+        CallAndClear(mTransactions[aTid].mAsyncTask, OT_ERROR_NONE);
         break;
 
     case SPINEL_PROP_NET_IF_UP:
         VerifyOrExit(aKey == SPINEL_PROP_NET_IF_UP, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mIp6SetEnabledTask, OT_ERROR_NONE);
+        CallAndClear(mTransactions[aTid].mAsyncTask, OT_ERROR_NONE);
         {
             bool isUp;
             SuccessOrExit(error = SpinelDataUnpack(aData, aLength, SPINEL_DATATYPE_BOOL_S, &isUp));
@@ -452,7 +628,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
 
     case SPINEL_PROP_NET_STACK_UP:
         VerifyOrExit(aKey == SPINEL_PROP_NET_STACK_UP, error = OTBR_ERROR_INVALID_STATE);
-        CallAndClear(mThreadSetEnabledTask, OT_ERROR_NONE);
+        CallAndClear(mTransactions[aTid].mAsyncTask, OT_ERROR_NONE);
         break;
 
     case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
@@ -473,7 +649,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
         break;
 
     default:
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mTransactions[aTid].mKey, error = OTBR_ERROR_INVALID_STATE);
         break;
     }
 
@@ -489,7 +665,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions[aTid].mKey)
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -510,7 +686,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mTransactions[aTid].mKey);
     return error;
 }
 
@@ -522,7 +698,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions[aTid].mKey)
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -543,7 +719,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mTransactions[aTid].mKey);
     return error;
 }
 
@@ -567,6 +743,21 @@ exit:
     return error;
 }
 
+Milliseconds NcpSpinel::GetResponseTimeout(spinel_command_t aCmd, spinel_prop_key_t aKey)
+{
+    Milliseconds timeout = kResponseTimeout;
+
+    // These requests are answered only after the NCP has written its settings to flash.
+    if (aCmd == SPINEL_CMD_NET_CLEAR ||
+        (aCmd == SPINEL_CMD_PROP_VALUE_SET &&
+         (aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS || aKey == SPINEL_PROP_NET_STACK_UP)))
+    {
+        timeout = kSlowResponseTimeout;
+    }
+
+    return timeout;
+}
+
 spinel_tid_t NcpSpinel::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -591,15 +782,119 @@ exit:
     return tid;
 }
 
+void NcpSpinel::BeginTransaction(spinel_tid_t      aTid,
+                                 spinel_command_t  aCmd,
+                                 spinel_prop_key_t aKey,
+                                 AsyncTaskPtr      aAsyncTask)
+{
+    Transaction &transaction = mTransactions[aTid];
+
+    transaction.mCmd       = aCmd;
+    transaction.mKey       = aKey;
+    transaction.mAsyncTask = std::move(aAsyncTask);
+    transaction.mSentTime  = Clock::now();
+    transaction.mDeadline  = transaction.mSentTime + GetResponseTimeout(aCmd, aKey);
+
+    mTransactionMetrics.mSent++;
+    mTransactionMetrics.mMaxInFlight = std::max(mTransactionMetrics.mMaxInFlight, GetNumTransactionsInFlight());
+
+    ScheduleTransactionTimeout();
+}
+
+uint8_t NcpSpinel::GetNumTransactionsInFlight(void) const
+{
+    uint8_t numInFlight = 0;
+
+    for (uint16_t tids = mCmdTidsInUse & ~mCmdTidsTimedOut; tids != 0; tids &= (tids - 1))
+    {
+        numInFlight++;
+    }
+
+    return numInFlight;
+}
+
+void NcpSpinel::ReleaseTimedOutTids(spinel_tid_t aRespondedTid)
+{
+    // A timed-out TID is kept in use, so that a late response can't complete a new request reusing it. The NCP
+    // handles the requests in order, so no response will come for the requests sent before the one responded.
+    // `aRespondedTid` of zero releases all of them.
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        if ((mCmdTidsTimedOut & (1 << tid)) != 0 &&
+            (aRespondedTid == 0 || mTransactions[tid].mSentTime <= mTransactions[aRespondedTid].mSentTime))
+        {
+            FreeTidTableItem(tid);
+        }
+    }
+}
+
 void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
 {
     mCmdTidsInUse &= ~(1 << aTid);
+    mCmdTidsTimedOut &= ~(1 << aTid);
+
+    mTransactions[aTid].mCmd       = SPINEL_CMD_NOOP;
+    mTransactions[aTid].mKey       = SPINEL_PROP_LAST_STATUS;
+    mTransactions[aTid].mAsyncTask = nullptr;
+}
+
+void NcpSpinel::ScheduleTransactionTimeout(void)
+{
+    Timepoint earliest = Timepoint::max();
+
+    VerifyOrExit(!mIsTransactionTimerScheduled);
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        if ((mCmdTidsInUse & ~mCmdTidsTimedOut & (1 << tid)) != 0)
+        {
+            earliest = std::min(earliest, mTransactions[tid].mDeadline);
+        }
+    }
+
+    VerifyOrExit(earliest != Timepoint::max());
+
+    mIsTransactionTimerScheduled = true;
+    mTaskRunner.Post(std::chrono::duration_cast<Milliseconds>(earliest - Clock::now()),
+                     [this]() { HandleTransactionTimeout(); });
 
-    mCmdTable[aTid]        = SPINEL_CMD_NOOP;
-    mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
+exit:
+    return;
 }
 
-otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+void NcpSpinel::HandleTransactionTimeout(void)
+{
+    Timepoint now = Clock::now();
+
+    mIsTransactionTimerScheduled = false;
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids; tid++)
+    {
+        Transaction &transaction = mTransactions[tid];
+
+        if ((mCmdTidsInUse & ~mCmdTidsTimedOut & (1 << tid)) == 0 || now < transaction.mDeadline)
+        {
+            continue;
+        }
+
+        otbrLogWarning("Request (cmd:%u, key:%u) timed out, tid:%u", transaction.mCmd, transaction.mKey, tid);
+        mTransactionMetrics.mTimedOut++;
+        mCmdTidsTimedOut |= (1 << tid);
+        CallAndClear(transaction.mAsyncTask, OT_ERROR_RESPONSE_TIMEOUT, "No response from NCP!");
+    }
+
+    ScheduleTransactionTimeout();
+
+    if (!mIp6TxQueue.empty())
+    {
+        SendQueuedIp6Packets();
+    }
+}
+
+otError NcpSpinel::SendCommand(spinel_command_t    aCmd,
+                               spinel_prop_key_t   aKey,
+                               const EncodingFunc &aEncodingFunc,
+                               AsyncTaskPtr        aAsyncTask)
 {
     otError      error  = OT_ERROR_NONE;
     spinel_tid_t tid    = GetNextTid();
@@ -611,19 +906,19 @@ otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, co
     SuccessOrExit(error = mEncoder.EndFrame());
     SuccessOrExit(error = SendEncodedFrame());
 
-    mCmdTable[tid]        = aCmd;
-    mWaitingKeyTable[tid] = aKey;
+    BeginTransaction(tid, aCmd, aKey, std::move(aAsyncTask));
+
 exit:
-    if (error != OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE && tid != 0)
     {
         FreeTidTableItem(tid);
     }
     return error;
 }
 
-otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
+otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc, AsyncTaskPtr aAsyncTask)
 {
-    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc);
+    return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc, std::move(aAsyncTask));
 }
 
 otError NcpSpinel::InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
@@ -639,17 +934,28 @@ otError NcpSpinel::RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aE
 otError NcpSpinel::SendEncodedFrame(void)
 {
     otError  error = OT_ERROR_NONE;
+    otError  removeError;
     uint8_t  frame[kTxBufferSize];
     uint16_t frameLength;
 
     SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
     frameLength = mNcpBuffer.OutFrameGetLength();
     VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame) == frameLength, error = OT_ERROR_FAILED);
-    SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
+    {
+        std::unique_lock<std::mutex> lock = LockTransport();
+
+        SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
+    }
 
 exit:
-    error = mNcpBuffer.OutFrameRemove();
-    return error;
+    // The frame is removed even if it couldn't be sent, without hiding the failure to send it.
+    removeError = mNcpBuffer.OutFrameRemove();
+    return (error != OT_ERROR_NONE) ? error : removeError;
+}
+
+std::unique_lock<std::mutex> NcpSpinel::LockTransport(void)
+{
+    return mTransportMutex != nullptr ? std::unique_lock<std::mutex>(*mTransportMutex) : std::unique_lock<std::mutex>();
 }
 
 otError NcpSpinel::ParseIp6AddressTable(const uint8_t               *aBuf,
@@ -711,7 +1017,7 @@ exit:
     return error;
 }
 
-otError NcpSpinel::ParseIp6StreamNet(const uint8_t *aBuf, uint8_t aLen, const uint8_t *&aData, uint16_t &aDataLen)
+otError NcpSpinel::ParseIp6StreamNet(const uint8_t *aBuf, uint16_t aLen, const uint8_t *&aData, uint16_t &aDataLen)
 {
     otError             error = OT_ERROR_NONE;
     ot::Spinel::Decoder decoder;
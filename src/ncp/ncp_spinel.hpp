@@ -34,8 +34,11 @@
 #ifndef OTBR_AGENT_NCP_SPINEL_HPP_
 #define OTBR_AGENT_NCP_SPINEL_HPP_
 
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <openthread/dataset.h>
 #include <openthread/error.h>
@@ -48,6 +51,7 @@
 #include "lib/spinel/spinel_encoder.hpp"
 
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "ncp/async_task.hpp"
 #include "ncp/posix/netif.hpp"
@@ -85,6 +89,39 @@ public:
     using NetifStateChangedCallback        = std::function<void(bool)>;
     using Ip6ReceiveCallback               = std::function<void(const uint8_t *, uint16_t)>;
 
+    /**
+     * This enumeration defines which packet is dropped when the IPv6 transmit queue is full.
+     */
+    enum class Ip6TxDropPolicy : uint8_t
+    {
+        kTailDrop,        ///< Drop the new packet.
+        kPrioritizeIcmp6, ///< Make room for a new ICMPv6 (e.g. ND and MLD) packet by dropping the oldest other packet.
+    };
+
+    /**
+     * This structure represents the counters of the IPv6 transmit path to the NCP.
+     */
+    struct Ip6TxCounters
+    {
+        uint64_t mSentPackets;    ///< The number of packets sent to the NCP.
+        uint64_t mQueuedPackets;  ///< The number of packets which had to wait in the queue while the NCP was busy.
+        uint64_t mDroppedPackets; ///< The number of packets dropped because the queue was full.
+        uint64_t mFailedPackets;  ///< The number of packets dropped because they couldn't be encoded or sent.
+        uint16_t mMaxQueueDepth;  ///< The maximum number of packets which were in the queue at the same time.
+    };
+
+    /**
+     * This structure represents the metrics of spinel transactions, i.e. requests and their responses.
+     */
+    struct TransactionMetrics
+    {
+        uint32_t         mSent;        ///< The number of requests sent to the NCP.
+        uint32_t         mCompleted;   ///< The number of requests which got a response.
+        uint32_t         mTimedOut;    ///< The number of requests which got no response in time.
+        uint8_t          mMaxInFlight; ///< The maximum number of requests in flight at the same time.
+        LatencyHistogram mLatency;     ///< The latency histogram of completed requests in microseconds.
+    };
+
     /**
      * Constructor.
      */
@@ -108,11 +145,28 @@ public:
      */
     const char *GetCoprocessorVersion(void) { return mSpinelDriver->GetVersion(); }
 
+    /**
+     * This method sets the lock to hold while sending frames to the NCP.
+     *
+     * It's used when another thread shares the spinel transport.
+     *
+     * @param[in] aMutex  A pointer to the lock, `nullptr` to send frames without a lock.
+     */
+    void SetTransportMutex(std::mutex *aMutex) { mTransportMutex = aMutex; }
+
+    /**
+     * This method handles a frame received from the NCP by another thread which owns the spinel transport.
+     *
+     * @param[in] aFrame   A pointer to the frame.
+     * @param[in] aLength  The length of the frame.
+     */
+    void HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength);
+
     /**
      * This method sets the active dataset on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed, the requests are pipelined and
+     * handled by the NCP in order.
      *
      * @param[in] aActiveOpDatasetTlvs  A reference to the active operational dataset of the Thread network.
      * @param[in] aAsyncTask            A pointer to an async result to receive the result of this operation.
@@ -134,8 +188,8 @@ public:
     /**
      * This method enableds/disables the IP6 on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed, the requests are pipelined and
+     * handled by the NCP in order.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -177,19 +231,51 @@ public:
     /**
      * This methods sends an IP6 datagram through the NCP.
      *
+     * While the NCP is busy, the datagram is queued and sent as soon as a transaction completes. Which datagram is
+     * dropped when the queue is full is set by `Ip6SetTxDropPolicy()`, ICMPv6 datagrams are prioritized by default.
+     *
      * @param[in] aData      A pointer to the beginning of the IP6 datagram.
      * @param[in] aLength    The length of the datagram.
      *
-     * @retval OTBR_ERROR_NONE  The datagram is sent to NCP successfully.
-     * @retval OTBR_ERROR_BUSY  NcpSpinel is busy with other requests.
+     * @retval OTBR_ERROR_NONE        The datagram is sent to NCP successfully or queued.
+     * @retval OTBR_ERROR_DROPPED     The datagram is dropped because the transmit queue is full.
+     * @retval OTBR_ERROR_OPENTHREAD  Failed to encode or send the datagram.
      */
     otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override;
 
+    /**
+     * This method sets which packet is dropped when the IPv6 transmit queue is full.
+     *
+     * @param[in] aPolicy  The drop policy.
+     */
+    void Ip6SetTxDropPolicy(Ip6TxDropPolicy aPolicy) { mIp6TxDropPolicy = aPolicy; }
+
+    /**
+     * This method returns the counters of the IPv6 transmit path.
+     *
+     * @returns The IPv6 transmit counters.
+     */
+    const Ip6TxCounters &GetIp6TxCounters(void) const { return mIp6TxCounters; }
+
+    /**
+     * This method returns the number of IPv6 packets waiting in the transmit queue.
+     *
+     * @returns The number of queued packets.
+     */
+    uint16_t GetIp6TxQueueDepth(void) const { return static_cast<uint16_t>(mIp6TxQueue.size()); }
+
+    /**
+     * This method returns the metrics of spinel transactions.
+     *
+     * @returns The transaction metrics.
+     */
+    const TransactionMetrics &GetTransactionMetrics(void) const { return mTransactionMetrics; }
+
     /**
      * This method enableds/disables the Thread network on the NCP.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed, the requests are pipelined and
+     * handled by the NCP in order.
      *
      * @param[in] aEnable     TRUE to enable and FALSE to disable.
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
@@ -209,8 +295,8 @@ public:
     /**
      * This method instructs the NCP to erase the persistent network info.
      *
-     * If this method is called again before the previous call completed, no action will be taken.
-     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     * This method may be called again before the previous call completed, the requests are pipelined and
+     * handled by the NCP in order.
      *
      * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
      */
@@ -229,7 +315,26 @@ public:
 private:
     using FailureHandler = std::function<void(otError)>;
 
-    static constexpr uint8_t kMaxTids = 16;
+    static constexpr uint8_t      kMaxTids             = 16;
+    static constexpr Milliseconds kResponseTimeout     = Milliseconds(2000);
+    static constexpr Milliseconds kSlowResponseTimeout = Milliseconds(10000);
+    static constexpr size_t       kIp6TxQueueMaxLength = 64;
+    static constexpr Milliseconds kIp6TxRetryDelay     = Milliseconds(5);
+
+    struct Transaction
+    {
+        spinel_command_t  mCmd;       ///< The command of the request.
+        spinel_prop_key_t mKey;       ///< The property key of the request.
+        AsyncTaskPtr      mAsyncTask; ///< The async result completed by the response, may be null.
+        Timepoint         mSentTime;  ///< The time when the request was sent.
+        Timepoint         mDeadline;  ///< The time when the request times out.
+    };
+
+    struct Ip6TxPacket
+    {
+        std::vector<uint8_t> mData;
+        bool                 mIsIcmp6;
+    };
 
     template <typename Function, typename... Args> static void SafeInvoke(Function &aFunc, Args &&...aArgs)
     {
@@ -280,28 +385,52 @@ private:
 
     otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded) override;
 
+    static Milliseconds GetResponseTimeout(spinel_command_t aCmd, spinel_prop_key_t aKey);
+
     spinel_tid_t GetNextTid(void);
+    uint8_t      GetNumTransactionsInFlight(void) const;
+    void         ReleaseTimedOutTids(spinel_tid_t aRespondedTid);
+    void         BeginTransaction(spinel_tid_t      aTid,
+                                  spinel_command_t  aCmd,
+                                  spinel_prop_key_t aKey,
+                                  AsyncTaskPtr      aAsyncTask);
     void         FreeTidTableItem(spinel_tid_t aTid);
+    void         ScheduleTransactionTimeout(void);
+    void         HandleTransactionTimeout(void);
 
     using EncodingFunc = std::function<otError(void)>;
-    otError SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
-    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
+    otError SendCommand(spinel_command_t    aCmd,
+                        spinel_prop_key_t   aKey,
+                        const EncodingFunc &aEncodingFunc,
+                        AsyncTaskPtr        aAsyncTask = nullptr);
+    otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc, AsyncTaskPtr aAsyncTask = nullptr);
     otError InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
 
     otError SendEncodedFrame(void);
 
+    std::unique_lock<std::mutex> LockTransport(void);
+
+    static bool IsIp6TxBusyError(otError aError) { return aError == OT_ERROR_BUSY || aError == OT_ERROR_NO_BUFS; }
+    static bool IsIcmp6Packet(const uint8_t *aData, uint16_t aLength);
+    otError     SendIp6Packet(const uint8_t *aData, uint16_t aLength);
+    otbrError   EnqueueIp6Packet(const uint8_t *aData, uint16_t aLength);
+    void        SendQueuedIp6Packets(void);
+    void        ScheduleIp6TxRetry(void);
+
     otError ParseIp6AddressTable(const uint8_t *aBuf, uint16_t aLength, std::vector<Ip6AddressInfo> &aAddressTable);
     otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint8_t aLen, std::vector<Ip6Address> &aAddressList);
-    otError ParseIp6StreamNet(const uint8_t *aBuf, uint8_t aLen, const uint8_t *&aData, uint16_t &aDataLen);
+    otError ParseIp6StreamNet(const uint8_t *aBuf, uint16_t aLen, const uint8_t *&aData, uint16_t &aDataLen);
 
     ot::Spinel::SpinelDriver *mSpinelDriver;
-    uint16_t                  mCmdTidsInUse; ///< Used transaction ids.
-    spinel_tid_t              mCmdNextTid;   ///< Next available transaction id.
+    std::mutex               *mTransportMutex;
+    uint16_t                  mCmdTidsInUse;    ///< Used transaction ids.
+    uint16_t                  mCmdTidsTimedOut; ///< Used transaction ids whose requests timed out.
+    spinel_tid_t              mCmdNextTid;      ///< Next available transaction id.
 
-    spinel_prop_key_t mWaitingKeyTable[kMaxTids]; ///< The property keys of ongoing transactions.
-    spinel_command_t  mCmdTable[kMaxTids];        ///< The mapping of spinel command and tids when the response
-                                                  ///< is LAST_STATUS.
+    Transaction        mTransactions[kMaxTids]; ///< The ongoing transactions indexed by tids.
+    TransactionMetrics mTransactionMetrics;
+    bool               mIsTransactionTimerScheduled;
 
     static constexpr uint16_t kTxBufferSize = 2048;
     uint8_t                   mTxBuffer[kTxBufferSize];
@@ -313,17 +442,20 @@ private:
 
     PropsObserver *mPropsObserver;
 
-    AsyncTaskPtr mDatasetSetActiveTask;
+    // These operations are completed by notifications rather than by the
+    // responses of their requests, so only one of each may be ongoing.
     AsyncTaskPtr mDatasetMgmtSetPendingTask;
-    AsyncTaskPtr mIp6SetEnabledTask;
-    AsyncTaskPtr mThreadSetEnabledTask;
     AsyncTaskPtr mThreadDetachGracefullyTask;
-    AsyncTaskPtr mThreadErasePersistentInfoTask;
 
     Ip6AddressTableCallback          mIp6AddressTableCallback;
     Ip6MulticastAddressTableCallback mIp6MulticastAddressTableCallback;
     Ip6ReceiveCallback               mIp6ReceiveCallback;
     NetifStateChangedCallback        mNetifStateChangedCallback;
+
+    std::deque<Ip6TxPacket> mIp6TxQueue;
+    Ip6TxDropPolicy         mIp6TxDropPolicy;
+    Ip6TxCounters           mIp6TxCounters;
+    bool                    mIsIp6TxRetryScheduled;
 };
 
 } // namespace Ncp
@@ -44,6 +44,9 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <functional>
+#include <inttypes.h>
+#include <iterator>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
@@ -68,6 +71,29 @@ otbrError Netif::Dependencies::Ip6MulAddrUpdateSubscription(const otIp6Address &
     return OTBR_ERROR_NONE;
 }
 
+constexpr Milliseconds Netif::kTunLogInterval;
+
+// Finds the elements which are only in `aOld` and those which are only in
+// `aNew` by sorting copies of both lists, instead of searching one list for
+// each element of the other.
+template <typename T, typename Less>
+static void DiffLists(std::vector<T>  aOld,
+                      std::vector<T>  aNew,
+                      Less            aLess,
+                      std::vector<T> &aRemoved,
+                      std::vector<T> &aAdded)
+{
+    auto isEqual = [&aLess](const T &aLhs, const T &aRhs) { return !aLess(aLhs, aRhs) && !aLess(aRhs, aLhs); };
+
+    std::sort(aOld.begin(), aOld.end(), aLess);
+    aOld.erase(std::unique(aOld.begin(), aOld.end(), isEqual), aOld.end());
+    std::sort(aNew.begin(), aNew.end(), aLess);
+    aNew.erase(std::unique(aNew.begin(), aNew.end(), isEqual), aNew.end());
+
+    std::set_difference(aOld.begin(), aOld.end(), aNew.begin(), aNew.end(), std::back_inserter(aRemoved), aLess);
+    std::set_difference(aNew.begin(), aNew.end(), aOld.begin(), aOld.end(), std::back_inserter(aAdded), aLess);
+}
+
 OT_TOOL_PACKED_BEGIN
 struct Mldv2Header
 {
@@ -102,8 +128,12 @@ Netif::Netif(Dependencies &aDependencies)
     , mNetlinkFd(-1)
     , mMldFd(-1)
     , mNetlinkSequence(0)
+    , mIsTunIoDelegated(false)
     , mNetifIndex(0)
     , mDeps(aDependencies)
+    , mTunCounters()
+    , mLoggedTunCounters()
+    , mTunLogTime()
 {
 }
 
@@ -139,7 +169,7 @@ void Netif::Deinit(void)
 
 void Netif::Process(const MainloopContext *aContext)
 {
-    if (FD_ISSET(mTunFd, &aContext->mErrorFdSet))
+    if (!mIsTunIoDelegated && FD_ISSET(mTunFd, &aContext->mErrorFdSet))
     {
         close(mTunFd);
         DieNow("Error on Tun Fd!");
@@ -151,7 +181,7 @@ void Netif::Process(const MainloopContext *aContext)
         DieNow("Error on MLD Fd!");
     }
 
-    if (FD_ISSET(mTunFd, &aContext->mReadFdSet))
+    if (!mIsTunIoDelegated && FD_ISSET(mTunFd, &aContext->mReadFdSet))
     {
         ProcessIp6Send();
     }
@@ -169,32 +199,39 @@ void Netif::UpdateFdSet(MainloopContext *aContext)
     assert(mIpFd >= 0);
     assert(mMldFd >= 0);
 
-    aContext->AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+    if (!mIsTunIoDelegated)
+    {
+        aContext->AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+    }
     aContext->AddFdToSet(mMldFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
 }
 
 void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrInfos)
 {
-    // Remove stale addresses
-    for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddresses)
+    std::vector<Ip6AddressInfo> removedAddrs;
+    std::vector<Ip6AddressInfo> addedAddrs;
+
+    // An address whose prefix length or flags changed is removed and added again.
+    DiffLists(
+        mIp6UnicastAddresses, aAddrInfos,
+        [](const Ip6AddressInfo &aLhs, const Ip6AddressInfo &aRhs) {
+            return memcmp(&aLhs, &aRhs, sizeof(Ip6AddressInfo)) < 0;
+        },
+        removedAddrs, addedAddrs);
+
+    for (const Ip6AddressInfo &addrInfo : removedAddrs)
     {
-        if (std::find(aAddrInfos.begin(), aAddrInfos.end(), addrInfo) == aAddrInfos.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, false);
-        }
+        otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
     }
 
-    // Add new addresses
-    for (const Ip6AddressInfo &addrInfo : aAddrInfos)
+    for (const Ip6AddressInfo &addrInfo : addedAddrs)
     {
-        if (std::find(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo) == mIp6UnicastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, true);
-        }
+        otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
+    }
+
+    if (!removedAddrs.empty() || !addedAddrs.empty())
+    {
+        ProcessUnicastAddressChanges(removedAddrs, addedAddrs);
     }
 
     mIp6UnicastAddresses.assign(aAddrInfos.begin(), aAddrInfos.end());
@@ -202,27 +239,24 @@ void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrIn
 
 otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError               error = OTBR_ERROR_NONE;
+    std::vector<Ip6Address> removedAddrs;
+    std::vector<Ip6Address> addedAddrs;
+
+    DiffLists(mIp6MulticastAddresses, aAddrs, std::less<Ip6Address>(), removedAddrs, addedAddrs);
 
     // Remove stale addresses
-    for (const Ip6Address &address : mIp6MulticastAddresses)
+    for (const Ip6Address &address : removedAddrs)
     {
-        if (std::find(aAddrs.begin(), aAddrs.end(), address) == aAddrs.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
-        }
+        otbrLogInfo("Remove address: %s", address.ToString().c_str());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
     }
 
     // Add new addresses
-    for (const Ip6Address &address : aAddrs)
+    for (const Ip6Address &address : addedAddrs)
     {
-        if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), address) ==
-            mIp6MulticastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
-        }
+        otbrLogInfo("Add address: %s", address.ToString().c_str());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
     }
 
     mIp6MulticastAddresses.assign(aAddrs.begin(), aAddrs.end());
@@ -295,33 +329,100 @@ void Netif::Ip6Receive(const uint8_t *aBuf, uint16_t aLen)
     VerifyOrExit(aLen <= kIp6Mtu, error = OTBR_ERROR_DROPPED);
     VerifyOrExit(mTunFd > 0, error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Packet from NCP (%u bytes)", aLen);
+    // `aBuf` points into the received spinel frame, so the packet is written without being copied. Each write to
+    // the TUN device is taken as exactly one packet, so packets can't be coalesced into a single `writev()`.
     VerifyOrExit(write(mTunFd, aBuf, aLen) == aLen, error = OTBR_ERROR_ERRNO);
 
+    mTunCounters.mReceivedPackets++;
+    mTunCounters.mReceivedBytes += aLen;
+
 exit:
-    if (error != OTBR_ERROR_NONE)
+    if (error == OTBR_ERROR_ERRNO)
     {
-        otbrLogWarning("Failed to receive, error:%s", otbrErrorString(error));
+        mTunCounters.mWriteErrors++;
+        otbrLogDebug("Failed to write to Tun Fd: %s", strerror(errno));
     }
+    else if (error != OTBR_ERROR_NONE)
+    {
+        mTunCounters.mReceiveDropped++;
+    }
+    LogTunCounters();
 }
 
 void Netif::ProcessIp6Send(void)
 {
-    ssize_t   rval;
-    uint8_t   packet[kIp6Mtu];
-    otbrError error = OTBR_ERROR_NONE;
+    uint8_t packet[kIp6Mtu];
+    size_t  numPackets = 0;
+    size_t  numBytes   = 0;
+
+    // Drains the TUN queue within the budget, so that a burst of host
+    // traffic takes one mainloop iteration per batch instead of one per
+    // packet. `Ip6Send()` copies the packet, so the buffer is reused.
+    while (numPackets < kMaxTunPacketsPerProcess && numBytes < kMaxTunBytesPerProcess)
+    {
+        ssize_t rval = read(mTunFd, packet, sizeof(packet));
 
-    rval = read(mTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+        if (rval <= 0)
+        {
+            if (rval < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                mTunCounters.mReadErrors++;
+                otbrLogDebug("Error reading from Tun Fd: %s", strerror(errno));
+            }
+            ExitNow();
+        }
 
-    otbrLogInfo("Send packet (%hu bytes)", static_cast<uint16_t>(rval));
+        numPackets++;
+        numBytes += static_cast<size_t>(rval);
 
-    error = mDeps.Ip6Send(packet, rval);
-exit:
-    if (error == OTBR_ERROR_ERRNO)
-    {
-        otbrLogInfo("Error reading from Tun Fd: %s", strerror(errno));
+        if (mDeps.Ip6Send(packet, static_cast<uint16_t>(rval)) != OTBR_ERROR_NONE)
+        {
+            mTunCounters.mSendDropped++;
+        }
     }
+
+    mTunCounters.mBudgetExhausted++;
+
+exit:
+    mTunCounters.mSentPackets += numPackets;
+    mTunCounters.mSentBytes += numBytes;
+    LogTunCounters();
+}
+
+void Netif::LogTunCounters(void)
+{
+    Timepoint now = Clock::now();
+
+    // Logs what happened since the last report at most once per interval
+    // rather than once per packet.
+    VerifyOrExit(now - mTunLogTime >= kTunLogInterval);
+    VerifyOrExit(memcmp(&mTunCounters, &mLoggedTunCounters, sizeof(mTunCounters)) != 0);
+
+    otbrLogInfo("Sent %" PRIu64 " packets (%" PRIu64 " bytes), dropped %" PRIu64 ", read errors %" PRIu64
+                ", budget exhausted %" PRIu64 " times",
+                mTunCounters.mSentPackets - mLoggedTunCounters.mSentPackets,
+                mTunCounters.mSentBytes - mLoggedTunCounters.mSentBytes,
+                mTunCounters.mSendDropped - mLoggedTunCounters.mSendDropped,
+                mTunCounters.mReadErrors - mLoggedTunCounters.mReadErrors,
+                mTunCounters.mBudgetExhausted - mLoggedTunCounters.mBudgetExhausted);
+    otbrLogInfo("Received %" PRIu64 " packets (%" PRIu64 " bytes), dropped %" PRIu64 ", write errors %" PRIu64,
+                mTunCounters.mReceivedPackets - mLoggedTunCounters.mReceivedPackets,
+                mTunCounters.mReceivedBytes - mLoggedTunCounters.mReceivedBytes,
+                mTunCounters.mReceiveDropped - mLoggedTunCounters.mReceiveDropped,
+                mTunCounters.mWriteErrors - mLoggedTunCounters.mWriteErrors);
+
+    mLoggedTunCounters = mTunCounters;
+    mTunLogTime        = now;
+
+exit:
+    return;
+}
+
+int Netif::DelegateTunIo(void)
+{
+    mIsTunIoDelegated = true;
+
+    return mTunFd;
 }
 
 void Netif::Clear(void)
@@ -331,6 +432,7 @@ void Netif::Clear(void)
         close(mTunFd);
         mTunFd = -1;
     }
+    mIsTunIoDelegated = false;
 
     if (mIpFd != -1)
     {
@@ -350,7 +452,9 @@ void Netif::Clear(void)
         mMldFd = -1;
     }
 
-    mNetifIndex = 0;
+    mNetifIndex        = 0;
+    mTunCounters       = TunCounters();
+    mLoggedTunCounters = TunCounters();
     mIp6UnicastAddresses.clear();
     mIp6MulticastAddresses.clear();
 }
@@ -42,6 +42,7 @@
 #include <openthread/ip6.h>
 
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -58,6 +59,23 @@ public:
         virtual otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded);
     };
 
+    /**
+     * This structure represents the counters of packets exchanged between the host and Thread through the TUN device.
+     */
+    struct TunCounters
+    {
+        uint64_t mSentPackets;     ///< The number of packets read from the TUN device.
+        uint64_t mSentBytes;       ///< The number of bytes of these packets.
+        uint64_t mSendDropped;     ///< The number of packets dropped because `Ip6Send()` failed.
+        uint64_t mReadErrors;      ///< The number of failed reads, not counting reads from an empty queue.
+        uint64_t mBudgetExhausted; ///< The number of times draining stopped with packets possibly left in the queue.
+        uint64_t mReceivedPackets; ///< The number of packets from Thread written to the TUN device.
+        uint64_t mReceivedBytes;   ///< The number of bytes of these packets.
+        uint64_t mReceiveDropped;  ///< The number of packets from Thread dropped because they are too large or the
+                                   ///< TUN device isn't ready.
+        uint64_t mWriteErrors;     ///< The number of failed or partial writes to the TUN device.
+    };
+
     Netif(Dependencies &aDependencies);
 
     otbrError Init(const std::string &aInterfaceName);
@@ -71,10 +89,29 @@ public:
 
     void Ip6Receive(const uint8_t *aBuf, uint16_t aLen);
 
+    /**
+     * This method hands the TUN device over to another thread, the netif doesn't read the TUN device after that.
+     *
+     * The TUN device is still closed by `Deinit()`.
+     *
+     * @returns The file descriptor of the TUN device.
+     */
+    int DelegateTunIo(void);
+
+    const TunCounters &GetTunCounters(void) const { return mTunCounters; }
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
     static constexpr size_t kIp6Mtu = 1280;
 
+    // The budget of one `ProcessIp6Send()` call. Packets beyond it are
+    // left in the TUN queue for the next mainloop iteration so that a
+    // burst of host traffic doesn't starve the other processors.
+    static constexpr size_t kMaxTunPacketsPerProcess = 64;
+    static constexpr size_t kMaxTunBytesPerProcess   = 32 * kIp6Mtu;
+
+    static constexpr Milliseconds kTunLogInterval = Milliseconds(1000);
+
     void Clear(void);
 
     otbrError CreateTunDevice(const std::string &aInterfaceName);
@@ -83,9 +120,11 @@ private:
 
     void      PlatformSpecificInit(void);
     void      SetAddrGenModeToNone(void);
-    void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
+    void      ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrs,
+                                           const std::vector<Ip6AddressInfo> &aAddedAddrs);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
     void      ProcessIp6Send(void);
+    void      LogTunCounters(void);
     void      ProcessMldEvent(void);
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
@@ -93,6 +132,7 @@ private:
     int      mNetlinkFd;       ///< Used to receive netlink events.
     int      mMldFd;           ///< Used to receive MLD events.
     uint32_t mNetlinkSequence; ///< Netlink message sequence.
+    bool     mIsTunIoDelegated;
 
     unsigned int mNetifIndex;
     std::string  mNetifName;
@@ -100,6 +140,10 @@ private:
     std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
     std::vector<Ip6Address>     mIp6MulticastAddresses;
     Dependencies               &mDeps;
+
+    TunCounters mTunCounters;
+    TunCounters mLoggedTunCounters;
+    Timepoint   mTunLogTime;
 };
 
 } // namespace otbr
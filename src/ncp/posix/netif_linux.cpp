@@ -33,6 +33,7 @@
 #include "netif.hpp"
 
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <linux/if.h>
 #include <linux/if_tun.h>
@@ -43,6 +44,8 @@
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
@@ -74,6 +77,118 @@ static struct rtattr *AddRtAttr(nlmsghdr *aHeader, uint32_t aMaxLen, uint8_t aTy
     return rta;
 }
 
+namespace {
+
+struct AddressChange
+{
+    const Ip6AddressInfo *mAddressInfo;
+    bool                  mIsAdded;
+};
+
+// The maximum number of address requests in one netlink message. Each
+// request is acknowledged, so this also bounds the number of queued
+// acknowledgements in the receive buffer of the netlink socket.
+constexpr size_t kMaxNetlinkBatchSize = 64;
+
+void AppendAddressRequest(std::vector<uint8_t> &aBatch, const AddressChange &aChange, uint32_t aSeq, unsigned aIndex)
+{
+    struct
+    {
+        nlmsghdr  nh;
+        ifaddrmsg ifa;
+        char      buf[512];
+    } req;
+
+    const Ip6AddressInfo &addrInfo = *aChange.mAddressInfo;
+
+    memset(&req, 0, sizeof(req));
+
+    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
+    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aChange.mIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    req.nh.nlmsg_type  = aChange.mIsAdded ? RTM_NEWADDR : RTM_DELADDR;
+    req.nh.nlmsg_pid   = 0;
+    req.nh.nlmsg_seq   = aSeq;
+
+    req.ifa.ifa_family    = AF_INET6;
+    req.ifa.ifa_prefixlen = addrInfo.mPrefixLength;
+    req.ifa.ifa_flags     = IFA_F_NODAD;
+    req.ifa.ifa_scope     = addrInfo.mScope;
+    req.ifa.ifa_index     = aIndex;
+
+    AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &addrInfo.mAddress, sizeof(addrInfo.mAddress));
+
+    if (!addrInfo.mPreferred || addrInfo.mMeshLocal)
+    {
+        ifa_cacheinfo cacheinfo;
+
+        memset(&cacheinfo, 0, sizeof(cacheinfo));
+        cacheinfo.ifa_valid = UINT32_MAX;
+
+        AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+    }
+
+    {
+        const uint8_t *begin = reinterpret_cast<const uint8_t *>(&req);
+
+        req.nh.nlmsg_len = NLMSG_ALIGN(req.nh.nlmsg_len);
+        aBatch.insert(aBatch.end(), begin, begin + req.nh.nlmsg_len);
+    }
+}
+
+void ReceiveAddressAcks(int aNetlinkFd, const AddressChange *aChanges, size_t aNumChanges, uint32_t aFirstSeq)
+{
+    size_t numAcks = 0;
+    char   buffer[8192];
+
+    // rtnetlink handles the requests while they are sent, so the acknowledgements are
+    // already queued unless the receive buffer overflowed. Address events of the
+    // subscribed groups are skipped.
+    while (numAcks < aNumChanges)
+    {
+        int len = static_cast<int>(recv(aNetlinkFd, buffer, sizeof(buffer), MSG_DONTWAIT));
+
+        if (len < 0)
+        {
+            if (errno == EINTR || errno == ENOBUFS)
+            {
+                continue;
+            }
+            break;
+        }
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, static_cast<unsigned>(len));
+             header           = NLMSG_NEXT(header, len))
+        {
+            uint32_t        index = header->nlmsg_seq - aFirstSeq;
+            const nlmsgerr *ack   = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+            if (header->nlmsg_type != NLMSG_ERROR || index >= aNumChanges)
+            {
+                continue;
+            }
+
+            numAcks++;
+
+            if (ack->error != 0)
+            {
+                const AddressChange &change = aChanges[index];
+
+                otbrLogWarning("Failed to %s %s/%u: %s", (change.mIsAdded ? "add" : "remove"),
+                               Ip6Address(change.mAddressInfo->mAddress).ToString().c_str(),
+                               change.mAddressInfo->mPrefixLength, strerror(-ack->error));
+            }
+        }
+    }
+
+    if (numAcks < aNumChanges)
+    {
+        otbrLogWarning("Missing %zu acknowledgements of requests#%u-%u", aNumChanges - numAcks, aFirstSeq,
+                       aFirstSeq + static_cast<uint32_t>(aNumChanges) - 1);
+    }
+}
+
+} // namespace
+
 otbrError Netif::CreateTunDevice(const std::string &aInterfaceName)
 {
     ifreq     ifr;
@@ -195,51 +310,46 @@ void Netif::SetAddrGenModeToNone(void)
     }
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrs,
+                                         const std::vector<Ip6AddressInfo> &aAddedAddrs)
 {
-    struct
-    {
-        nlmsghdr  nh;
-        ifaddrmsg ifa;
-        char      buf[512];
-    } req;
+    std::vector<AddressChange> changes;
+    std::vector<uint8_t>       batch;
 
     assert(mIpFd >= 0);
-    memset(&req, 0, sizeof(req));
-
-    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
-    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
-    req.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
-    req.nh.nlmsg_pid   = 0;
-    req.nh.nlmsg_seq   = ++mNetlinkSequence;
-
-    req.ifa.ifa_family    = AF_INET6;
-    req.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
-    req.ifa.ifa_flags     = IFA_F_NODAD;
-    req.ifa.ifa_scope     = aAddressInfo.mScope;
-    req.ifa.ifa_index     = mNetifIndex;
-
-    AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
 
-    if (!aAddressInfo.mPreferred || aAddressInfo.mMeshLocal)
+    for (const Ip6AddressInfo &addrInfo : aRemovedAddrs)
     {
-        ifa_cacheinfo cacheinfo;
-
-        memset(&cacheinfo, 0, sizeof(cacheinfo));
-        cacheinfo.ifa_valid = UINT32_MAX;
-
-        AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
+        changes.push_back({&addrInfo, /* aIsAdded */ false});
     }
 
-    if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
+    for (const Ip6AddressInfo &addrInfo : aAddedAddrs)
     {
-        otbrLogInfo("Sent request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                    Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        changes.push_back({&addrInfo, /* aIsAdded */ true});
     }
-    else
+
+    // The requests are sent as multi-part netlink messages, so that an update takes one system call per batch
+    // rather than one per address.
+    for (size_t begin = 0; begin < changes.size(); begin += kMaxNetlinkBatchSize)
     {
-        otbrLogWarning("Failed to send request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                       Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        size_t   end      = std::min(changes.size(), begin + kMaxNetlinkBatchSize);
+        uint32_t firstSeq = mNetlinkSequence + 1;
+
+        batch.clear();
+        for (size_t i = begin; i < end; i++)
+        {
+            AppendAddressRequest(batch, changes[i], ++mNetlinkSequence, mNetifIndex);
+        }
+
+        if (send(mNetlinkFd, batch.data(), batch.size(), 0) == -1)
+        {
+            otbrLogWarning("Failed to send requests#%u-%u to update %zu addresses: %s", firstSeq, mNetlinkSequence,
+                           end - begin, strerror(errno));
+            continue;
+        }
+
+        otbrLogInfo("Sent requests#%u-%u to update %zu addresses", firstSeq, mNetlinkSequence, end - begin);
+        ReceiveAddressAcks(mNetlinkFd, &changes[begin], end - begin, firstSeq);
     }
 }
 
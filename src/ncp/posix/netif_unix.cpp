@@ -58,10 +58,11 @@ void Netif::PlatformSpecificInit(void)
     /* Empty */
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrs,
+                                         const std::vector<Ip6AddressInfo> &aAddedAddrs)
 {
-    OTBR_UNUSED_VARIABLE(aAddressInfo);
-    OTBR_UNUSED_VARIABLE(aIsAdded);
+    OTBR_UNUSED_VARIABLE(aRemovedAddrs);
+    OTBR_UNUSED_VARIABLE(aAddedAddrs);
 }
 
 } // namespace otbr
@@ -37,7 +37,10 @@
 #include <mutex>
 
 #include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
 #include <sys/eventfd.h>
+#include <unistd.h>
 
 #include <openthread/commissioner.h>
 #include <openthread/thread.h>
@@ -59,16 +62,28 @@ const static int XPANID_LENGTH     = 64;
 const static int NETWORKKEY_LENGTH = 64;
 
 UbusServer::UbusServer(Ncp::RcpHost *aHost, std::mutex *aMutex)
-    : mIfFinishScan(false)
+    : mScanPending(false)
+    , mScanList(nullptr)
     , mContext(nullptr)
     , mSockPath(nullptr)
     , mHost(aHost)
     , mHostMutex(aMutex)
     , mSecond(0)
-{
+    , mSnapshotVersion(0)
+    , mStallCount(0)
+    , mStallTotalTime(0)
+    , mStallMaxTime(0)
+{
+    memset(&mScanRequest, 0, sizeof(mScanRequest));
+    memset(&mScanDoneFd, 0, sizeof(mScanDoneFd));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
 
+    mScanDoneFd.fd = -1;
+    mScanDoneFd.cb = HandleScanDone;
+
+    blob_buf_init(&mScanBuf, 0);
     blob_buf_init(&mBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
 }
@@ -207,6 +222,7 @@ static const struct ubus_method otbrMethods[] = {
     {"joineradd", &UbusServer::UbusJoinerAddHandler, 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
     {"mgmtset", &UbusServer::UbusMgmtsetHandler, 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
     {"interfacename", &UbusServer::UbusInterfaceNameHandler, 0, 0, nullptr, 0},
+    {"mainloopstall", &UbusServer::UbusMainloopStallHandler, 0, 0, nullptr, 0},
 };
 
 static struct ubus_object_type otbrObjType = {"otbr_prog", 0, otbrMethods, ARRAY_SIZE(otbrMethods)};
@@ -223,18 +239,26 @@ static struct ubus_object otbr = {
     n_methods : ARRAY_SIZE(otbrMethods),
 };
 
-void UbusServer::ProcessScan(void)
+otError UbusServer::ProcessScan(void)
 {
     otError  error        = OT_ERROR_NONE;
     uint32_t scanChannels = 0;
     uint16_t scanDuration = 0;
+    uint64_t eventNum     = 1;
 
     mHostMutex->lock();
     SuccessOrExit(error = otLinkActiveScan(mHost->GetInstance(), scanChannels, scanDuration,
                                            &UbusServer::HandleActiveScanResult, this));
+
+    // Wakes up the mainloop, which may be waiting without timeout, to process the scan.
+    if (write(sUbusEfd, &eventNum, sizeof(uint64_t)) != sizeof(uint64_t))
+    {
+        otbrLogWarning("Failed to wake up the mainloop for the scan: %s", strerror(errno));
+    }
+
 exit:
     mHostMutex->unlock();
-    return;
+    return error;
 }
 
 void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
@@ -267,28 +291,59 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
+        uint64_t eventNum = 1;
+
+        // The results are sent by the ubus thread, as the ubus context isn't thread safe.
+        blobmsg_close_array(&mScanBuf, mScanList);
+        if (write(mScanDoneFd.fd, &eventNum, sizeof(uint64_t)) != sizeof(uint64_t))
+        {
+            otbrLogWarning("Failed to notify the end of the scan: %s", strerror(errno));
+        }
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
 
     sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_string(&mScanBuf, "PanId", panidstring);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
 
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_close_table(&mScanBuf, jsonList);
+
+exit:
+    return;
+}
+
+void UbusServer::HandleScanDone(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    OT_UNUSED_VARIABLE(aEvents);
+
+    uint64_t eventNum;
+
+    if (read(aFd->fd, &eventNum, sizeof(uint64_t)) == sizeof(uint64_t))
+    {
+        GetInstance().HandleScanDoneDetail();
+    }
+}
+
+void UbusServer::HandleScanDoneDetail(void)
+{
+    VerifyOrExit(mScanPending);
+
+    mScanPending = false;
+    blobmsg_add_u16(&mScanBuf, "Error", OT_ERROR_NONE);
+    ubus_send_reply(mContext, &mScanRequest, mScanBuf.head);
+    ubus_complete_deferred_request(mContext, &mScanRequest, UBUS_STATUS_OK);
 
 exit:
     return;
@@ -313,31 +368,25 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    VerifyOrExit(!mScanPending, error = OT_ERROR_BUSY);
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+    // The results are collected by the mainloop thread while this thread keeps serving other requests.
+    blob_buf_init(&mScanBuf, 0);
+    mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    SuccessOrExit(error = ProcessScan());
 
-    while (!mIfFinishScan)
-    {
-        sleep(1);
-    }
+    ubus_defer_request(aContext, aRequest, &mScanRequest);
+    mScanPending = true;
 
 exit:
-    AppendResult(error, aContext, aRequest);
+    if (error != OT_ERROR_NONE)
+    {
+        blob_buf_init(&mBuf, 0);
+        AppendResult(error, aContext, aRequest);
+    }
     return 0;
 }
 
@@ -602,6 +651,19 @@ int UbusServer::UbusInterfaceNameHandler(struct ubus_context      *aContext,
     return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "interfacename");
 }
 
+int UbusServer::UbusMainloopStallHandler(struct ubus_context      *aContext,
+                                         struct ubus_object       *aObj,
+                                         struct ubus_request_data *aRequest,
+                                         const char               *aMethod,
+                                         struct blob_attr         *aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    return GetInstance().UbusMainloopStall(aContext, aRequest);
+}
+
 int UbusServer::UbusJoinerAddHandler(struct ubus_context      *aContext,
                                      struct ubus_object       *aObj,
                                      struct ubus_request_data *aRequest,
@@ -1083,96 +1145,59 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError error = OT_ERROR_NONE;
+    otError                                    error = OT_ERROR_NONE;
+    std::unique_lock<std::mutex>               hostLock(*mHostMutex, std::defer_lock);
+    std::shared_ptr<const InformationSnapshot> snapshot = std::atomic_load(&mSnapshot);
 
     blob_buf_init(&mBuf, 0);
 
-    mHostMutex->lock();
+    // The information published in the snapshot is served without the host mutex, so that readers don't wait for
+    // (nor stall) the mainloop. The other requests still query OpenThread under the mutex.
     if (!strcmp(aAction, "networkname"))
-        blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mHost->GetInstance()));
+        blobmsg_add_string(&mBuf, "NetworkName", snapshot->mNetworkName.c_str());
     else if (!strcmp(aAction, "interfacename"))
     {
-        blobmsg_add_string(&mBuf, "InterfaceName", mHost->GetInterfaceName());
+        blobmsg_add_string(&mBuf, "InterfaceName", snapshot->mInterfaceName.c_str());
     }
     else if (!strcmp(aAction, "state"))
     {
-        char state[10];
-        GetState(mHost->GetInstance(), state);
-        blobmsg_add_string(&mBuf, "State", state);
+        blobmsg_add_string(&mBuf, "State", snapshot->mState.c_str());
     }
     else if (!strcmp(aAction, "channel"))
-        blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mHost->GetInstance()));
+        blobmsg_add_u32(&mBuf, "Channel", snapshot->mChannel);
     else if (!strcmp(aAction, "panid"))
     {
-        char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mHost->GetInstance()));
-        blobmsg_add_string(&mBuf, "PanId", panIdString);
+        blobmsg_add_string(&mBuf, "PanId", snapshot->mPanId.c_str());
     }
     else if (!strcmp(aAction, "rloc16"))
     {
-        char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mHost->GetInstance()));
-        blobmsg_add_string(&mBuf, "rloc16", rloc);
+        blobmsg_add_string(&mBuf, "rloc16", snapshot->mRloc16.c_str());
     }
     else if (!strcmp(aAction, "networkkey"))
     {
-        char         outputKey[NETWORKKEY_LENGTH] = "";
-        otNetworkKey key;
-
-        otThreadGetNetworkKey(mHost->GetInstance(), &key);
-        OutputBytes(key.m8, OT_NETWORK_KEY_SIZE, outputKey);
-        blobmsg_add_string(&mBuf, "Networkkey", outputKey);
+        blobmsg_add_string(&mBuf, "Networkkey", snapshot->mNetworkKey.c_str());
     }
     else if (!strcmp(aAction, "pskc"))
     {
-        char   outputPskc[NETWORKKEY_LENGTH] = "";
-        otPskc pskc;
-
-        otThreadGetPskc(mHost->GetInstance(), &pskc);
-        OutputBytes(pskc.m8, OT_PSKC_MAX_SIZE, outputPskc);
-        blobmsg_add_string(&mBuf, "pskc", outputPskc);
+        blobmsg_add_string(&mBuf, "pskc", snapshot->mPskc.c_str());
     }
     else if (!strcmp(aAction, "extpanid"))
     {
-        char           outputExtPanId[XPANID_LENGTH] = "";
-        const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mHost->GetInstance()));
-        OutputBytes(extPanId, OT_EXT_PAN_ID_SIZE, outputExtPanId);
-        blobmsg_add_string(&mBuf, "ExtPanId", outputExtPanId);
+        blobmsg_add_string(&mBuf, "ExtPanId", snapshot->mExtPanId.c_str());
     }
     else if (!strcmp(aAction, "mode"))
     {
-        otLinkModeConfig linkMode;
-        char             mode[5] = "";
-
-        memset(&linkMode, 0, sizeof(otLinkModeConfig));
-
-        linkMode = otThreadGetLinkMode(mHost->GetInstance());
-
-        if (linkMode.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
-
-        if (linkMode.mDeviceType)
-        {
-            strcat(mode, "d");
-        }
-
-        if (linkMode.mNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+        blobmsg_add_string(&mBuf, "Mode", snapshot->mMode.c_str());
     }
     else if (!strcmp(aAction, "partitionid"))
     {
-        blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(mHost->GetInstance()));
+        blobmsg_add_u32(&mBuf, "Partitionid", snapshot->mPartitionId);
     }
     else if (!strcmp(aAction, "leaderdata"))
     {
-        otLeaderData leaderData;
+        const otLeaderData &leaderData = snapshot->mLeaderData;
 
-        SuccessOrExit(error = otThreadGetLeaderData(mHost->GetInstance(), &leaderData));
+        SuccessOrExit(error = snapshot->mLeaderDataError);
 
         sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
 
@@ -1186,6 +1211,7 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
     }
     else if (!strcmp(aAction, "networkdata"))
     {
+        hostLock.lock();
         ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
         if (time(nullptr) - mSecond > 10)
         {
@@ -1219,6 +1245,7 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
         int          joinerNum       = 0;
         char         eui64[EXTPANID] = "";
 
+        hostLock.lock();
         blob_buf_init(&mBuf, 0);
 
         jsonArray = blobmsg_open_array(&mBuf, "joinerList");
@@ -1257,7 +1284,10 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
     }
     else if (!strcmp(aAction, "macfilterstate"))
     {
-        otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mHost->GetInstance());
+        otMacFilterAddressMode mode;
+
+        hostLock.lock();
+        mode = otLinkFilterGetAddressMode(mHost->GetInstance());
 
         blob_buf_init(&mBuf, 0);
 
@@ -1283,6 +1313,7 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
         otMacFilterEntry    entry;
         otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
 
+        hostLock.lock();
         blob_buf_init(&mBuf, 0);
 
         sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
@@ -1303,7 +1334,6 @@ int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
 
     AppendResult(error, aContext, aRequest);
 exit:
-    mHostMutex->unlock();
     return 0;
 }
 
@@ -1612,6 +1642,9 @@ int UbusServer::UbusSetInformation(struct ubus_context      *aContext,
         perror("invalid argument in get information ubus\n");
     }
 
+    // Publishes the new values right away so that a following get doesn't return the stale ones.
+    RefreshSnapshot();
+
 exit:
     mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
@@ -1647,6 +1680,81 @@ void UbusServer::GetState(otInstance *aInstance, char *aState)
     }
 }
 
+void UbusServer::RefreshSnapshot(void)
+{
+    std::shared_ptr<InformationSnapshot> snapshot(new InformationSnapshot());
+    otInstance                          *instance = mHost->GetInstance();
+    char                                 state[16];
+    char                                 output[NETWORKKEY_LENGTH];
+    otNetworkKey                         key;
+    otPskc                               pskc;
+    otLinkModeConfig                     linkMode = otThreadGetLinkMode(instance);
+
+    snapshot->mVersion       = ++mSnapshotVersion;
+    snapshot->mNetworkName   = otThreadGetNetworkName(instance);
+    snapshot->mInterfaceName = mHost->GetInterfaceName();
+
+    GetState(instance, state);
+    snapshot->mState = state;
+
+    snapshot->mChannel = otLinkGetChannel(instance);
+
+    sprintf(output, "0x%04x", otLinkGetPanId(instance));
+    snapshot->mPanId = output;
+
+    sprintf(output, "0x%04x", otThreadGetRloc16(instance));
+    snapshot->mRloc16 = output;
+
+    otThreadGetNetworkKey(instance, &key);
+    OutputBytes(key.m8, OT_NETWORK_KEY_SIZE, output);
+    snapshot->mNetworkKey = output;
+
+    otThreadGetPskc(instance, &pskc);
+    OutputBytes(pskc.m8, OT_PSKC_MAX_SIZE, output);
+    snapshot->mPskc = output;
+
+    OutputBytes(otThreadGetExtendedPanId(instance)->m8, OT_EXT_PAN_ID_SIZE, output);
+    snapshot->mExtPanId = output;
+
+    snapshot->mMode += linkMode.mRxOnWhenIdle ? "r" : "";
+    snapshot->mMode += linkMode.mDeviceType ? "d" : "";
+    snapshot->mMode += linkMode.mNetworkData ? "n" : "";
+
+    snapshot->mPartitionId     = otThreadGetPartitionId(instance);
+    snapshot->mLeaderDataError = otThreadGetLeaderData(instance, &snapshot->mLeaderData);
+
+    std::atomic_store(&mSnapshot, std::shared_ptr<const InformationSnapshot>(std::move(snapshot)));
+}
+
+void UbusServer::RecordMainloopStall(Microseconds aStallTime)
+{
+    uint64_t stallTime = static_cast<uint64_t>(aStallTime.count());
+    uint64_t maxTime   = mStallMaxTime.load();
+
+    mStallCount++;
+    mStallTotalTime += stallTime;
+
+    while (stallTime > maxTime && !mStallMaxTime.compare_exchange_weak(maxTime, stallTime))
+    {
+    }
+}
+
+int UbusServer::UbusMainloopStall(struct ubus_context *aContext, struct ubus_request_data *aRequest)
+{
+    std::shared_ptr<const InformationSnapshot> snapshot = std::atomic_load(&mSnapshot);
+
+    blob_buf_init(&mBuf, 0);
+
+    blobmsg_add_u32(&mBuf, "StallCount", mStallCount.load());
+    blobmsg_add_u64(&mBuf, "StallTotalUs", mStallTotalTime.load());
+    blobmsg_add_u64(&mBuf, "StallMaxUs", mStallMaxTime.load());
+    blobmsg_add_u32(&mBuf, "SnapshotVersion", snapshot->mVersion);
+
+    AppendResult(OT_ERROR_NONE, aContext, aRequest);
+
+    return 0;
+}
+
 void UbusServer::UbusAddFd()
 {
     // ubus library function
@@ -1710,6 +1818,14 @@ int UbusServer::DisplayUbusInit(const char *aPath)
     /* file description */
     UbusAddFd();
 
+    mScanDoneFd.fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (mScanDoneFd.fd == -1)
+    {
+        otbrLogErr("Failed to create eventfd for scan: %s", strerror(errno));
+        return -1;
+    }
+    uloop_fd_add(&mScanDoneFd, ULOOP_READ);
+
     /* Add a object */
     if (ubus_add_object(mContext, &otbr) != 0)
     {
@@ -1722,6 +1838,13 @@ int UbusServer::DisplayUbusInit(const char *aPath)
 
 void UbusServer::DisplayUbusDone(void)
 {
+    if (mScanDoneFd.fd != -1)
+    {
+        uloop_fd_delete(&mScanDoneFd);
+        close(mScanDoneFd.fd);
+        mScanDoneFd.fd = -1;
+    }
+
     if (mContext)
     {
         ubus_free(mContext);
@@ -1810,6 +1933,14 @@ void UBusAgent::Init(void)
     otbr::ubus::sUbusEfd = eventfd(0, 0);
 
     otbr::ubus::UbusServer::Initialize(&mHost, &mThreadMutex);
+    otbr::ubus::UbusServer::GetInstance().RefreshSnapshot();
+
+    mHost.AddThreadStateChangedCallback([](otChangedFlags aFlags) {
+        if (aFlags & kSnapshotChangedFlags)
+        {
+            otbr::ubus::UbusServer::GetInstance().RefreshSnapshot();
+        }
+    });
 
     if (otbr::ubus::sUbusEfd == -1)
     {
@@ -1835,7 +1966,15 @@ void UBusAgent::Process(const MainloopContext &aMainloop)
     ssize_t  retval;
     uint64_t num;
 
-    mThreadMutex.lock();
+    // The mutex is only contended by the ubus thread, so the time waited for it is the mainloop stall caused by ubus.
+    if (!mThreadMutex.try_lock())
+    {
+        Timepoint start = Clock::now();
+
+        mThreadMutex.lock();
+        otbr::ubus::UbusServer::GetInstance().RecordMainloopStall(
+            std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+    }
 
     VerifyOrExit(otbr::ubus::sUbusEfd != -1);
 
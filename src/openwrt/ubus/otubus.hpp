@@ -36,6 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <atomic>
+#include <memory>
+#include <string>
+
 #include <stdarg.h>
 #include <time.h>
 
@@ -46,6 +50,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/rcp_host.hpp"
 
 extern "C" {
@@ -93,6 +98,21 @@ public:
      */
     void InstallUbusObject(void);
 
+    /**
+     * This method publishes a new snapshot of the Thread information served to the ubus readers.
+     *
+     * It must be called either from the mainloop thread or with the host mutex held.
+     */
+    void RefreshSnapshot(void);
+
+    /**
+     * This method records a mainloop stall, which is the time the mainloop waited for the ubus thread to release
+     * the host mutex.
+     *
+     * @param[in] aStallTime  The time the mainloop waited.
+     */
+    void RecordMainloopStall(Microseconds aStallTime);
+
     /**
      * This method handle ubus scan function request.
      *
@@ -722,6 +742,23 @@ public:
                                         const char               *aMethod,
                                         struct blob_attr         *aMsg);
 
+    /**
+     * This method handle ubus mainloopstall function request.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    static int UbusMainloopStallHandler(struct ubus_context      *aContext,
+                                        struct ubus_object       *aObj,
+                                        struct ubus_request_data *aRequest,
+                                        const char               *aMethod,
+                                        struct blob_attr         *aMsg);
+
     /**
      * This method handle initial diagnostic get response.
      *
@@ -745,14 +782,48 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                 mIfFinishScan;
-    struct ubus_context *mContext;
-    const char          *mSockPath;
-    struct blob_buf      mBuf;
-    struct blob_buf      mNetworkdataBuf;
-    Ncp::RcpHost        *mHost;
-    std::mutex          *mHostMutex;
-    time_t               mSecond;
+    /**
+     * This structure represents the Thread information served to the ubus readers.
+     *
+     * A snapshot is never modified once published, a refresh publishes a new snapshot instead, so a reader holding a
+     * snapshot always sees consistent values without taking the host mutex.
+     */
+    struct InformationSnapshot
+    {
+        uint32_t     mVersion;
+        std::string  mNetworkName;
+        std::string  mInterfaceName;
+        std::string  mState;
+        uint8_t      mChannel;
+        std::string  mPanId;
+        std::string  mRloc16;
+        std::string  mNetworkKey;
+        std::string  mPskc;
+        std::string  mExtPanId;
+        std::string  mMode;
+        uint32_t     mPartitionId;
+        otError      mLeaderDataError;
+        otLeaderData mLeaderData;
+    };
+
+    bool                     mScanPending;
+    struct ubus_request_data mScanRequest;
+    struct uloop_fd          mScanDoneFd;
+    struct blob_buf          mScanBuf;
+    void                    *mScanList;
+    struct ubus_context     *mContext;
+    const char              *mSockPath;
+    struct blob_buf          mBuf;
+    struct blob_buf          mNetworkdataBuf;
+    Ncp::RcpHost            *mHost;
+    std::mutex              *mHostMutex;
+    time_t                   mSecond;
+
+    std::shared_ptr<const InformationSnapshot> mSnapshot;
+    std::atomic<uint32_t>                      mSnapshotVersion;
+    std::atomic<uint32_t>                      mStallCount;
+    std::atomic<uint64_t>                      mStallTotalTime;
+    std::atomic<uint64_t>                      mStallMaxTime;
     enum
     {
         kDefaultJoinerTimeout = 120,
@@ -768,8 +839,10 @@ private:
 
     /**
      * This method start scan.
+     *
+     * @returns The error of starting the scan.
      */
-    void ProcessScan(void);
+    otError ProcessScan(void);
 
     /**
      * This method detailly start scan.
@@ -803,6 +876,19 @@ private:
      */
     void HandleActiveScanResultDetail(otActiveScanResult *aResult);
 
+    /**
+     * This method handles the notification of the end of a scan on the ubus thread (uloop callback function).
+     *
+     * @param[in] aFd      A pointer to the uloop fd of the notification.
+     * @param[in] aEvents  The uloop events.
+     */
+    static void HandleScanDone(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method detailly handler the end of a scan, it sends the results to the deferred scan request.
+     */
+    void HandleScanDoneDetail(void);
+
     /**
      * This method detailly handler get neighbor information.
      *
@@ -909,6 +995,16 @@ private:
                            struct blob_attr         *aMsg,
                            const char               *action);
 
+    /**
+     * This method handle the mainloopstall request.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aRequest  A pointer to the ubus request.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    int UbusMainloopStall(struct ubus_context *aContext, struct ubus_request_data *aRequest);
+
     /**
      * This method handle set information request.
      *
@@ -1098,6 +1194,12 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
+    static constexpr otChangedFlags kSnapshotChangedFlags =
+        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_PARTITION_ID |
+        OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_CHANNEL | OT_CHANGED_THREAD_PANID |
+        OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_NETWORK_KEY | OT_CHANGED_PSKC |
+        OT_CHANGED_ACTIVE_DATASET;
+
     static void UbusServerRun(void) { otbr::ubus::UbusServer::GetInstance().InstallUbusObject(); }
 
     otbr::Ncp::RcpHost &mHost;
@@ -333,6 +333,19 @@ static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
     return route;
 }
 
+static cJSON *LatencyHistogram2Json(const LatencyHistogram &aHistogram)
+{
+    cJSON *histogram = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(histogram, "Count", cJSON_CreateNumber(aHistogram.GetCount()));
+    cJSON_AddItemToObject(histogram, "P50Us", cJSON_CreateNumber(aHistogram.GetPercentile(50)));
+    cJSON_AddItemToObject(histogram, "P90Us", cJSON_CreateNumber(aHistogram.GetPercentile(90)));
+    cJSON_AddItemToObject(histogram, "P99Us", cJSON_CreateNumber(aHistogram.GetPercentile(99)));
+    cJSON_AddItemToObject(histogram, "MaxUs", cJSON_CreateNumber(aHistogram.GetMax()));
+
+    return histogram;
+}
+
 static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
 {
     cJSON *leaderData = cJSON_CreateObject();
@@ -580,6 +593,35 @@ std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
     return ret;
 }
 
+std::string MainloopLatency2JsonString(const MainloopManager &aMainloopManager)
+{
+    cJSON      *mainloop   = cJSON_CreateObject();
+    cJSON      *processors = cJSON_CreateArray();
+    std::string ret;
+
+    cJSON_AddItemToObject(mainloop, "ProfilingEnabled", cJSON_CreateBool(aMainloopManager.IsProfilingEnabled()));
+    cJSON_AddItemToObject(mainloop, "StallBudgetMs", cJSON_CreateNumber(aMainloopManager.GetStallBudget().count()));
+    cJSON_AddItemToObject(mainloop, "StallCount", cJSON_CreateNumber(aMainloopManager.GetStallCount()));
+    cJSON_AddItemToObject(mainloop, "Iteration", LatencyHistogram2Json(aMainloopManager.GetIterationLatency()));
+
+    for (const MainloopManager::ProcessorStats &stats : aMainloopManager.GetProcessorStats())
+    {
+        cJSON *processor = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(processor, "Name", cJSON_CreateString(stats.mName.c_str()));
+        cJSON_AddItemToObject(processor, "StallCount", cJSON_CreateNumber(stats.mStallCount));
+        cJSON_AddItemToObject(processor, "Update", LatencyHistogram2Json(stats.mUpdateLatency));
+        cJSON_AddItemToObject(processor, "Process", LatencyHistogram2Json(stats.mProcessLatency));
+        cJSON_AddItemToArray(processors, processor);
+    }
+    cJSON_AddItemToObject(mainloop, "Processors", processors);
+
+    ret = Json2String(mainloop);
+    cJSON_Delete(mainloop);
+
+    return ret;
+}
+
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
     cJSON      *macCounters = MacCounters2Json(aMacCounters);
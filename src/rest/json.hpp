@@ -40,6 +40,7 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "common/mainloop_manager.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -209,6 +210,15 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method formats a Json object from the latency statistics of the mainloop.
+ *
+ * @param[in] aMainloopManager  The mainloop manager which recorded the statistics.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string MainloopLatency2JsonString(const MainloopManager &aMainloopManager);
+
 /**
  * This method formats a Json object from an active dataset.
  *
@@ -34,6 +34,7 @@
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOSTICS "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_MAINLOOP "/diagnostics/mainloop"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_BAID "/node/ba-id"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
@@ -127,6 +128,7 @@ Resource::Resource(RcpHost *aHost)
 {
     // Resource Handler
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
+    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS_MAINLOOP, &Resource::Mainloop);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_BAID, &Resource::BaId);
     mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
@@ -800,6 +802,28 @@ void Resource::DatasetPending(const Request &aRequest, Response &aResponse) cons
     Dataset(DatasetType::kPending, aRequest, aResponse);
 }
 
+void Resource::GetDataMainloop(Response &aResponse) const
+{
+    std::string body = Json::MainloopLatency2JsonString(MainloopManager::GetInstance());
+    std::string errorCode;
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::Mainloop(const Request &aRequest, Response &aResponse) const
+{
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataMainloop(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
 void Resource::DeleteOutDatedDiagnostic(void)
 {
     auto eraseIt = mDiagSet.begin();
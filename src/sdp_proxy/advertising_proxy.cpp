@@ -126,7 +126,7 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
     {
         mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        HandleServiceUpdateResult(aId, error);
     }
 
 exit:
@@ -148,7 +148,7 @@ void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId,
             // elements may be added to `otSrpServerHandleServiceUpdateResult` and
             // the iterator will be invalidated.
             mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+            HandleServiceUpdateResult(aUpdateId, aError);
         }
         else
         {
@@ -159,6 +159,16 @@ void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId,
     }
 }
 
+void AdvertisingProxy::HandleServiceUpdateResult(otSrpServerServiceUpdateId aId, otbrError aError)
+{
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(aError));
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    // The SRP server has committed or rejected the update by now.
+    mHost.GetThreadHelper()->HandleSrpServerChanged();
+#endif
+}
+
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
                                                                uint8_t             aHostAddressNum)
 {
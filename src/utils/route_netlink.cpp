@@ -0,0 +1,343 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the rtnetlink client which programs routes, rules and neighbor proxies.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/route_netlink.hpp"
+
+#if __linux__
+
+#include <algorithm>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <linux/fib_rules.h>
+#include <linux/neighbour.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+#ifndef NETLINK_CAP_ACK
+#define NETLINK_CAP_ACK 10
+#endif
+
+namespace otbr {
+namespace Utils {
+
+constexpr size_t RouteNetlink::kMaxBatchSize;
+
+RouteNetlink::RouteNetlink(void)
+    : mFd(-1)
+    , mSequence(0)
+{
+}
+
+RouteNetlink::~RouteNetlink(void)
+{
+    Close();
+}
+
+otbrError RouteNetlink::Open(void)
+{
+    otbrError error   = OTBR_ERROR_NONE;
+    int       enable  = 1;
+    timeval   timeout = {1, 0};
+
+    VerifyOrExit(mFd < 0);
+    VerifyOrExit((mFd = CreateNetLinkRouteSocket(0)) >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Only the headers of failed requests are needed in the acknowledgements.
+    // This option is missing before Linux 4.3, which is fine.
+    setsockopt(mFd, SOL_NETLINK, NETLINK_CAP_ACK, &enable, sizeof(enable));
+    VerifyOrExit(setsockopt(mFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to open rtnetlink socket: %s", strerror(errno));
+        Close();
+    }
+
+    return error;
+}
+
+void RouteNetlink::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    mRequests.clear();
+}
+
+void RouteNetlink::AddRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric)
+{
+    UpdateRoute(/* aIsAdd */ true, aPrefix, aIfIndex, aTable, aMetric);
+}
+
+void RouteNetlink::DeleteRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric)
+{
+    UpdateRoute(/* aIsAdd */ false, aPrefix, aIfIndex, aTable, aMetric);
+}
+
+void RouteNetlink::AddRule(const std::string &aInputIfName, uint32_t aTable)
+{
+    UpdateRule(/* aIsAdd */ true, aInputIfName, aTable);
+}
+
+void RouteNetlink::DeleteRule(const std::string &aInputIfName, uint32_t aTable)
+{
+    UpdateRule(/* aIsAdd */ false, aInputIfName, aTable);
+}
+
+void RouteNetlink::AddNeighborProxy(const Ip6Address &aAddress, uint32_t aIfIndex)
+{
+    UpdateNeighborProxy(/* aIsAdd */ true, aAddress, aIfIndex);
+}
+
+void RouteNetlink::DeleteNeighborProxy(const Ip6Address &aAddress, uint32_t aIfIndex)
+{
+    UpdateNeighborProxy(/* aIsAdd */ false, aAddress, aIfIndex);
+}
+
+otbrError RouteNetlink::Commit(void)
+{
+    int firstError = 0;
+
+    VerifyOrExit(!mRequests.empty());
+    VerifyOrExit(mFd >= 0, firstError = EBADF);
+
+    for (size_t begin = 0; begin < mRequests.size(); begin += kMaxBatchSize)
+    {
+        size_t               end      = std::min(begin + kMaxBatchSize, mRequests.size());
+        uint32_t             firstSeq = mSequence + 1;
+        std::vector<uint8_t> batch;
+        int                  error;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            std::vector<uint8_t> &message = mRequests[i].mMessage;
+
+            reinterpret_cast<nlmsghdr *>(message.data())->nlmsg_seq = ++mSequence;
+            batch.insert(batch.end(), message.begin(), message.end());
+        }
+
+        if (send(mFd, batch.data(), batch.size(), 0) != static_cast<ssize_t>(batch.size()))
+        {
+            error = errno;
+            otbrLogWarning("Failed to send requests#%u-%u: %s", firstSeq, mSequence, strerror(error));
+        }
+        else
+        {
+            error = ReceiveAcks(begin, end, firstSeq);
+        }
+
+        if (firstError == 0)
+        {
+            firstError = error;
+        }
+    }
+
+exit:
+    mRequests.clear();
+    errno = firstError;
+
+    return firstError == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+}
+
+int RouteNetlink::ReceiveAcks(size_t aBegin, size_t aEnd, uint32_t aFirstSeq)
+{
+    size_t numAcks    = 0;
+    int    firstError = 0;
+    char   buffer[8192];
+
+    while (numAcks < aEnd - aBegin)
+    {
+        int len = static_cast<int>(recv(mFd, buffer, sizeof(buffer), 0));
+
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            otbrLogWarning("Missing %zu acknowledgements of requests#%u-%u: %s", aEnd - aBegin - numAcks, aFirstSeq,
+                           aFirstSeq + static_cast<uint32_t>(aEnd - aBegin) - 1, strerror(errno));
+            firstError = (firstError != 0 ? firstError : errno);
+            break;
+        }
+
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, static_cast<unsigned>(len));
+             header           = NLMSG_NEXT(header, len))
+        {
+            uint32_t        index = header->nlmsg_seq - aFirstSeq;
+            const nlmsgerr *ack   = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+            if (header->nlmsg_type != NLMSG_ERROR || index >= aEnd - aBegin)
+            {
+                continue;
+            }
+
+            numAcks++;
+
+            if (ack->error != 0)
+            {
+                otbrLogWarning("Failed to %s: %s", mRequests[aBegin + index].mDescription.c_str(),
+                               strerror(-ack->error));
+                firstError = (firstError != 0 ? firstError : -ack->error);
+            }
+        }
+    }
+
+    return firstError;
+}
+
+RouteNetlink::Request &RouteNetlink::NewRequest(uint16_t    aType,
+                                                uint16_t    aFlags,
+                                                const void *aHeader,
+                                                size_t      aHeaderLength)
+{
+    Request  request;
+    nlmsghdr header;
+
+    memset(&header, 0, sizeof(header));
+    header.nlmsg_len   = NLMSG_LENGTH(aHeaderLength);
+    header.nlmsg_type  = aType;
+    header.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | aFlags;
+
+    request.mMessage.resize(NLMSG_SPACE(aHeaderLength));
+    memcpy(request.mMessage.data(), &header, sizeof(header));
+    memcpy(NLMSG_DATA(request.mMessage.data()), aHeader, aHeaderLength);
+    mRequests.push_back(std::move(request));
+
+    return mRequests.back();
+}
+
+void RouteNetlink::AddAttribute(Request &aRequest, uint16_t aType, const void *aData, size_t aLength)
+{
+    size_t  offset = NLMSG_ALIGN(aRequest.mMessage.size());
+    rtattr *rta;
+
+    aRequest.mMessage.resize(offset + RTA_SPACE(aLength));
+
+    rta           = reinterpret_cast<rtattr *>(aRequest.mMessage.data() + offset);
+    rta->rta_type = aType;
+    rta->rta_len  = RTA_LENGTH(aLength);
+    memcpy(RTA_DATA(rta), aData, aLength);
+
+    reinterpret_cast<nlmsghdr *>(aRequest.mMessage.data())->nlmsg_len = aRequest.mMessage.size();
+}
+
+void RouteNetlink::UpdateRoute(bool             aIsAdd,
+                               const Ip6Prefix &aPrefix,
+                               uint32_t         aIfIndex,
+                               uint32_t         aTable,
+                               uint32_t         aMetric)
+{
+    rtmsg rtm;
+
+    memset(&rtm, 0, sizeof(rtm));
+    rtm.rtm_family   = AF_INET6;
+    rtm.rtm_dst_len  = aPrefix.mLength;
+    rtm.rtm_table    = aTable < 256 ? aTable : RT_TABLE_UNSPEC;
+    rtm.rtm_protocol = RTPROT_STATIC;
+    rtm.rtm_scope    = RT_SCOPE_UNIVERSE;
+    rtm.rtm_type     = RTN_UNICAST;
+
+    Request &request = NewRequest(aIsAdd ? RTM_NEWROUTE : RTM_DELROUTE, aIsAdd ? NLM_F_CREATE | NLM_F_EXCL : 0, &rtm,
+                                  sizeof(rtm));
+
+    AddAttribute(request, RTA_DST, aPrefix.mPrefix.m8, sizeof(aPrefix.mPrefix.m8));
+    AddAttribute(request, RTA_OIF, &aIfIndex, sizeof(aIfIndex));
+    AddAttribute(request, RTA_TABLE, &aTable, sizeof(aTable));
+
+    if (aMetric != 0)
+    {
+        AddAttribute(request, RTA_PRIORITY, &aMetric, sizeof(aMetric));
+    }
+
+    request.mDescription = std::string(aIsAdd ? "add" : "delete") + " route " + aPrefix.ToString() + " dev #" +
+                           std::to_string(aIfIndex) + " table " + std::to_string(aTable) + " metric " +
+                           std::to_string(aMetric);
+}
+
+void RouteNetlink::UpdateRule(bool aIsAdd, const std::string &aInputIfName, uint32_t aTable)
+{
+    fib_rule_hdr frh;
+
+    memset(&frh, 0, sizeof(frh));
+    frh.family = AF_INET6;
+    frh.table  = aTable < 256 ? aTable : RT_TABLE_UNSPEC;
+    frh.action = FR_ACT_TO_TBL;
+
+    Request &request = NewRequest(aIsAdd ? RTM_NEWRULE : RTM_DELRULE, aIsAdd ? NLM_F_CREATE | NLM_F_EXCL : 0, &frh,
+                                  sizeof(frh));
+
+    AddAttribute(request, FRA_IIFNAME, aInputIfName.c_str(), aInputIfName.size() + 1);
+    AddAttribute(request, FRA_TABLE, &aTable, sizeof(aTable));
+
+    request.mDescription =
+        std::string(aIsAdd ? "add" : "delete") + " rule iif " + aInputIfName + " table " + std::to_string(aTable);
+}
+
+void RouteNetlink::UpdateNeighborProxy(bool aIsAdd, const Ip6Address &aAddress, uint32_t aIfIndex)
+{
+    ndmsg ndm;
+
+    memset(&ndm, 0, sizeof(ndm));
+    ndm.ndm_family  = AF_INET6;
+    ndm.ndm_ifindex = static_cast<int>(aIfIndex);
+    ndm.ndm_state   = NUD_PERMANENT;
+    ndm.ndm_flags   = NTF_PROXY | NTF_ROUTER; // The Backbone Router answers for the proxied addresses as a router.
+
+    Request &request = NewRequest(aIsAdd ? RTM_NEWNEIGH : RTM_DELNEIGH, aIsAdd ? NLM_F_CREATE | NLM_F_REPLACE : 0,
+                                  &ndm, sizeof(ndm));
+
+    AddAttribute(request, NDA_DST, aAddress.m8, sizeof(aAddress.m8));
+
+    request.mDescription = std::string(aIsAdd ? "add" : "delete") + " proxy neighbor " + aAddress.ToString() +
+                           " dev #" + std::to_string(aIfIndex);
+}
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
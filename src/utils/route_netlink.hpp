@@ -0,0 +1,189 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the rtnetlink client which programs routes, rules and neighbor proxies.
+ */
+
+#ifndef OTBR_UTILS_ROUTE_NETLINK_HPP_
+#define OTBR_UTILS_ROUTE_NETLINK_HPP_
+
+#include "openthread-br/config.h"
+
+#if __linux__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class implements a Linux rtnetlink client which installs IPv6 routes, routing policy rules and proxy
+ * neighbor entries.
+ *
+ * Requests are queued by the `Add*()` and `Delete*()` methods and sent in batches by `Commit()`, which waits for the
+ * kernel to acknowledge each of them, so that programming a set of routes takes no process spawns and failures are
+ * reported with their causes.
+ */
+class RouteNetlink : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the RouteNetlink instance.
+     */
+    RouteNetlink(void);
+
+    /**
+     * This destructor closes the rtnetlink socket.
+     */
+    ~RouteNetlink(void);
+
+    /**
+     * This method opens the rtnetlink socket.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully opened the socket.
+     * @retval OTBR_ERROR_ERRNO  Failed to open the socket, `errno` tells why.
+     */
+    otbrError Open(void);
+
+    /**
+     * This method closes the rtnetlink socket and drops the queued requests.
+     */
+    void Close(void);
+
+    /**
+     * This method returns if the rtnetlink socket is open.
+     *
+     * @returns If the rtnetlink socket is open.
+     */
+    bool IsOpen(void) const { return mFd >= 0; }
+
+    /**
+     * This method queues a request to add a static route.
+     *
+     * @param[in] aPrefix   The destination prefix.
+     * @param[in] aIfIndex  The index of the output interface.
+     * @param[in] aTable    The routing table, `RT_TABLE_MAIN` for the main table.
+     * @param[in] aMetric   The metric of the route, 0 for the default.
+     */
+    void AddRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric);
+
+    /**
+     * This method queues a request to delete a static route.
+     *
+     * @param[in] aPrefix   The destination prefix.
+     * @param[in] aIfIndex  The index of the output interface.
+     * @param[in] aTable    The routing table, `RT_TABLE_MAIN` for the main table.
+     * @param[in] aMetric   The metric of the route, 0 for the default.
+     */
+    void DeleteRoute(const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric);
+
+    /**
+     * This method queues a request to add a rule which looks up the packets from an input interface in a table.
+     *
+     * @param[in] aInputIfName  The name of the input interface.
+     * @param[in] aTable        The routing table.
+     */
+    void AddRule(const std::string &aInputIfName, uint32_t aTable);
+
+    /**
+     * This method queues a request to delete a rule which looks up the packets from an input interface in a table.
+     *
+     * @param[in] aInputIfName  The name of the input interface.
+     * @param[in] aTable        The routing table.
+     */
+    void DeleteRule(const std::string &aInputIfName, uint32_t aTable);
+
+    /**
+     * This method queues a request to add a proxy neighbor entry, so that the kernel answers Neighbor Solicitations
+     * for the address on the interface, with Neighbor Advertisements which have the Router flag set.
+     *
+     * @param[in] aAddress  The proxied address.
+     * @param[in] aIfIndex  The index of the interface.
+     */
+    void AddNeighborProxy(const Ip6Address &aAddress, uint32_t aIfIndex);
+
+    /**
+     * This method queues a request to delete a proxy neighbor entry.
+     *
+     * @param[in] aAddress  The proxied address.
+     * @param[in] aIfIndex  The index of the interface.
+     */
+    void DeleteNeighborProxy(const Ip6Address &aAddress, uint32_t aIfIndex);
+
+    /**
+     * This method returns the number of queued requests.
+     *
+     * @returns The number of queued requests.
+     */
+    size_t GetPendingRequestCount(void) const { return mRequests.size(); }
+
+    /**
+     * This method sends the queued requests and waits for their acknowledgements.
+     *
+     * Every request is sent even if some of them fail, the failures are logged.
+     *
+     * @retval OTBR_ERROR_NONE   All requests succeeded.
+     * @retval OTBR_ERROR_ERRNO  At least one request failed, `errno` is the error of the first failed request.
+     */
+    otbrError Commit(void);
+
+private:
+    static constexpr size_t kMaxBatchSize = 64;
+
+    struct Request
+    {
+        std::vector<uint8_t> mMessage;
+        std::string          mDescription;
+    };
+
+    Request &NewRequest(uint16_t aType, uint16_t aFlags, const void *aHeader, size_t aHeaderLength);
+    void     UpdateRoute(bool aIsAdd, const Ip6Prefix &aPrefix, uint32_t aIfIndex, uint32_t aTable, uint32_t aMetric);
+    void     UpdateRule(bool aIsAdd, const std::string &aInputIfName, uint32_t aTable);
+    void     UpdateNeighborProxy(bool aIsAdd, const Ip6Address &aAddress, uint32_t aIfIndex);
+    int      ReceiveAcks(size_t aBegin, size_t aEnd, uint32_t aFirstSeq);
+
+    static void AddAttribute(Request &aRequest, uint16_t aType, const void *aData, size_t aLength);
+
+    int                  mFd;
+    uint32_t             mSequence;
+    std::vector<Request> mRequests;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
+
+#endif // OTBR_UTILS_ROUTE_NETLINK_HPP_
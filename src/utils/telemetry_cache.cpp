@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the cache of telemetry sections.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/telemetry_cache.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+size_t TelemetryCache::AddSection(const std::string &aName, Milliseconds aMaxAge, SectionEncoder aEncoder)
+{
+    Section section;
+
+    section.mStats.mName          = aName;
+    section.mStats.mRefreshCount  = 0;
+    section.mStats.mCacheHitCount = 0;
+    section.mStats.mLastDuration  = Microseconds::zero();
+    section.mStats.mMaxDuration   = Microseconds::zero();
+    section.mStats.mTotalDuration = Microseconds::zero();
+    section.mStats.mFragmentSize  = 0;
+    section.mMaxAge               = aMaxAge;
+    section.mEncoder              = std::move(aEncoder);
+
+    mSections.push_back(std::move(section));
+
+    return mSections.size() - 1;
+}
+
+void TelemetryCache::Invalidate(size_t aSection)
+{
+    assert(aSection < mSections.size());
+
+    mSections[aSection].mIsValid = false;
+}
+
+void TelemetryCache::InvalidateAll(void)
+{
+    for (Section &section : mSections)
+    {
+        section.mIsValid = false;
+    }
+}
+
+otError TelemetryCache::Assemble(std::string &aBytes)
+{
+    otError   error = OT_ERROR_NONE;
+    Timepoint now   = Clock::now();
+    size_t    size  = 0;
+
+    for (Section &section : mSections)
+    {
+        if (!section.mIsValid || now - section.mUpdateTime >= section.mMaxAge)
+        {
+            Refresh(section);
+        }
+        else
+        {
+            section.mStats.mCacheHitCount++;
+        }
+
+        if (section.mError != OT_ERROR_NONE)
+        {
+            error = OT_ERROR_FAILED;
+        }
+
+        size += section.mFragment.size();
+    }
+
+    aBytes.clear();
+    aBytes.reserve(size);
+
+    for (const Section &section : mSections)
+    {
+        aBytes += section.mFragment;
+    }
+
+    return error;
+}
+
+std::vector<TelemetryCache::SectionStats> TelemetryCache::GetSectionStats(void) const
+{
+    std::vector<SectionStats> stats;
+
+    for (const Section &section : mSections)
+    {
+        stats.push_back(section.mStats);
+    }
+
+    return stats;
+}
+
+void TelemetryCache::Refresh(Section &aSection)
+{
+    Timepoint    start = Clock::now();
+    Microseconds duration;
+
+    aSection.mFragment.clear();
+    aSection.mError      = aSection.mEncoder(aSection.mFragment);
+    aSection.mUpdateTime = Clock::now();
+    aSection.mIsValid    = true;
+
+    duration = std::chrono::duration_cast<Microseconds>(aSection.mUpdateTime - start);
+    aSection.mStats.mRefreshCount++;
+    aSection.mStats.mTotalDuration += duration;
+
+    aSection.mStats.mLastDuration = duration;
+    aSection.mStats.mMaxDuration  = std::max(aSection.mStats.mMaxDuration, duration);
+    aSection.mStats.mFragmentSize = aSection.mFragment.size();
+
+    otbrLogDebug("Encoded section %s: %zu bytes in %lld us", aSection.mStats.mName.c_str(), aSection.mFragment.size(),
+                 static_cast<long long>(duration.count()));
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the cache of telemetry sections.
+ */
+
+#ifndef OTBR_UTILS_TELEMETRY_CACHE_HPP_
+#define OTBR_UTILS_TELEMETRY_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class implements a cache of independently refreshed telemetry sections.
+ *
+ * Each section encodes its part of the telemetry into a fragment of bytes. A fragment is kept until it is older than
+ * the maximum age of its section or the section is invalidated, and the telemetry is assembled by concatenating the
+ * fragments of all sections. Encoding each section as a serialized protobuf message which only sets its own fields
+ * makes the concatenation a valid serialization of the whole message.
+ */
+class TelemetryCache
+{
+public:
+    /**
+     * This function encodes a section into @p aFragment.
+     *
+     * The fragment is cached even when an error is returned, as the errors are usually caused by metrics which are not
+     * supported and retrieving them again would fail the same way.
+     *
+     * @param[out] aFragment  The encoded section, it's empty when called.
+     *
+     * @retval OT_ERROR_NONE    The section was fully encoded.
+     * @retval OT_ERROR_FAILED  One or more metrics of the section couldn't be retrieved.
+     */
+    using SectionEncoder = std::function<otError(std::string &aFragment)>;
+
+    /**
+     * This structure represents the timing statistics of a section.
+     */
+    struct SectionStats
+    {
+        std::string  mName;          ///< The name of the section.
+        uint32_t     mRefreshCount;  ///< The number of times the section was encoded.
+        uint32_t     mCacheHitCount; ///< The number of times the cached fragment was reused.
+        Microseconds mLastDuration;  ///< The time spent by the last encoding.
+        Microseconds mMaxDuration;   ///< The longest time spent by an encoding.
+        Microseconds mTotalDuration; ///< The time spent by all encodings.
+        size_t       mFragmentSize;  ///< The size of the cached fragment in bytes.
+    };
+
+    /**
+     * This method adds a section.
+     *
+     * Sections are assembled in the order they are added.
+     *
+     * @param[in] aName     The name of the section.
+     * @param[in] aMaxAge   The maximum age of the cached fragment, zero to encode the section on every assembly.
+     * @param[in] aEncoder  The function which encodes the section.
+     *
+     * @returns The index of the section.
+     */
+    size_t AddSection(const std::string &aName, Milliseconds aMaxAge, SectionEncoder aEncoder);
+
+    /**
+     * This method invalidates the cached fragment of a section.
+     *
+     * @param[in] aSection  The index of the section.
+     */
+    void Invalidate(size_t aSection);
+
+    /**
+     * This method invalidates the cached fragments of all sections.
+     */
+    void InvalidateAll(void);
+
+    /**
+     * This method assembles the telemetry, encoding the sections whose fragments are missing or stale.
+     *
+     * @param[out] aBytes  The assembled telemetry.
+     *
+     * @retval OT_ERROR_NONE    All sections were fully encoded.
+     * @retval OT_ERROR_FAILED  One or more sections failed to encode some metrics.
+     */
+    otError Assemble(std::string &aBytes);
+
+    /**
+     * This method returns the timing statistics of all sections.
+     *
+     * @returns The statistics in the order the sections were added.
+     */
+    std::vector<SectionStats> GetSectionStats(void) const;
+
+private:
+    struct Section
+    {
+        SectionStats   mStats;
+        Milliseconds   mMaxAge;
+        SectionEncoder mEncoder;
+        std::string    mFragment;
+        Timepoint      mUpdateTime;
+        otError        mError   = OT_ERROR_NONE;
+        bool           mIsValid = false;
+    };
+
+    void Refresh(Section &aSection);
+
+    std::vector<Section> mSections;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_TELEMETRY_CACHE_HPP_
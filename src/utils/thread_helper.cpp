@@ -227,6 +227,27 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_aborted_count(from.mAborted);
     to->set_invalid_state_count(from.mInvalidState);
 }
+
+void CopyLatencyHistogram(const LatencyHistogram &from, threadnetwork::TelemetryData_LatencyHistogram *to)
+{
+    uint8_t numBuckets = LatencyHistogram::kNumBuckets;
+
+    to->set_count(from.GetCount());
+    to->set_max_ms(from.GetMax());
+    to->set_p50_ms(from.GetPercentile(50));
+    to->set_p90_ms(from.GetPercentile(90));
+    to->set_p99_ms(from.GetPercentile(99));
+
+    while (numBuckets > 0 && from.GetBucketCount(numBuckets - 1) == 0)
+    {
+        numBuckets--;
+    }
+
+    for (uint8_t i = 0; i < numBuckets; i++)
+    {
+        to->add_bucket_counts(from.GetBucketCount(i));
+    }
+}
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 } // namespace
 
@@ -245,10 +266,17 @@ exit:
         otbrLogWarning("Error otPlatCryptoRandomGet: %s", otThreadErrorToString(error));
     }
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    InitTelemetryCache();
+#endif
 }
 
 void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
 {
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    InvalidateTelemetryCache(aFlags);
+#endif
+
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = mHost->GetDeviceRole();
@@ -1089,13 +1117,98 @@ void ThreadHelper::RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderA
 }
 #endif
 
+// Sections which are mostly counters are refreshed every second, the topology and the border router sections
+// are expensive to build (neighbor tables, SRP hosts, hashed PD prefixes) and are kept longer unless the state
+// they describe changes. The border router counters are split into their own section, the sections are merged
+// into the same `wpan_border_router` message. The SRP server starts and stops along with its Network Data entry,
+// and its registrations are signaled by `HandleSrpServerChanged()`.
+const ThreadHelper::TelemetrySection ThreadHelper::kTelemetrySections[] = {
+    {"WpanStats", Seconds(1), OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHANNEL, false,
+     &ThreadHelper::RetrieveWpanStats},
+    {"WpanTopology", Seconds(10),
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED |
+         OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA,
+     false, &ThreadHelper::RetrieveWpanTopology},
+    {"WpanBorderRouter", Seconds(10), OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA, true,
+     &ThreadHelper::RetrieveWpanBorderRouter},
+    {"WpanBorderRouterCounters", Seconds(1), 0, false, &ThreadHelper::RetrieveWpanBorderRouterCounters},
+    {"WpanRcp", Seconds(1), 0, false, &ThreadHelper::RetrieveWpanRcp},
+    {"CoexMetrics", Seconds(1), 0, false, &ThreadHelper::RetrieveCoexMetrics},
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    {"LowPowerMetrics", Seconds(10), OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED, false,
+     &ThreadHelper::RetrieveLowPowerMetrics},
+#endif
+};
+
 otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData)
 {
-    otError                     error = OT_ERROR_NONE;
-    std::vector<otNeighborInfo> neighborTable;
+    otError error = OT_ERROR_NONE;
+
+    mTelemetryPublisher = aPublisher;
+
+    for (const TelemetrySection &section : kTelemetrySections)
+    {
+        if ((this->*section.mRetriever)(telemetryData) != OT_ERROR_NONE)
+        {
+            error = OT_ERROR_FAILED;
+        }
+    }
+
+    return error;
+}
+
+otError ThreadHelper::RetrieveTelemetryDataBytes(Mdns::Publisher *aPublisher, std::string &aTelemetryDataBytes)
+{
+    mTelemetryPublisher = aPublisher;
+
+    return mTelemetryCache.Assemble(aTelemetryDataBytes);
+}
+
+void ThreadHelper::InitTelemetryCache(void)
+{
+    for (const TelemetrySection &section : kTelemetrySections)
+    {
+        TelemetrySectionRetriever retriever = section.mRetriever;
+
+        mTelemetryCache.AddSection(section.mName, section.mMaxAge, [this, retriever](std::string &aFragment) {
+            threadnetwork::TelemetryData telemetryData;
+            otError                      error = (this->*retriever)(telemetryData);
+
+            telemetryData.AppendToString(&aFragment);
+
+            return error;
+        });
+    }
+}
+
+void ThreadHelper::InvalidateTelemetryCache(otChangedFlags aFlags)
+{
+    for (size_t i = 0; i < sizeof(kTelemetrySections) / sizeof(kTelemetrySections[0]); i++)
+    {
+        if (aFlags & kTelemetrySections[i].mInvalidatingFlags)
+        {
+            mTelemetryCache.Invalidate(i);
+        }
+    }
+}
+
+void ThreadHelper::HandleSrpServerChanged(void)
+{
+    for (size_t i = 0; i < sizeof(kTelemetrySections) / sizeof(kTelemetrySections[0]); i++)
+    {
+        if (kTelemetrySections[i].mDescribesSrpServer)
+        {
+            mTelemetryCache.Invalidate(i);
+        }
+    }
+}
+
+otError ThreadHelper::RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
 
     // Begin of WpanStats section.
-    auto wpanStats = telemetryData.mutable_wpan_stats();
+    auto wpanStats = aTelemetryData.mutable_wpan_stats();
 
     {
         otDeviceRole     role  = mHost->GetDeviceRole();
@@ -1169,537 +1282,587 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
     }
     // End of WpanStats section.
 
-    {
-        // Begin of WpanTopoFull section.
-        auto     wpanTopoFull = telemetryData.mutable_wpan_topo_full();
-        uint16_t rloc16       = otThreadGetRloc16(mInstance);
+    return error;
+}
 
-        wpanTopoFull->set_rloc16(rloc16);
+otError ThreadHelper::RetrieveWpanTopology(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError                     error = OT_ERROR_NONE;
+    std::vector<otNeighborInfo> neighborTable;
 
-        {
-            otRouterInfo info;
+    // Begin of WpanTopoFull section.
+    auto     wpanTopoFull = aTelemetryData.mutable_wpan_topo_full();
+    uint16_t rloc16       = otThreadGetRloc16(mInstance);
 
-            if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_router_id(info.mRouterId);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
-        }
+    wpanTopoFull->set_rloc16(rloc16);
 
-        otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-        otNeighborInfo         neighborInfo;
+    {
+        otRouterInfo info;
 
-        while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+        if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
         {
-            neighborTable.push_back(neighborInfo);
+            wpanTopoFull->set_router_id(info.mRouterId);
         }
-        wpanTopoFull->set_neighbor_table_size(neighborTable.size());
+        else
+        {
+            error = OT_ERROR_FAILED;
+        }
+    }
+
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        neighborTable.push_back(neighborInfo);
+    }
+    wpanTopoFull->set_neighbor_table_size(neighborTable.size());
 
-        uint16_t                 childIndex = 0;
-        otChildInfo              childInfo;
-        std::vector<otChildInfo> childTable;
+    uint16_t                 childIndex = 0;
+    otChildInfo              childInfo;
+    std::vector<otChildInfo> childTable;
 
-        while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+    while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        childTable.push_back(childInfo);
+        childIndex++;
+    }
+    wpanTopoFull->set_child_table_size(childTable.size());
+
+    {
+        struct otLeaderData leaderData;
+
+        if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
         {
-            childTable.push_back(childInfo);
-            childIndex++;
+            wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
+            wpanTopoFull->set_leader_weight(leaderData.mWeighting);
+            wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
+            wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
         }
-        wpanTopoFull->set_child_table_size(childTable.size());
-
+        else
         {
-            struct otLeaderData leaderData;
-
-            if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
-                wpanTopoFull->set_leader_weight(leaderData.mWeighting);
-                wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
-                wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+            error = OT_ERROR_FAILED;
         }
+    }
 
-        uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
+    uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
 
-        wpanTopoFull->set_leader_local_weight(weight);
+    wpanTopoFull->set_leader_local_weight(weight);
 
-        uint32_t partitionId = otThreadGetPartitionId(mInstance);
+    uint32_t partitionId = otThreadGetPartitionId(mInstance);
 
-        wpanTopoFull->set_partition_id(partitionId);
+    wpanTopoFull->set_partition_id(partitionId);
 
-        static constexpr size_t kNetworkDataMaxSize = 255;
-        {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+    static constexpr size_t kNetworkDataMaxSize = 255;
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
 
-            if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+        if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
         }
-
+        else
         {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+            error = OT_ERROR_FAILED;
+        }
+    }
 
-            if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
+
+        if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
+        }
+        else
+        {
+            error = OT_ERROR_FAILED;
         }
+    }
 
-        int8_t rssi = otPlatRadioGetRssi(mInstance);
+    int8_t rssi = otPlatRadioGetRssi(mInstance);
 
-        wpanTopoFull->set_instant_rssi(rssi);
+    wpanTopoFull->set_instant_rssi(rssi);
 
-        const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
-        uint64_t               extPanIdVal;
+    const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
+    uint64_t               extPanIdVal;
 
-        extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
-        wpanTopoFull->set_extended_pan_id(extPanIdVal);
+    extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
+    wpanTopoFull->set_extended_pan_id(extPanIdVal);
 #if OTBR_ENABLE_BORDER_ROUTING
-        wpanTopoFull->set_peer_br_count(otBorderRoutingCountPeerBrs(mInstance, /*minAge=*/nullptr));
+    wpanTopoFull->set_peer_br_count(otBorderRoutingCountPeerBrs(mInstance, /*minAge=*/nullptr));
 #endif
-        // End of WpanTopoFull section.
+    // End of WpanTopoFull section.
 
-        // Begin of TopoEntry section.
-        std::map<uint16_t, const otChildInfo *> childMap;
+    // Begin of TopoEntry section.
+    std::map<uint16_t, const otChildInfo *> childMap;
 
-        for (const otChildInfo &childInfo : childTable)
+    for (const otChildInfo &childInfo : childTable)
+    {
+        auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
+        if (!pair.second)
         {
-            auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
-            if (!pair.second)
-            {
-                // This shouldn't happen, so log an error. It doesn't matter which
-                // duplicate is kept.
-                otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
-            }
+            // This shouldn't happen, so log an error. It doesn't matter which
+            // duplicate is kept.
+            otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
         }
+    }
 
-        for (const otNeighborInfo &neighborInfo : neighborTable)
+    for (const otNeighborInfo &neighborInfo : neighborTable)
+    {
+        auto topoEntry = aTelemetryData.add_topo_entries();
+        topoEntry->set_rloc16(neighborInfo.mRloc16);
+        topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
+        topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
+        topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
+        topoEntry->set_last_rssi(neighborInfo.mLastRssi);
+        topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
+        topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
+        topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
+        topoEntry->set_secure_data_request(true);
+        topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
+        topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
+        topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
+        topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
+        topoEntry->set_version(neighborInfo.mVersion);
+
+        if (!neighborInfo.mIsChild)
         {
-            auto topoEntry = telemetryData.add_topo_entries();
-            topoEntry->set_rloc16(neighborInfo.mRloc16);
-            topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
-            topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
-            topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
-            topoEntry->set_last_rssi(neighborInfo.mLastRssi);
-            topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
-            topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
-            topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
-            topoEntry->set_secure_data_request(true);
-            topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
-            topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
-            topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
-            topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
-            topoEntry->set_version(neighborInfo.mVersion);
-
-            if (!neighborInfo.mIsChild)
-            {
-                continue;
-            }
-
-            auto it = childMap.find(neighborInfo.mRloc16);
-            if (it == childMap.end())
-            {
-                otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
-                continue;
-            }
-            const otChildInfo *childInfo = it->second;
-            topoEntry->set_is_child(true);
-            topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
-            topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+            continue;
         }
-        // End of TopoEntry section.
-    }
-
-    {
-        // Begin of WpanBorderRouter section.
-        auto wpanBorderRouter = telemetryData.mutable_wpan_border_router();
-        // Begin of BorderRoutingCounters section.
-        auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
-        const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
-
-        borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundUnicast.mPackets);
-        borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundUnicast.mBytes);
-        borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundMulticast.mPackets);
-        borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundMulticast.mBytes);
-        borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundUnicast.mPackets);
-        borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundUnicast.mBytes);
-        borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundMulticast.mPackets);
-        borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundMulticast.mBytes);
-        borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
-        borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
-        borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
-        borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
-        borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
-        borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
-        borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mInboundInternet.mPackets);
-        borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mInboundInternet.mBytes);
-        borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mOutboundInternet.mPackets);
-        borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mOutboundInternet.mBytes);
 
-#if OTBR_ENABLE_NAT64
+        auto it = childMap.find(neighborInfo.mRloc16);
+        if (it == childMap.end())
         {
-            auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
-            auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
-            auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
-            otNat64ProtocolCounters otCounters;
-
-            otNat64GetCounters(mInstance, &otCounters);
-            nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
-            nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
-            nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
-            nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
-            nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
-            nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
-            nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
-            nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
-            nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
-            nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
-            nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
-            nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+            otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
+            continue;
         }
+        const otChildInfo *childInfo = it->second;
+        topoEntry->set_is_child(true);
+        topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
+        topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+    }
+    // End of TopoEntry section.
 
-        {
-            auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
-            otNat64ErrorCounters otCounters;
-            otNat64GetErrorCounters(mInstance, &otCounters);
-
-            errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
-            errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
-        }
-#endif // OTBR_ENABLE_NAT64
-       // End of BorderRoutingCounters section.
+    return error;
+}
 
-#if OTBR_ENABLE_TREL
-        // Begin of TrelInfo section.
-        {
-            auto trelInfo       = wpanBorderRouter->mutable_trel_info();
-            auto otTrelCounters = otTrelGetCounters(mInstance);
-            auto trelCounters   = trelInfo->mutable_counters();
-
-            trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
-            trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
-
-            trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
-            trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
-            trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
-            trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
-            trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
-        }
-        // End of TrelInfo section.
-#endif // OTBR_ENABLE_TREL
+otError ThreadHelper::RetrieveWpanBorderRouter(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Begin of WpanBorderRouter section, the counters are retrieved by `RetrieveWpanBorderRouterCounters()`.
+    auto wpanBorderRouter = aTelemetryData.mutable_wpan_border_router();
+
+    OTBR_UNUSED_VARIABLE(wpanBorderRouter);
 
 #if OTBR_ENABLE_BORDER_ROUTING
-        RetrieveInfraLinkInfo(*wpanBorderRouter->mutable_infra_link_info());
-        RetrieveExternalRouteInfo(*wpanBorderRouter->mutable_external_route_info());
+    RetrieveInfraLinkInfo(*wpanBorderRouter->mutable_infra_link_info());
+    RetrieveExternalRouteInfo(*wpanBorderRouter->mutable_external_route_info());
 #endif
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-        // Begin of SrpServerInfo section.
-        {
-            auto                               srpServer = wpanBorderRouter->mutable_srp_server();
-            otSrpServerLeaseInfo               leaseInfo;
-            const otSrpServerHost             *host             = nullptr;
-            const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
+    // Begin of SrpServerInfo section.
+    {
+        auto                   srpServer = wpanBorderRouter->mutable_srp_server();
+        otSrpServerLeaseInfo   leaseInfo;
+        const otSrpServerHost *host      = nullptr;
+
+        srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
+        srpServer->set_port(otSrpServerGetPort(mInstance));
+        srpServer->set_address_mode(
+            SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
 
-            srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
-            srpServer->set_port(otSrpServerGetPort(mInstance));
-            srpServer->set_address_mode(
-                SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
+        auto srpServerHosts    = srpServer->mutable_hosts();
+        auto srpServerServices = srpServer->mutable_services();
 
-            auto srpServerHosts            = srpServer->mutable_hosts();
-            auto srpServerServices         = srpServer->mutable_services();
-            auto srpServerResponseCounters = srpServer->mutable_response_counters();
+        while ((host = otSrpServerGetNextHost(mInstance, host)))
+        {
+            const otSrpServerService *service = nullptr;
 
-            while ((host = otSrpServerGetNextHost(mInstance, host)))
+            if (otSrpServerHostIsDeleted(host))
             {
-                const otSrpServerService *service = nullptr;
+                srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+            }
+            else
+            {
+                srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
+                otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+                srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
+                srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
+                                                            leaseInfo.mKeyLease);
+                srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
+                                                                  leaseInfo.mRemainingLease);
+                srpServerHosts->set_remaining_key_lease_time_total_ms(
+                    srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
+            }
 
-                if (otSrpServerHostIsDeleted(host))
+            while ((service = otSrpServerHostGetNextService(host, service)))
+            {
+                if (otSrpServerServiceIsDeleted(service))
                 {
-                    srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+                    srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
                 }
                 else
                 {
-                    srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
-                    otSrpServerHostGetLeaseInfo(host, &leaseInfo);
-                    srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
-                    srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
-                                                                leaseInfo.mKeyLease);
-                    srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
-                                                                      leaseInfo.mRemainingLease);
-                    srpServerHosts->set_remaining_key_lease_time_total_ms(
-                        srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                }
-
-                while ((service = otSrpServerHostGetNextService(host, service)))
-                {
-                    if (otSrpServerServiceIsDeleted(service))
-                    {
-                        srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
-                    }
-                    else
-                    {
-                        srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
-                        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
-                        srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
-                                                                   leaseInfo.mLease);
-                        srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
-                                                                       leaseInfo.mKeyLease);
-                        srpServerServices->set_remaining_lease_time_total_ms(
-                            srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
-                        srpServerServices->set_remaining_key_lease_time_total_ms(
-                            srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                    }
+                    srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
+                    otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
+                    srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
+                                                               leaseInfo.mLease);
+                    srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
+                                                                   leaseInfo.mKeyLease);
+                    srpServerServices->set_remaining_lease_time_total_ms(
+                        srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
+                    srpServerServices->set_remaining_key_lease_time_total_ms(
+                        srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
                 }
             }
-
-            srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
-            srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
-            srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
-            srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
-            srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
-            srpServerResponseCounters->set_other_count(responseCounters->mOther);
         }
-        // End of SrpServerInfo section.
+    }
+    // End of SrpServerInfo section.
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
-#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-        // Begin of DnsServerInfo section.
-        {
-            auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
-            auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
-            otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
-
-            dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
-            dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
-            dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
-            dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
-            dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
-            dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
-            // The counters of queries, responses, failures handled by upstream DNS server.
-            dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
-            dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
-            dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
-
-            dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
+#if OTBR_ENABLE_NAT64
+    // Start of BorderRoutingNat64State section.
+    {
+        auto nat64State = wpanBorderRouter->mutable_nat64_state();
 
-#if OTBR_ENABLE_DNS_UPSTREAM_QUERY
-            dnsServer->set_upstream_dns_query_state(
-                otDnssdUpstreamQueryIsEnabled(mInstance)
-                    ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
-                    : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
-#endif // OTBR_ENABLE_DNS_UPSTREAM_QUERY
-        }
-        // End of DnsServerInfo section.
-#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+        nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
+        nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
+    }
+    // End of BorderRoutingNat64State section.
+
+    // Start of Nat64Mapping section.
+    {
+        otNat64AddressMappingIterator iterator;
+        otNat64AddressMapping         otMapping;
+        Sha256::Hash                  hash;
+        Sha256                        sha256;
 
-        // Start of MdnsInfo section.
-        if (aPublisher != nullptr)
+        otNat64InitAddressMappingIterator(mInstance, &iterator);
+        while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
         {
-            auto                     mdns     = wpanBorderRouter->mutable_mdns();
-            const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
-
-            CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
-
-            mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
-            mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
-            mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
-            mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+            auto nat64Mapping         = wpanBorderRouter->add_nat64_mappings();
+            auto nat64MappingCounters = nat64Mapping->mutable_counters();
+
+            nat64Mapping->set_mapping_id(otMapping.mId);
+            CopyNat64TrafficCounters(otMapping.mCounters.mTcp, nat64MappingCounters->mutable_tcp());
+            CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
+            CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
+
+            sha256.Start();
+            sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
+            sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
+            sha256.Finish(hash);
+
+            nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
+                                                                Sha256::Hash::kSize);
+            // Remaining time is not included in the telemetry
         }
-        // End of MdnsInfo section.
+    }
+    // End of Nat64Mapping section.
+#endif // OTBR_ENABLE_NAT64
+#if OTBR_ENABLE_DHCP6_PD
+    RetrievePdInfo(wpanBorderRouter);
+#endif // OTBR_ENABLE_DHCP6_PD
+    // End of WpanBorderRouter section.
 
-#if OTBR_ENABLE_NAT64
-        // Start of BorderRoutingNat64State section.
-        {
-            auto nat64State = wpanBorderRouter->mutable_nat64_state();
+    return OT_ERROR_NONE;
+}
 
-            nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
-            nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
-        }
-        // End of BorderRoutingNat64State section.
+otError ThreadHelper::RetrieveWpanBorderRouterCounters(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // The counters are merged into the WpanBorderRouter section, except the per mapping NAT64 counters which are
+    // kept with their mappings.
+    auto wpanBorderRouter = aTelemetryData.mutable_wpan_border_router();
+
+    // Begin of BorderRoutingCounters section.
+    auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
+    const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
+
+    borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundUnicast.mPackets);
+    borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundUnicast.mBytes);
+    borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundMulticast.mPackets);
+    borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundMulticast.mBytes);
+    borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundUnicast.mPackets);
+    borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundUnicast.mBytes);
+    borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundMulticast.mPackets);
+    borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundMulticast.mBytes);
+    borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
+    borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
+    borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
+    borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
+    borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
+    borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
+    borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mInboundInternet.mPackets);
+    borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mInboundInternet.mBytes);
+    borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mOutboundInternet.mPackets);
+    borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mOutboundInternet.mBytes);
 
-        // Start of Nat64Mapping section.
-        {
-            otNat64AddressMappingIterator iterator;
-            otNat64AddressMapping         otMapping;
-            Sha256::Hash                  hash;
-            Sha256                        sha256;
+#if OTBR_ENABLE_NAT64
+    {
+        auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
+        auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
+        auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
+        otNat64ProtocolCounters otCounters;
+
+        otNat64GetCounters(mInstance, &otCounters);
+        nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
+        nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
+        nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
+        nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
+        nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
+        nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
+        nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
+        nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
+        nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
+        nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
+        nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
+        nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+    }
 
-            otNat64InitAddressMappingIterator(mInstance, &iterator);
-            while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
-            {
-                auto nat64Mapping         = wpanBorderRouter->add_nat64_mappings();
-                auto nat64MappingCounters = nat64Mapping->mutable_counters();
-
-                nat64Mapping->set_mapping_id(otMapping.mId);
-                CopyNat64TrafficCounters(otMapping.mCounters.mTcp, nat64MappingCounters->mutable_tcp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
-
-                sha256.Start();
-                sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
-                sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
-                sha256.Finish(hash);
-
-                nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
-                                                                    Sha256::Hash::kSize);
-                // Remaining time is not included in the telemetry
-            }
-        }
-        // End of Nat64Mapping section.
+    {
+        auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
+        otNat64ErrorCounters otCounters;
+        otNat64GetErrorCounters(mInstance, &otCounters);
+
+        errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
+        errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
+    }
 #endif // OTBR_ENABLE_NAT64
-#if OTBR_ENABLE_DHCP6_PD
-        RetrievePdInfo(wpanBorderRouter);
-#endif // OTBR_ENABLE_DHCP6_PD
+    // End of BorderRoutingCounters section.
+
+#if OTBR_ENABLE_TREL
+    // Begin of TrelInfo section.
+    {
+        auto trelInfo       = wpanBorderRouter->mutable_trel_info();
+        auto otTrelCounters = otTrelGetCounters(mInstance);
+        auto trelCounters   = trelInfo->mutable_counters();
+
+        trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
+        trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
+
+        trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
+        trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
+        trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
+        trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
+        trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
+    }
+    // End of TrelInfo section.
+#endif // OTBR_ENABLE_TREL
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    {
+        auto srpServerResponseCounters = wpanBorderRouter->mutable_srp_server()->mutable_response_counters();
+        const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
+
+        srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
+        srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
+        srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
+        srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
+        srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
+        srpServerResponseCounters->set_other_count(responseCounters->mOther);
+    }
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    // Begin of DnsServerInfo section.
+    {
+        auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
+        auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
+        otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
+
+        dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
+        dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
+        dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
+        dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
+        dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
+        dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
+        // The counters of queries, responses, failures handled by upstream DNS server.
+        dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
+        dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
+        dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
+
+        dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
+
+#if OTBR_ENABLE_DNS_UPSTREAM_QUERY
+        dnsServer->set_upstream_dns_query_state(
+            otDnssdUpstreamQueryIsEnabled(mInstance)
+                ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
+                : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
+#endif // OTBR_ENABLE_DNS_UPSTREAM_QUERY
+    }
+    // End of DnsServerInfo section.
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+    // Start of MdnsInfo section.
+    if (mTelemetryPublisher != nullptr)
+    {
+        auto                         mdns       = wpanBorderRouter->mutable_mdns();
+        const MdnsTelemetryInfo     &mdnsInfo   = mTelemetryPublisher->GetMdnsTelemetryInfo();
+        const MdnsLatencyHistograms &histograms = mdnsInfo.mLatencyHistograms;
+
+        CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
+
+        mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
+        mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
+        mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
+        mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+
+        CopyLatencyHistogram(histograms.mHostRegistration, mdns->mutable_host_registration_latency());
+        CopyLatencyHistogram(histograms.mKeyRegistration, mdns->mutable_key_registration_latency());
+        CopyLatencyHistogram(histograms.mServiceRegistration, mdns->mutable_service_registration_latency());
+        CopyLatencyHistogram(histograms.mHostResolution, mdns->mutable_host_resolution_latency());
+        CopyLatencyHistogram(histograms.mServiceResolution, mdns->mutable_service_resolution_latency());
+        CopyLatencyHistogram(histograms.mServiceBrowse, mdns->mutable_service_browse_latency());
+        mdns->set_backend(mTelemetryPublisher->GetBackendName());
+    }
+    // End of MdnsInfo section.
+
 #if OTBR_ENABLE_BORDER_AGENT
-        RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
+    RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
 #endif // OTBR_ENABLE_BORDER_AGENT
-       // End of WpanBorderRouter section.
 
-        // Start of WpanRcp section.
-        {
-            auto                        wpanRcp                = telemetryData.mutable_wpan_rcp();
-            const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
-            auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
+    return OT_ERROR_NONE;
+}
 
-            if (otRadioSpinelMetrics != nullptr)
-            {
-                rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
-                rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
-                rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
-                rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
-            }
+otError ThreadHelper::RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Start of WpanRcp section.
+    auto                        wpanRcp                = aTelemetryData.mutable_wpan_rcp();
+    const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
+    auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
 
-            // TODO: provide rcp_firmware_update_count info.
-            rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
+    if (otRadioSpinelMetrics != nullptr)
+    {
+        rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
+        rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
+        rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
+        rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
+    }
 
-            const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
+    // TODO: provide rcp_firmware_update_count info.
+    rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
 
-            if (otRcpInterfaceMetrics != nullptr)
-            {
-                auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
-
-                rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
-                rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
-                rcpInterfaceStatistics->set_transferred_valid_frames_count(
-                    otRcpInterfaceMetrics->mTransferredValidFrameCount);
-                rcpInterfaceStatistics->set_transferred_garbage_frames_count(
-                    otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
-                rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
-                rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
-                rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
-                rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
-            }
-        }
-        // End of WpanRcp section.
+    const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
 
-        // Start of CoexMetrics section.
-        {
-            auto               coexMetrics = telemetryData.mutable_coex_metrics();
-            otRadioCoexMetrics otRadioCoexMetrics;
+    if (otRcpInterfaceMetrics != nullptr)
+    {
+        auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
+
+        rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
+        rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
+        rcpInterfaceStatistics->set_transferred_valid_frames_count(
+            otRcpInterfaceMetrics->mTransferredValidFrameCount);
+        rcpInterfaceStatistics->set_transferred_garbage_frames_count(
+            otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
+        rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
+        rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
+        rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
+        rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
+    }
+    // End of WpanRcp section.
 
-            if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
-            {
-                coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
-                coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
-                coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
-                coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
-                coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
-                coexMetrics->set_count_tx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
-                coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
-                coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
-                coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
-                coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
-                coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
-                coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
-                coexMetrics->set_count_rx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
-                coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
-                coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
-        }
-        // End of CoexMetrics section.
+    return OT_ERROR_NONE;
+}
+
+otError ThreadHelper::RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
+
+    // Start of CoexMetrics section.
+    auto               coexMetrics = aTelemetryData.mutable_coex_metrics();
+    otRadioCoexMetrics otRadioCoexMetrics;
+
+    if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
+    {
+        coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
+        coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
+        coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
+        coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
+        coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
+        coexMetrics->set_count_tx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
+        coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
+        coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
+        coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
+        coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
+        coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
+        coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
+        coexMetrics->set_count_rx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
+        coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
+        coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
     }
+    else
+    {
+        error = OT_ERROR_FAILED;
+    }
+    // End of CoexMetrics section.
+
+    return error;
+}
 
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+otError ThreadHelper::RetrieveLowPowerMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto                   lowPowerMetrics = aTelemetryData.mutable_low_power_metrics();
+    otNeighborInfoIterator iter            = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
+
+    // Begin of Link Metrics section.
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
     {
-        auto lowPowerMetrics = telemetryData.mutable_low_power_metrics();
-        // Begin of Link Metrics section.
-        for (const otNeighborInfo &neighborInfo : neighborTable)
-        {
-            otError             query_error;
-            otLinkMetricsValues values;
+        otError             query_error;
+        otLinkMetricsValues values;
 
-            query_error = otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &neighborInfo.mExtAddress, &values);
-            // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
-            // are returned.
-            if (query_error == OT_ERROR_NONE)
-            {
-                auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
-                linkMetricsStats->set_link_margin(values.mLinkMarginValue);
-                linkMetricsStats->set_rssi(values.mRssiValue);
-            }
+        query_error = otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &neighborInfo.mExtAddress, &values);
+        // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
+        // are returned.
+        if (query_error == OT_ERROR_NONE)
+        {
+            auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
+            linkMetricsStats->set_link_margin(values.mLinkMarginValue);
+            linkMetricsStats->set_rssi(values.mRssiValue);
         }
     }
-#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 
-    return error;
+    return OT_ERROR_NONE;
 }
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
 otError ThreadHelper::ProcessDatasetForMigration(otOperationalDatasetTlvs &aDatasetTlvs, uint32_t aDelayMilli)
@@ -50,9 +50,11 @@
 #include <openthread/joiner.h>
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #include "proto/thread_telemetry.pb.h"
+#include "utils/telemetry_cache.hpp"
 #endif
 
 namespace otbr {
@@ -270,6 +272,38 @@ public:
      * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
      */
     otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
+
+    /**
+     * This method retrieves the serialized telemetry data with best effort.
+     *
+     * The telemetry data is assembled from independently cached sections, only the sections which are stale or
+     * invalidated by a state change are retrieved again.
+     *
+     * @param[in]  aPublisher           The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[out] aTelemetryDataBytes  The serialized telemetry data.
+     *
+     * @retval OTBR_ERROR_NONE  There is no error happened in the process.
+     * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
+     */
+    otError RetrieveTelemetryDataBytes(Mdns::Publisher *aPublisher, std::string &aTelemetryDataBytes);
+
+    /**
+     * This method returns the timing statistics of the telemetry sections.
+     *
+     * @returns The statistics of each telemetry section.
+     */
+    std::vector<TelemetryCache::SectionStats> GetTelemetrySectionStats(void) const
+    {
+        return mTelemetryCache.GetSectionStats();
+    }
+
+    /**
+     * This method notifies that the hosts or services registered on the SRP server changed.
+     *
+     * The registrations aren't signaled by the state changed flags, so the telemetry sections describing the SRP
+     * server are retrieved again by the next `RetrieveTelemetryDataBytes()`.
+     */
+    void HandleSrpServerChanged(void);
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
     /**
@@ -324,6 +358,30 @@ private:
     void        BorderRoutingDhcp6PdCallback(otBorderRoutingDhcp6PdState aState);
 #endif
 #if OTBR_ENABLE_TELEMETRY_DATA_API
+    using TelemetrySectionRetriever = otError (ThreadHelper::*)(threadnetwork::TelemetryData &aTelemetryData);
+
+    struct TelemetrySection
+    {
+        const char               *mName;
+        Milliseconds              mMaxAge;
+        otChangedFlags            mInvalidatingFlags;
+        bool                      mDescribesSrpServer;
+        TelemetrySectionRetriever mRetriever;
+    };
+
+    static const TelemetrySection kTelemetrySections[];
+
+    void    InitTelemetryCache(void);
+    void    InvalidateTelemetryCache(otChangedFlags aFlags);
+    otError RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanTopology(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanBorderRouter(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanBorderRouterCounters(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    otError RetrieveLowPowerMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#endif
 #if OTBR_ENABLE_BORDER_ROUTING
     void RetrieveInfraLinkInfo(threadnetwork::TelemetryData::InfraLinkInfo &aInfraLinkInfo);
     void RetrieveExternalRouteInfo(threadnetwork::TelemetryData::ExternalRoutes &aExternalRouteInfo);
@@ -376,6 +434,11 @@ private:
     static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
     uint8_t                  mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
 #endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    TelemetryCache   mTelemetryCache;
+    Mdns::Publisher *mTelemetryPublisher = nullptr;
+#endif
 };
 
 } // namespace agent
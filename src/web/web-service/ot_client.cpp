@@ -34,6 +34,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -46,6 +47,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 
 // Temporary solution before posix platform header files are cleaned up.
 #ifndef OPENTHREAD_POSIX_DAEMON_SOCKET_NAME
@@ -85,7 +87,9 @@ void OpenThreadClient::Disconnect(void)
 bool OpenThreadClient::Connect(void)
 {
     struct sockaddr_un sockname;
-    int                ret;
+    int                ret = 0;
+
+    VerifyOrExit(mSocket == -1);
 
     mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
@@ -107,6 +111,11 @@ bool OpenThreadClient::Connect(void)
     }
 
 exit:
+    if (ret != 0)
+    {
+        Disconnect();
+    }
+
     return ret == 0;
 }
 
@@ -117,7 +126,7 @@ void OpenThreadClient::DiscardRead(void)
     ssize_t count;
     int     ret;
 
-    for (;;)
+    while (mSocket != -1)
     {
         FD_ZERO(&readFdSet);
         FD_SET(mSocket, &readFdSet);
@@ -131,23 +140,40 @@ void OpenThreadClient::DiscardRead(void)
         count = read(mSocket, mBuffer, sizeof(mBuffer));
         if (count <= 0)
         {
+            // The daemon closed the session, usually because another client connected.
+            Disconnect();
             break;
         }
     }
 }
 
+bool OpenThreadClient::Send(size_t aLength)
+{
+    ssize_t count = -1;
+
+    VerifyOrExit(mSocket != -1);
+
+#ifdef __linux__
+    // Don't die on SIGPIPE when the daemon closed the session.
+    count = send(mSocket, mBuffer, aLength, MSG_NOSIGNAL);
+#else
+    count = write(mSocket, mBuffer, aLength);
+#endif
+
+exit:
+    return count == static_cast<ssize_t>(aLength);
+}
+
 char *OpenThreadClient::Execute(const char *aFormat, ...)
 {
     va_list args;
     int     ret;
     char   *rval = nullptr;
-    ssize_t count;
-    size_t  rxLength = 0;
 
     DiscardRead();
 
     va_start(args, aFormat);
-    ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 2, aFormat, args);
+    ret = vsnprintf(mBuffer, sizeof(mBuffer) - 1, aFormat, args);
     va_end(args);
 
     if (ret < 0)
@@ -155,62 +181,118 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
         otbrLogErr("Failed to generate command: %s", strerror(errno));
         ExitNow();
     }
-    if (static_cast<size_t>(ret) >= sizeof(mBuffer) - 2)
+    if (static_cast<size_t>(ret) >= sizeof(mBuffer) - 1)
     {
         otbrLogErr("Command exceeds maximum limit: %d", kBufferSize);
         ExitNow();
     }
 
-    mBuffer[0]       = '\n';
-    mBuffer[ret + 1] = '\n';
-    ret += 2;
-
-    count = write(mSocket, mBuffer, ret);
+    mBuffer[ret++] = '\n';
 
-    if (count != ret)
+    // The command wasn't delivered if the session is gone, so it's safe to send it again on a new session.
+    if (!Send(ret))
     {
-        mBuffer[ret] = '\0';
-        otbrLogErr("Failed to send command: %s", mBuffer);
-        ExitNow();
+        Disconnect();
+
+        if (!Connect() || !Send(ret))
+        {
+            mBuffer[ret - 1] = '\0';
+            otbrLogErr("Failed to send command: %s", mBuffer);
+            ExitNow();
+        }
     }
 
-    for (int i = 0; i < mTimeout; ++i)
+    rval = ReadResult();
+
+exit:
+    return rval;
+}
+
+char *OpenThreadClient::ReadResult(void)
+{
+    static const char kDone[]   = "Done";
+    static const char kError[]  = "Error ";
+    static const char kPrompt[] = "> ";
+
+    char     *rval         = nullptr;
+    size_t    rxLength     = 0;
+    size_t    lineStart    = 0;
+    bool      isTerminated = false;
+    bool      isDone       = false;
+    Timepoint deadline     = Clock::now() + Milliseconds(mTimeout);
+
+    while (!isTerminated)
     {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char   *done;
+        struct pollfd pollFd = {mSocket, POLLIN, 0};
+        int           timeout;
+        int           ret;
+        ssize_t       count;
 
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+        timeout = static_cast<int>(std::chrono::duration_cast<Milliseconds>(deadline - Clock::now()).count());
+        VerifyOrExit(timeout > 0, otbrLogWarning("Timed out waiting for the CLI response"));
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
+        ret = poll(&pollFd, 1, timeout);
         VerifyOrExit(ret != -1 || errno == EINTR);
         if (ret <= 0)
         {
             continue;
         }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
+        VerifyOrExit(rxLength < sizeof(mBuffer) - 1, otbrLogWarning("CLI response exceeds %d bytes", kBufferSize));
+        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - 1 - rxLength);
         VerifyOrExit(count > 0);
         rxLength += count;
-
         mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n> ");
 
-        if (done != nullptr)
+        // The response is terminated by a `Done` or `Error` line, which may be preceded by a prompt.
+        while (!isTerminated)
         {
-            // remove trailing \r\n
-            if (done - mBuffer > 2)
+            char *line    = &mBuffer[lineStart];
+            char *lineEnd = strstr(line, "\r\n");
+
+            if (lineEnd == nullptr)
             {
-                done[-2] = '\0';
+                break;
             }
 
-            rval = mBuffer;
-            break;
+            if (strncmp(line, kPrompt, sizeof(kPrompt) - 1) == 0)
+            {
+                line += sizeof(kPrompt) - 1;
+            }
+
+            isDone       = (lineEnd - line == sizeof(kDone) - 1) && strncmp(line, kDone, sizeof(kDone) - 1) == 0;
+            isTerminated = isDone || strncmp(line, kError, sizeof(kError) - 1) == 0;
+
+            if (!isTerminated)
+            {
+                lineStart = static_cast<size_t>(lineEnd + 2 - mBuffer);
+            }
+        }
+    }
+
+    if (isDone)
+    {
+        char *output = mBuffer;
+        char *end    = &mBuffer[lineStart];
+
+        // Removes the prompt left by the previous command and the trailing \r\n.
+        if (strncmp(output, kPrompt, sizeof(kPrompt) - 1) == 0)
+        {
+            output += sizeof(kPrompt) - 1;
         }
+
+        end  = (end - output >= 2) ? end - 2 : output;
+        *end = '\0';
+        rval = output;
     }
 
 exit:
+    if (!isTerminated)
+    {
+        // The rest of the response would be taken for the response of the next command.
+        Disconnect();
+    }
+
     return rval;
 }
 
@@ -248,6 +330,7 @@ int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
 
     mTimeout = 5000;
     result   = Execute("scan");
+    mTimeout = kDefaultTimeout;
     VerifyOrExit(result != nullptr);
 
     for (result = strtok(result, "\r\n"); result != nullptr && rval < aLength; result = strtok(nullptr, "\r\n"))
@@ -286,8 +369,6 @@ int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
         ++rval;
     }
 
-    mTimeout = kDefaultTimeout;
-
 exit:
     return rval;
 }
@@ -318,5 +399,52 @@ exit:
     return rval;
 }
 
+OpenThreadClientPool::Lease::Lease(Lease &&aOther)
+    : mPool(aOther.mPool)
+    , mClient(aOther.mClient)
+{
+    aOther.mClient = nullptr;
+}
+
+OpenThreadClientPool::Lease::~Lease(void)
+{
+    if (mClient != nullptr)
+    {
+        mPool->Release(mClient);
+    }
+}
+
+OpenThreadClientPool::OpenThreadClientPool(const char *aNetifName, size_t aSize)
+{
+    for (size_t i = 0; i < aSize; i++)
+    {
+        mClients.emplace_back(new OpenThreadClient(aNetifName));
+        mIdleClients.push_back(mClients.back().get());
+    }
+}
+
+OpenThreadClientPool::Lease OpenThreadClientPool::Acquire(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    OpenThreadClient            *client;
+
+    mCondition.wait(lock, [this] { return !mIdleClients.empty(); });
+    client = mIdleClients.back();
+    mIdleClients.pop_back();
+
+    return Lease(*this, client);
+}
+
+void OpenThreadClientPool::Release(OpenThreadClient *aClient)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mIdleClients.push_back(aClient);
+    }
+
+    mCondition.notify_one();
+}
+
 } // namespace Web
 } // namespace otbr
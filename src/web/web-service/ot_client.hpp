@@ -36,6 +36,11 @@
 
 #include "openthread-br/config.h"
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <stdint.h>
 
 namespace otbr {
@@ -81,6 +86,8 @@ public:
     /**
      * This method connects to OpenThread daemon.
      *
+     * The existing connection is kept if the client is already connected.
+     *
      * @retval TRUE   Successfully connected to the daemon.
      * @retval FALSE  Failed to connected to the daemon.
      */
@@ -89,10 +96,14 @@ public:
     /**
      * This method executes OpenThread CLI.
      *
+     * The response is read until the `Done` or `Error` line which terminates it, so a command doesn't wait for the
+     * timeout unless the daemon stops responding. The client reconnects if the daemon closed the session, for example
+     * because `ot-ctl` took it over.
+     *
      * @param[in] aFormat  C style format string.
      * @param[in] ...      C style format arguments.
      *
-     * @returns A pointer to the output if succeeded, otherwise nullptr.
+     * @returns A pointer to the output if the command succeeded, otherwise nullptr.
      */
     char *Execute(const char *aFormat, ...);
 
@@ -122,8 +133,10 @@ public:
     bool FactoryReset(void);
 
 private:
-    void Disconnect(void);
-    void DiscardRead(void);
+    void  Disconnect(void);
+    void  DiscardRead(void);
+    bool  Send(size_t aLength);
+    char *ReadResult(void);
 
     enum
     {
@@ -137,6 +150,70 @@ private:
     int         mSocket;
 };
 
+/**
+ * This class implements a pool of long-lived OpenThread CLI sessions shared by the web requests.
+ *
+ * A request leases a session for the sequence of commands it executes and returns it afterwards, so the sessions stay
+ * connected across requests. The OpenThread daemon serves a single CLI session and closes it when another client
+ * connects, so the web service uses a pool of one session which the requests take turns on.
+ */
+class OpenThreadClientPool
+{
+public:
+    /**
+     * This class represents a session leased from the pool, which is returned to the pool on destruction.
+     */
+    class Lease
+    {
+    public:
+        Lease(Lease &&aOther);
+        ~Lease(void);
+
+        OpenThreadClient &operator*(void) const { return *mClient; }
+        OpenThreadClient *operator->(void) const { return mClient; }
+
+    private:
+        friend class OpenThreadClientPool;
+
+        Lease(OpenThreadClientPool &aPool, OpenThreadClient *aClient)
+            : mPool(&aPool)
+            , mClient(aClient)
+        {
+        }
+
+        Lease(const Lease &)            = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        OpenThreadClientPool *mPool;
+        OpenThreadClient     *mClient;
+    };
+
+    /**
+     * This constructor creates a pool of OpenThread CLI sessions.
+     *
+     * @param[in] aNetifName  The Thread network interface name, it must outlive the pool.
+     * @param[in] aSize       The number of sessions.
+     */
+    OpenThreadClientPool(const char *aNetifName, size_t aSize);
+
+    /**
+     * This method leases a session, waiting until one is available.
+     *
+     * The session isn't connected by the pool, the caller should call `Connect()` which keeps an existing connection.
+     *
+     * @returns The leased session.
+     */
+    Lease Acquire(void);
+
+private:
+    void Release(OpenThreadClient *aClient);
+
+    std::vector<std::unique_ptr<OpenThreadClient>> mClients;
+    std::vector<OpenThreadClient *>                mIdleClients;
+    std::mutex                                     mMutex;
+    std::condition_variable                        mCondition;
+};
+
 } // namespace Web
 } // namespace otbr
 
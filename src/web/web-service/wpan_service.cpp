@@ -52,19 +52,26 @@ namespace Web {
 #define CREDENTIAL_TYPE_NETWORK_KEY "networkKeyType"
 #define CREDENTIAL_TYPE_PSKD "pskdType"
 
+WpanService::WpanService(void)
+    : mNetworksCount(0)
+    , mIfName()
+    , mClientPool(mIfName, kCliSessionCount)
+{
+}
+
 std::string WpanService::HandleGetQRCodeRequest()
 {
     Json::Value                 root, networkInfo;
     Json::FastWriter            jsonWriter;
     std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
     char                       *rval;
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
     // eui64 is the only required information to generate the QR code.
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
 
 exit:
 
@@ -97,11 +104,11 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
     std::string                 pskd;
     std::string                 prefix;
     bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
     char                       *rval;
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     index          = root["index"].asUInt();
@@ -116,19 +123,19 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    VerifyOrExit(client->FactoryReset(), ret = kWpanStatus_LeaveFailed);
 
     if (credentialType == CREDENTIAL_TYPE_NETWORK_KEY)
     {
-        VerifyOrExit((ret = joinActiveDataset(client, networkKey, mNetworks[index].mChannel,
+        VerifyOrExit((ret = joinActiveDataset(*client, networkKey, mNetworks[index].mChannel,
                                               mNetworks[index].mPanId)) == kWpanStatus_Ok);
-        VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+        VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
     }
     else if (credentialType == CREDENTIAL_TYPE_PSKD)
     {
-        VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
-        VerifyOrExit(client.Execute("joiner start %s", pskd.c_str()) != nullptr, ret = kWpanStatus_JoinFailed);
-        VerifyOrExit((rval = client.Read("Join ", 5000)) != nullptr, ret = kWpanStatus_JoinFailed);
+        VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+        VerifyOrExit(client->Execute("joiner start %s", pskd.c_str()) != nullptr, ret = kWpanStatus_JoinFailed);
+        VerifyOrExit((rval = client->Read("Join ", 5000)) != nullptr, ret = kWpanStatus_JoinFailed);
         if (strstr(rval, "Join success"))
         {
             ExitNow();
@@ -151,8 +158,8 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         ExitNow(ret = kWpanStatus_JoinFailed);
     }
 
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(client->Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
+    VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 
 exit:
@@ -198,10 +205,10 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     uint16_t                    panId;
     uint64_t                    extPanId;
     bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
     pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
     VerifyOrExit(reader.parse(aFormRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -224,12 +231,12 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = formActiveDataset(client, networkKey, networkName, pskcStr, channel, extPanId, panId)) ==
+    VerifyOrExit(client->FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    VerifyOrExit((ret = formActiveDataset(*client, networkKey, networkName, pskcStr, channel, extPanId, panId)) ==
                  kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
+    VerifyOrExit(client->Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
+    VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
 
@@ -254,10 +261,10 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
     std::string                 response;
     std::string                 prefix;
     bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix       = root["prefix"].asString();
@@ -268,9 +275,9 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
         prefix += "/64";
     }
 
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetGatewayFailed);
-    VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    VerifyOrExit(client->Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
 
     root.clear();
@@ -293,10 +300,10 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
     Json::Reader                reader;
     std::string                 response;
     std::string                 prefix;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix = root["prefix"].asString();
@@ -306,8 +313,8 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
         prefix += "/64";
     }
 
-    VerifyOrExit(client.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
-    VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    VerifyOrExit(client->Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    VerifyOrExit(client->Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
 
     root.clear();
@@ -328,14 +335,14 @@ std::string WpanService::HandleStatusRequest()
     Json::Value                 root, networkInfo;
     Json::FastWriter            jsonWriter;
     std::string                 response, networkName, extPanId, propertyValue;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
     char                       *rval;
 
     networkInfo["WPAN service"] = "uninitialized";
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_SetFailed);
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["RCP:State"] = rval;
 
     if (!strcmp(rval, "disabled"))
@@ -353,34 +360,34 @@ std::string WpanService::HandleStatusRequest()
         networkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["OpenThread:Version"] = rval;
 
-    VerifyOrExit((rval = client.Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["OpenThread:Version API"] = rval;
 
-    VerifyOrExit((rval = client.Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["RCP:Version"] = rval;
 
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["RCP:EUI64"] = rval;
 
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["RCP:Channel"] = rval;
 
-    VerifyOrExit((rval = client.Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["RCP:TxPower"] = rval;
 
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:Name"] = rval;
 
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:XPANID"] = rval;
 
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:PANID"] = rval;
 
-    VerifyOrExit((rval = client.Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
     networkInfo["Network:PartitionID"] = rval;
 
     {
@@ -390,7 +397,7 @@ std::string WpanService::HandleStatusRequest()
         static const char linkLocalAddressToken[]         = "fe80";
         std::string       meshLocalPrefix                 = "";
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = client->Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
         rval = strstr(rval, kMeshLocalPrefixLocator);
         if (rval != nullptr)
         {
@@ -402,7 +409,7 @@ std::string WpanService::HandleStatusRequest()
             meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
         }
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = client->Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
 
         for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
@@ -471,11 +478,11 @@ std::string WpanService::HandleAvailableNetworkRequest()
     Json::Value                 root, networks, networkInfo;
     Json::FastWriter            jsonWriter;
     std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int                         ret    = kWpanStatus_Ok;
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
+    VerifyOrExit(client->Connect(), ret = kWpanStatus_ScanFailed);
+    VerifyOrExit((mNetworksCount = client->Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
                  ret = kWpanStatus_NetworkNotFound);
 
     for (int i = 0; i < mNetworksCount; i++)
@@ -504,11 +511,11 @@ exit:
 int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
 {
     int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    OpenThreadClientPool::Lease client = mClientPool.Acquire();
     const char                 *rval;
 
-    VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
-    rval = client.Execute("state");
+    VerifyOrExit(client->Connect(), status = kWpanStatus_Uninitialized);
+    rval = client->Execute("state");
     VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
     if (!strcmp(rval, "disabled"))
     {
@@ -520,11 +527,11 @@ int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aE
     }
     else
     {
-        rval = client.Execute("networkname");
+        rval = client->Execute("networkname");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aNetworkName = rval;
 
-        rval = client.Execute("extpanid");
+        rval = client->Execute("extpanid");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aExtPanId = rval;
     }
@@ -548,21 +555,21 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     pskd = root["pskd"].asString();
 
     {
-        otbr::Web::OpenThreadClient client(mIfName);
+        OpenThreadClientPool::Lease client = mClientPool.Acquire();
 
-        VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
+        VerifyOrExit(client->Connect(), ret = kWpanStatus_Uninitialized);
 
         for (int i = 0; i < 5; i++)
         {
-            VerifyOrExit((rval = client.Execute("commissioner state")) != nullptr, ret = kWpanStatus_Down);
+            VerifyOrExit((rval = client->Execute("commissioner state")) != nullptr, ret = kWpanStatus_Down);
 
             if (strcmp(rval, "disabled") == 0)
             {
-                VerifyOrExit((rval = client.Execute("commissioner start")) != nullptr, ret = kWpanStatus_Down);
+                VerifyOrExit((rval = client->Execute("commissioner start")) != nullptr, ret = kWpanStatus_Down);
             }
             else if (strcmp(rval, "active") == 0)
             {
-                VerifyOrExit(client.Execute("commissioner joiner add * %s", pskd.c_str()) != nullptr,
+                VerifyOrExit(client->Execute("commissioner joiner add * %s", pskd.c_str()) != nullptr,
                              ret = kWpanStatus_Down);
                 root["error"] = ret;
                 ExitNow();
@@ -571,7 +578,7 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
             sleep(1);
         }
 
-        client.Execute("commissioner stop");
+        client->Execute("commissioner stop");
     }
 
     ret = kWpanStatus_SetFailed;
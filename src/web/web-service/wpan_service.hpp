@@ -71,6 +71,11 @@ namespace Web {
 class WpanService
 {
 public:
+    /**
+     * This constructor initializes the wpan service.
+     */
+    WpanService(void);
+
     /**
      * This method handles http request to get information to generate QR code.
      *
@@ -188,6 +193,13 @@ private:
     std::string     mNetworkName;
     std::string     mExtPanId;
 
+    enum
+    {
+        kCliSessionCount = 1, ///< The OpenThread daemon serves a single CLI session.
+    };
+
+    mutable OpenThreadClientPool mClientPool;
+
     enum
     {
         kWpanStatus_Ok = 0,
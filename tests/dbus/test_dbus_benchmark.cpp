@@ -0,0 +1,253 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a benchmark of the latency of a full status dump with `ThreadApiDBus`, fetching the
+ *   properties one by one and with pipelined asynchronous requests.
+ */
+
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/client/thread_api_dbus.hpp"
+#include "dbus/common/constants.hpp"
+
+using namespace otbr::DBus;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kIterations    = 20;
+constexpr int kPollTimeoutMs = 100; ///< Bounds the wait so that libdbus can expire timed out calls.
+
+struct DBusConnectionDeleter
+{
+    void operator()(DBusConnection *aConnection) { dbus_connection_unref(aConnection); }
+};
+
+using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
+
+struct DumpResult
+{
+    size_t mNumSucceeded = 0;
+    size_t mNumFailed    = 0;
+};
+
+using PropertyRequest = std::function<ClientError(ThreadApiDBus &aApi, DumpResult &aResult)>;
+
+template <typename ValType> PropertyRequest MakeRequest(const char *aPropertyName)
+{
+    return [aPropertyName](ThreadApiDBus &aApi, DumpResult &aResult) {
+        return aApi.GetPropertyAsync<ValType>(aPropertyName, [&aResult](ClientError aError, const ValType &) {
+            if (aError == ClientError::ERROR_NONE)
+            {
+                aResult.mNumSucceeded++;
+            }
+            else
+            {
+                aResult.mNumFailed++;
+            }
+        });
+    };
+}
+
+const std::vector<PropertyRequest> &GetStatusRequests(void)
+{
+    static const std::vector<PropertyRequest> sRequests = {
+        MakeRequest<std::string>(OTBR_DBUS_PROPERTY_DEVICE_ROLE),
+        MakeRequest<std::string>(OTBR_DBUS_PROPERTY_NETWORK_NAME),
+        MakeRequest<uint16_t>(OTBR_DBUS_PROPERTY_PANID),
+        MakeRequest<uint64_t>(OTBR_DBUS_PROPERTY_EXTPANID),
+        MakeRequest<uint16_t>(OTBR_DBUS_PROPERTY_CHANNEL),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_NETWORK_KEY),
+        MakeRequest<uint16_t>(OTBR_DBUS_PROPERTY_CCA_FAILURE_RATE),
+        MakeRequest<MacCounters>(OTBR_DBUS_PROPERTY_LINK_COUNTERS),
+        MakeRequest<IpCounters>(OTBR_DBUS_PROPERTY_IP6_COUNTERS),
+        MakeRequest<uint32_t>(OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK),
+        MakeRequest<uint32_t>(OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK),
+        MakeRequest<uint16_t>(OTBR_DBUS_PROPERTY_RLOC16),
+        MakeRequest<uint64_t>(OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS),
+        MakeRequest<uint8_t>(OTBR_DBUS_PROPERTY_ROUTER_ID),
+        MakeRequest<LeaderData>(OTBR_DBUS_PROPERTY_LEADER_DATA),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY),
+        MakeRequest<uint8_t>(OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT),
+        MakeRequest<uint32_t>(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT),
+        MakeRequest<std::vector<ChannelQuality>>(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES),
+        MakeRequest<std::vector<ChildInfo>>(OTBR_DBUS_PROPERTY_CHILD_TABLE),
+        MakeRequest<std::vector<NeighborInfo>>(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY),
+        MakeRequest<uint32_t>(OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY),
+        MakeRequest<int8_t>(OTBR_DBUS_PROPERTY_INSTANT_RSSI),
+        MakeRequest<int8_t>(OTBR_DBUS_PROPERTY_RADIO_TX_POWER),
+        MakeRequest<std::vector<ExternalRoute>>(OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES),
+        MakeRequest<std::vector<OnMeshPrefix>>(OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_PENDING_DATASET_TLVS),
+        MakeRequest<std::string>(OTBR_DBUS_PROPERTY_RADIO_REGION),
+        MakeRequest<SrpServerInfo>(OTBR_DBUS_PROPERTY_SRP_SERVER_INFO),
+        MakeRequest<otbr::MdnsTelemetryInfo>(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO),
+        MakeRequest<DnssdCounters>(OTBR_DBUS_PROPERTY_DNSSD_COUNTERS),
+        MakeRequest<LinkModeConfig>(OTBR_DBUS_PROPERTY_LINK_MODE),
+        MakeRequest<uint64_t>(OTBR_DBUS_PROPERTY_UPTIME),
+        MakeRequest<uint64_t>(OTBR_DBUS_PROPERTY_EUI64),
+        MakeRequest<uint16_t>(OTBR_DBUS_PROPERTY_THREAD_VERSION),
+        MakeRequest<RadioSpinelMetrics>(OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS),
+        MakeRequest<RcpInterfaceMetrics>(OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS),
+        MakeRequest<RadioCoexMetrics>(OTBR_DBUS_PROPERTY_RADIO_COEX_METRICS),
+        MakeRequest<BorderRoutingCounters>(OTBR_DBUS_PROPERTY_BORDER_ROUTING_COUNTERS),
+        MakeRequest<Nat64ComponentState>(OTBR_DBUS_PROPERTY_NAT64_STATE),
+        MakeRequest<InfraLinkInfo>(OTBR_DBUS_PROPERTY_INFRA_LINK_INFO),
+        MakeRequest<TrelInfo>(OTBR_DBUS_PROPERTY_TREL_INFO),
+        MakeRequest<std::vector<uint8_t>>(OTBR_DBUS_PROPERTY_CAPABILITIES),
+    };
+
+    return sRequests;
+}
+
+// Runs the event loop of the benchmark until all the requests are
+// answered, the connection is polled through the file descriptor
+// exposed by `ThreadApiDBus`, as an external event loop would do.
+bool WaitForReplies(ThreadApiDBus &aApi)
+{
+    bool succeeded = true;
+
+    aApi.Process();
+
+    while (aApi.GetPendingCallCount() > 0)
+    {
+        pollfd pollFd = {aApi.GetFd(), static_cast<short>(POLLIN | (aApi.IsWritePending() ? POLLOUT : 0)), 0};
+
+        VerifyOrExit(poll(&pollFd, 1, kPollTimeoutMs) >= 0, succeeded = false);
+        aApi.Process();
+    }
+
+exit:
+    return succeeded;
+}
+
+double DumpSequentially(ThreadApiDBus &aApi, DumpResult &aResult)
+{
+    Clock::time_point start = Clock::now();
+
+    for (const PropertyRequest &request : GetStatusRequests())
+    {
+        if (request(aApi, aResult) != ClientError::ERROR_NONE || !WaitForReplies(aApi))
+        {
+            aResult.mNumFailed++;
+        }
+    }
+
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double DumpPipelined(ThreadApiDBus &aApi, DumpResult &aResult)
+{
+    Clock::time_point start = Clock::now();
+
+    for (const PropertyRequest &request : GetStatusRequests())
+    {
+        if (request(aApi, aResult) != ClientError::ERROR_NONE)
+        {
+            aResult.mNumFailed++;
+        }
+    }
+
+    if (!WaitForReplies(aApi))
+    {
+        aResult.mNumFailed++;
+    }
+
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void Report(const char *aName, std::vector<double> &aLatencies, const DumpResult &aResult)
+{
+    double total = 0;
+
+    std::sort(aLatencies.begin(), aLatencies.end());
+    for (double latency : aLatencies)
+    {
+        total += latency;
+    }
+
+    printf("%-10s %zu properties: avg %7.2f ms, min %7.2f ms, median %7.2f ms, max %7.2f ms (%zu ok, %zu failed)\n",
+           aName, GetStatusRequests().size(), total / aLatencies.size(), aLatencies.front(),
+           aLatencies[aLatencies.size() / 2], aLatencies.back(), aResult.mNumSucceeded, aResult.mNumFailed);
+}
+
+} // namespace
+
+int main(void)
+{
+    int                  ret = EXIT_FAILURE;
+    DBusError            error;
+    UniqueDBusConnection connection;
+    std::vector<double>  sequentialLatencies;
+    std::vector<double>  pipelinedLatencies;
+    DumpResult           sequentialResult;
+    DumpResult           pipelinedResult;
+
+    dbus_error_init(&error);
+    connection = UniqueDBusConnection(dbus_bus_get(DBUS_BUS_SYSTEM, &error));
+    VerifyOrExit(connection != nullptr, fprintf(stderr, "Failed to connect to the system bus: %s\n", error.message));
+
+    {
+        ThreadApiDBus api(connection.get());
+
+        for (int i = 0; i < kIterations; i++)
+        {
+            sequentialLatencies.push_back(DumpSequentially(api, sequentialResult));
+            pipelinedLatencies.push_back(DumpPipelined(api, pipelinedResult));
+        }
+    }
+
+    Report("sequential", sequentialLatencies, sequentialResult);
+    Report("pipelined", pipelinedLatencies, pipelinedResult);
+
+    // Properties of disabled features fail the same way in both modes.
+    VerifyOrExit(sequentialResult.mNumSucceeded > 0 && sequentialResult.mNumSucceeded == pipelinedResult.mNumSucceeded,
+                 fprintf(stderr, "Status dumps returned different results\n"));
+    ret = EXIT_SUCCESS;
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
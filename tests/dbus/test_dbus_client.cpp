@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <chrono>
 #include <memory>
 
 #include <dbus/dbus.h>
@@ -52,7 +53,9 @@ using otbr::DBus::ExternalRoute;
 using otbr::DBus::Ip6Prefix;
 using otbr::DBus::LinkModeConfig;
 using otbr::DBus::OnMeshPrefix;
+using otbr::DBus::PropertyValues;
 using otbr::DBus::SrpServerInfo;
+using otbr::DBus::TelemetrySectionStats;
 using otbr::DBus::ThreadApiDBus;
 using otbr::DBus::TxtEntry;
 
@@ -84,6 +87,33 @@ struct DBusConnectionDeleter
 
 using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
 
+static size_t sNumPropertiesChangedSignals = 0;
+static size_t sNumChangedProperties        = 0;
+static size_t sNumDeviceRoleChanges        = 0;
+
+static DBusHandlerResult CountPropertiesChanged(DBusConnection *aConnection, DBusMessage *aMessage, void *aContext)
+{
+    DBusMessageIter iter, subIter;
+
+    OTBR_UNUSED_VARIABLE(aConnection);
+    OTBR_UNUSED_VARIABLE(aContext);
+
+    if (dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL) &&
+        dbus_message_iter_init(aMessage, &iter) && dbus_message_iter_next(&iter) &&
+        dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY)
+    {
+        sNumPropertiesChangedSignals++;
+
+        for (dbus_message_iter_recurse(&iter, &subIter);
+             dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
+        {
+            sNumChangedProperties++;
+        }
+    }
+
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
 static bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &aRhs)
 {
     bool prefixDataEquality = (aLhs.mPrefix.size() == aRhs.mPrefix.size()) &&
@@ -219,12 +249,29 @@ void CheckDnssdCounters(ThreadApiDBus *aApi)
 
 void CheckMdnsInfo(ThreadApiDBus *aApi)
 {
-    otbr::MdnsTelemetryInfo mdnsInfo;
+    otbr::MdnsTelemetryInfo     mdnsInfo;
+    otbr::MdnsLatencyHistograms histograms;
 
     TEST_ASSERT(aApi->GetMdnsTelemetryInfo(mdnsInfo) == OTBR_ERROR_NONE);
 
     TEST_ASSERT(mdnsInfo.mServiceRegistrations.mSuccess > 0);
     TEST_ASSERT(mdnsInfo.mServiceRegistrationEmaLatency > 0);
+
+    TEST_ASSERT(aApi->GetMdnsLatencyHistograms(histograms) == OTBR_ERROR_NONE);
+    TEST_ASSERT(histograms.mServiceRegistration.GetCount() > 0);
+    TEST_ASSERT(histograms.mServiceRegistration.GetMax() > 0);
+}
+
+void CheckMainloopLatency(ThreadApiDBus *aApi)
+{
+    otbr::DBus::MainloopLatency latency;
+
+    TEST_ASSERT(aApi->GetMainloopLatency(latency) == OTBR_ERROR_NONE);
+    if (latency.mProfilingEnabled)
+    {
+        TEST_ASSERT(latency.mIterationLatency.GetCount() > 0);
+        TEST_ASSERT(!latency.mProcessors.empty());
+    }
 }
 
 void CheckNat64(ThreadApiDBus *aApi)
@@ -373,6 +420,46 @@ void CheckTelemetryData(ThreadApiDBus *aApi)
     CheckBorderAgentInfo(telemetryData.wpan_border_router().border_agent_info());
 #endif
 }
+
+// Requests the telemetry data repeatedly and prints how long each
+// telemetry section took to retrieve and how often it was reused.
+void CheckTelemetrySectionStats(ThreadApiDBus *aApi)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kIterations = 20;
+
+    std::vector<uint8_t>               telemetryDataBytes;
+    std::vector<TelemetrySectionStats> sectionStats;
+    Clock::time_point                  start         = Clock::now();
+    uint32_t                           cacheHitCount = 0;
+
+    for (int i = 0; i < kIterations; i++)
+    {
+        threadnetwork::TelemetryData telemetryData;
+
+        TEST_ASSERT(aApi->GetTelemetryData(telemetryDataBytes) == OTBR_ERROR_NONE);
+        TEST_ASSERT(telemetryData.ParseFromString(std::string(telemetryDataBytes.begin(), telemetryDataBytes.end())));
+        TEST_ASSERT(telemetryData.topo_entries_size() == 1);
+    }
+    printf("GetTelemetryData: %lld us per call\n",
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count() /
+                                  kIterations));
+
+    TEST_ASSERT(aApi->GetTelemetrySectionStats(sectionStats) == OTBR_ERROR_NONE);
+    TEST_ASSERT(!sectionStats.empty());
+    for (const TelemetrySectionStats &stats : sectionStats)
+    {
+        printf("%-16s refreshes %3u, hits %3u, last %6llu us, max %6llu us, total %8llu us, %5u bytes\n",
+               stats.mName.c_str(), stats.mRefreshCount, stats.mCacheHitCount,
+               static_cast<unsigned long long>(stats.mLastDurationUs),
+               static_cast<unsigned long long>(stats.mMaxDurationUs),
+               static_cast<unsigned long long>(stats.mTotalDurationUs), stats.mFragmentSize);
+        TEST_ASSERT(stats.mRefreshCount > 0);
+        cacheHitCount += stats.mCacheHitCount;
+    }
+    TEST_ASSERT(cacheHitCount > 0);
+}
 #endif
 
 void CheckCapabilities(ThreadApiDBus *aApi)
@@ -394,6 +481,60 @@ void CheckCapabilities(ThreadApiDBus *aApi)
     TEST_ASSERT(capabilities.nat64() == OTBR_ENABLE_NAT64);
 }
 
+// Compares getting the network properties one by one with getting
+// them in a single `GetPropertiesDict` call.
+static void CheckGetProperties(ThreadApiDBus *aApi)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kIterations = 100;
+
+    const std::vector<std::string> kPropertyNames = {
+        OTBR_DBUS_PROPERTY_NETWORK_NAME, OTBR_DBUS_PROPERTY_PANID,  OTBR_DBUS_PROPERTY_EXTPANID,
+        OTBR_DBUS_PROPERTY_CHANNEL,      OTBR_DBUS_PROPERTY_RLOC16, OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS,
+    };
+
+    std::string       name, bulkName;
+    uint16_t          panId, bulkPanId, channel, bulkChannel, rloc16, bulkRloc16;
+    uint64_t          extPanId, bulkExtPanId, extAddress, bulkExtAddress;
+    PropertyValues    values;
+    Clock::time_point start;
+    double            singleUs, bulkUs;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        TEST_ASSERT(aApi->GetNetworkName(name) == ClientError::ERROR_NONE);
+        TEST_ASSERT(aApi->GetPanId(panId) == ClientError::ERROR_NONE);
+        TEST_ASSERT(aApi->GetExtPanId(extPanId) == ClientError::ERROR_NONE);
+        TEST_ASSERT(aApi->GetChannel(channel) == ClientError::ERROR_NONE);
+        TEST_ASSERT(aApi->GetRloc16(rloc16) == ClientError::ERROR_NONE);
+        TEST_ASSERT(aApi->GetExtendedAddress(extAddress) == ClientError::ERROR_NONE);
+    }
+    singleUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kIterations;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        TEST_ASSERT(aApi->GetProperties(kPropertyNames, values) == ClientError::ERROR_NONE);
+    }
+    bulkUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kIterations;
+
+    TEST_ASSERT(values.GetSize() == kPropertyNames.size());
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_NETWORK_NAME, bulkName) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_PANID, bulkPanId) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_EXTPANID, bulkExtPanId) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_CHANNEL, bulkChannel) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_RLOC16, bulkRloc16) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS, bulkExtAddress) == ClientError::ERROR_NONE);
+    TEST_ASSERT(bulkName == name && bulkPanId == panId && bulkExtPanId == extPanId);
+    TEST_ASSERT(bulkChannel == channel && bulkRloc16 == rloc16 && bulkExtAddress == extAddress);
+    TEST_ASSERT(values.Get(OTBR_DBUS_PROPERTY_DEVICE_ROLE, bulkName) == ClientError::OT_ERROR_NOT_FOUND);
+
+    printf("%zu properties: %zu calls in %.1f us one by one, 1 call in %.1f us with GetPropertiesDict\n",
+           kPropertyNames.size(), kPropertyNames.size(), singleUs, bulkUs);
+}
+
 int main()
 {
     DBusError                      error;
@@ -412,10 +553,15 @@ int main()
 
     VerifyOrExit(dbus_bus_register(connection.get(), &error) == true);
 
+    // Added before the filter of `ThreadApiDBus`, which consumes the signals of device role changes.
+    VerifyOrExit(dbus_connection_add_filter(connection.get(), CountPropertiesChanged, nullptr, nullptr));
+
     api = std::unique_ptr<ThreadApiDBus>(new ThreadApiDBus(connection.get()));
 
-    api->AddDeviceRoleHandler(
-        [](DeviceRole aRole) { printf("Device role changed to %d\n", static_cast<uint8_t>(aRole)); });
+    api->AddDeviceRoleHandler([](DeviceRole aRole) {
+        printf("Device role changed to %d\n", static_cast<uint8_t>(aRole));
+        sNumDeviceRoleChanges++;
+    });
 
     TEST_ASSERT(api->SetRadioRegion("US") == ClientError::ERROR_NONE);
     TEST_ASSERT(api->GetRadioRegion(region) == ClientError::ERROR_NONE);
@@ -503,13 +649,16 @@ int main()
                             CheckSrpServerInfo(api.get());
                             CheckTrelInfo(api.get());
                             CheckMdnsInfo(api.get());
+                            CheckMainloopLatency(api.get());
                             CheckDnssdCounters(api.get());
                             CheckNat64(api.get());
                             CheckEphemeralKey(api.get());
 #if OTBR_ENABLE_TELEMETRY_DATA_API
                             CheckTelemetryData(api.get());
+                            CheckTelemetrySectionStats(api.get());
 #endif
                             CheckCapabilities(api.get());
+                            CheckGetProperties(api.get());
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
@@ -575,6 +724,13 @@ int main()
         dbus_connection_read_write_dispatch(connection.get(), 0);
     }
 
+    // Property changes of the same mainloop iteration of the server are
+    // coalesced, e.g. the role and the dataset on attaching.
+    printf("%zu PropertiesChanged signals carried %zu property changes for %zu device role changes\n",
+           sNumPropertiesChangedSignals, sNumChangedProperties, sNumDeviceRoleChanges);
+    TEST_ASSERT(sNumDeviceRoleChanges > 0);
+    TEST_ASSERT(sNumPropertiesChangedSignals <= sNumChangedProperties);
+
 exit:
     dbus_error_free(&error);
     return 0;
@@ -0,0 +1,255 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TEST"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "common/binary_log.hpp"
+
+using otbr::BinaryLogReader;
+using otbr::BinaryLogWriter;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct ExpectedLog
+{
+    otbrLogLevel mLevel;
+    std::string  mLogTag;
+    std::string  mText;
+};
+
+std::string MakeLogPath(void)
+{
+    return "/tmp/otbr-gtest-binary-log-" + std::to_string(getpid());
+}
+
+void WriteBinaryLog(BinaryLogWriter &aWriter, otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    aWriter.Write(aLevel, aLogTag, aFormat, args);
+    va_end(args);
+}
+
+// Formats a log as `otbrLog()` does for syslog.
+void WriteTextLog(FILE *aFile, const char *aPrefix, const char *aFormat, ...)
+{
+    char    text[1024];
+    va_list args;
+
+    va_start(args, aFormat);
+    vsnprintf(text, sizeof(text), aFormat, args);
+    va_end(args);
+
+    fprintf(aFile, "%s: %s\n", aPrefix, text);
+}
+
+// Writes a log and records the text it's expected to be decoded to.
+void WriteLog(BinaryLogWriter          &aWriter,
+              std::vector<ExpectedLog> &aExpectedLogs,
+              otbrLogLevel              aLevel,
+              const char               *aLogTag,
+              const char               *aFormat,
+              ...)
+{
+    int     savedErrno = errno;
+    char    text[1024];
+    va_list args;
+
+    va_start(args, aFormat);
+    aWriter.Write(aLevel, aLogTag, aFormat, args);
+    va_end(args);
+
+    errno = savedErrno;
+    va_start(args, aFormat);
+    vsnprintf(text, sizeof(text), aFormat, args);
+    va_end(args);
+
+    aExpectedLogs.push_back({aLevel, aLogTag != nullptr ? aLogTag : "", text});
+}
+
+void WriteTestLogs(BinaryLogWriter &aWriter, std::vector<ExpectedLog> &aExpectedLogs)
+{
+    static const char kNotTerminated[] = {'a', 'b', 'c', 'd'};
+
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_INFO, "MDNS", "Service %s is resolved: %s host %s addresses %zu",
+             "_meshcop._udp", "OpenThread BR", "otbr.local.", static_cast<size_t>(3));
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_DEBUG, "MDNS", "Service %s is resolved: %s host %s addresses %zu",
+             "_srp._udp", "srp-client", "client.local.", static_cast<size_t>(1));
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_WARNING, "AGENT", "%d %i %u %o %x %X %c %%", -42, 7, 4000000000u, 8u,
+             0xbeefu, 0xcafeu, 'z');
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_INFO, "AGENT", "%hhd %hhx %hd %hu %ld %lu %lld %llu %jd %td",
+             static_cast<signed char>(-3), 0x1ff, static_cast<short>(-300), 70000, -5L, 5UL, -9223372036854775807LL,
+             18446744073709551615ULL, static_cast<intmax_t>(-1), static_cast<ptrdiff_t>(-2));
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_INFO, "AGENT", "[%-8s] [%8s] [%08.3f] [%+e] [%g] [%#x] [%Lf]", "left",
+             "right", 3.14159, -1e-10, 0.5, 255u, static_cast<long double>(2.5));
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_INFO, "AGENT", "[%*d] [%-*d] [%*d] [%.*s] [%.*f] [%.2s] [%s]", 5, 1, 5,
+             2, -5, 3, 3, kNotTerminated, 1, 2.25, "xyz", static_cast<const char *>(nullptr));
+    errno = ENOENT;
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_ERR, "AGENT", "Failed to open: %m");
+    // Positional arguments are not supported and the log is written as text.
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_NOTICE, "AGENT", "%2$s %1$s", "world", "hello");
+    WriteLog(aWriter, aExpectedLogs, OTBR_LOG_NOTICE, nullptr, "[%s] untagged log", "OT");
+}
+
+} // namespace
+
+TEST(BinaryLog, DecodesWrittenLogs)
+{
+    std::string              path = MakeLogPath();
+    std::vector<ExpectedLog> expectedLogs;
+    BinaryLogReader::Log     log;
+    FILE                    *file;
+
+    unlink(path.c_str());
+
+    // Writes two sessions to the file, the second one restarting the format dictionary.
+    for (int session = 0; session < 2; session++)
+    {
+        BinaryLogWriter writer;
+
+        ASSERT_EQ(writer.Open(path.c_str()), OTBR_ERROR_NONE);
+        WriteTestLogs(writer, expectedLogs);
+        WriteTestLogs(writer, expectedLogs);
+    }
+
+    file = fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+
+    {
+        BinaryLogReader reader(file);
+        uint64_t        lastTime = 0;
+
+        for (const ExpectedLog &expectedLog : expectedLogs)
+        {
+            ASSERT_EQ(reader.Read(log), OTBR_ERROR_NONE);
+            EXPECT_EQ(log.mLevel, expectedLog.mLevel);
+            EXPECT_EQ(log.mLogTag, expectedLog.mLogTag);
+            EXPECT_EQ(log.mText, expectedLog.mText);
+            EXPECT_GE(log.mTime, lastTime);
+            lastTime = log.mTime;
+        }
+
+        EXPECT_EQ(reader.Read(log), OTBR_ERROR_NOT_FOUND);
+    }
+
+    fclose(file);
+    unlink(path.c_str());
+}
+
+TEST(BinaryLog, RejectsInvalidLogs)
+{
+    static const char kTextLog[]       = "[INFO]-AGENT---: Running\n";
+    static const char kUnknownFormat[] = {1, 'O', 'T', 'B', 'R', 'L', 'O', 'G', 1, 4, 6, 0, 0};
+
+    BinaryLogReader::Log log;
+    FILE                *file;
+
+    file = fmemopen(const_cast<char *>(kTextLog), sizeof(kTextLog) - 1, "rb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(BinaryLogReader(file).Read(log), OTBR_ERROR_PARSE);
+    fclose(file);
+
+    // A log of an unknown format.
+    file = fmemopen(const_cast<char *>(kUnknownFormat), sizeof(kUnknownFormat), "rb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(BinaryLogReader(file).Read(log), OTBR_ERROR_PARSE);
+    fclose(file);
+}
+
+// Compares the cost of writing logs in the binary format with the cost
+// of formatting them as text, as the logs written to syslog are.
+TEST(BinaryLog, DISABLED_BenchmarkWriteLogs)
+{
+    static constexpr int kNumLogs  = 100000;
+    static const char    kFormat[] = "Service %s is resolved: %s host %s addresses %zu";
+
+    std::string       path = MakeLogPath();
+    FILE             *textFile;
+    FILE             *binaryFile;
+    Clock::time_point start;
+    double            textMs;
+    double            binaryMs;
+    long              textSize;
+    long              binarySize;
+
+    textFile = tmpfile();
+    ASSERT_NE(textFile, nullptr);
+
+    start = Clock::now();
+    for (int i = 0; i < kNumLogs; i++)
+    {
+        WriteTextLog(textFile, "[INFO]-MDNS----", kFormat, "_meshcop._udp", "OpenThread BR", "otbr.local.",
+                     static_cast<size_t>(i % 4));
+    }
+    fflush(textFile);
+    textMs   = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    textSize = ftell(textFile);
+    fclose(textFile);
+
+    unlink(path.c_str());
+    {
+        BinaryLogWriter writer;
+
+        ASSERT_EQ(writer.Open(path.c_str()), OTBR_ERROR_NONE);
+
+        start = Clock::now();
+        for (int i = 0; i < kNumLogs; i++)
+        {
+            WriteBinaryLog(writer, OTBR_LOG_INFO, "MDNS", kFormat, "_meshcop._udp", "OpenThread BR", "otbr.local.",
+                           static_cast<size_t>(i % 4));
+        }
+        writer.Flush();
+        binaryMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    binaryFile = fopen(path.c_str(), "rb");
+    ASSERT_NE(binaryFile, nullptr);
+    fseek(binaryFile, 0, SEEK_END);
+    binarySize = ftell(binaryFile);
+    fclose(binaryFile);
+    unlink(path.c_str());
+
+    EXPECT_LT(binarySize, textSize);
+
+    printf("%d logs, time in ms/size in bytes: text %.1f/%ld, binary %.1f/%ld\n", kNumLogs, textMs, textSize, binaryMs,
+           binarySize);
+}
@@ -101,3 +101,88 @@ TEST(Ip6Prefix, EqualityOperator)
 //-------------------------------------------------------------
 // Test for MacAddress
 // TODO: Add MacAddress tests
+
+//-------------------------------------------------------------
+// Test for LatencyHistogram
+
+TEST(LatencyHistogram, BucketBounds)
+{
+    using otbr::LatencyHistogram;
+
+    for (uint32_t value = 0; value < LatencyHistogram::kNumSubBuckets; value++)
+    {
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(value), value);
+    }
+
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(4), 4);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(7), 7);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(8), 8);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(9), 8);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(10), 9);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(LatencyHistogram::kMaxValue), LatencyHistogram::kNumBuckets - 1);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(UINT32_MAX), LatencyHistogram::kNumBuckets - 1);
+
+    for (uint8_t i = 0; i < LatencyHistogram::kNumBuckets; i++)
+    {
+        uint32_t lower = LatencyHistogram::GetBucketLowerBound(i);
+        uint32_t upper = LatencyHistogram::GetBucketUpperBound(i);
+
+        EXPECT_LE(lower, upper);
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(lower), i);
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(upper), i);
+
+        if (i + 1 < LatencyHistogram::kNumBuckets)
+        {
+            EXPECT_EQ(LatencyHistogram::GetBucketLowerBound(i + 1), upper + 1);
+        }
+    }
+}
+
+TEST(LatencyHistogram, RecordAndPercentile)
+{
+    otbr::LatencyHistogram histogram;
+
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(50), 0u);
+
+    for (uint32_t value = 1; value <= 100; value++)
+    {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 100u);
+    EXPECT_EQ(histogram.GetMax(), 100u);
+
+    // Percentiles are estimated with the upper bound of the bucket, which
+    // is at most 25% larger than the exact value.
+    EXPECT_GE(histogram.GetPercentile(50), 50u);
+    EXPECT_LE(histogram.GetPercentile(50), 63u);
+    EXPECT_GE(histogram.GetPercentile(90), 90u);
+    EXPECT_LE(histogram.GetPercentile(90), 100u);
+    EXPECT_EQ(histogram.GetPercentile(100), 100u);
+
+    histogram.Clear();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMax(), 0u);
+}
+
+TEST(LatencyHistogram, SetBucketCount)
+{
+    otbr::LatencyHistogram histogram;
+    otbr::LatencyHistogram copy;
+
+    histogram.Record(3);
+    histogram.Record(1000);
+    histogram.Record(1001);
+
+    for (uint8_t i = 0; i < otbr::LatencyHistogram::kNumBuckets; i++)
+    {
+        copy.SetBucketCount(i, histogram.GetBucketCount(i));
+    }
+    copy.SetMax(histogram.GetMax());
+
+    EXPECT_EQ(copy.GetCount(), 3u);
+    EXPECT_EQ(copy.GetPercentile(50), histogram.GetPercentile(50));
+    EXPECT_EQ(copy.GetPercentile(99), 1001u);
+}
@@ -26,9 +26,13 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <stdio.h>
 #include <string.h>
 
+#include <gtest/gtest.h>
+
 #include "dbus/common/dbus_message_helper.hpp"
 
 using std::array;
@@ -37,8 +41,12 @@ using std::tuple;
 using std::vector;
 
 using otbr::DBus::DBusMessageEncode;
+using otbr::DBus::DBusMessageEncodeArrayToVariant;
+using otbr::DBus::DBusMessageEncodeToVariant;
 using otbr::DBus::DBusMessageExtract;
+using otbr::DBus::DBusMessageExtractFromVariant;
 using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::FixedArrayView;
 using otbr::DBus::TupleToDBusMessage;
 
 struct TestStruct
@@ -64,12 +72,15 @@ bool operator==(const TestStruct &aLhs, const TestStruct &aRhs)
     return aLhs.tag == aRhs.tag && aLhs.val == aRhs.val && aLhs.name == aRhs.name;
 }
 
-bool operator==(const otbr::DBus::ChannelQuality &aLhs, const otbr::DBus::ChannelQuality &aRhs)
+namespace otbr {
+namespace DBus {
+
+bool operator==(const ChannelQuality &aLhs, const ChannelQuality &aRhs)
 {
     return aLhs.mChannel == aRhs.mChannel && aLhs.mOccupancy == aRhs.mOccupancy;
 }
 
-bool operator==(const otbr::DBus::ChildInfo &aLhs, const otbr::DBus::ChildInfo &aRhs)
+bool operator==(const ChildInfo &aLhs, const ChildInfo &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mTimeout == aRhs.mTimeout && aLhs.mAge == aRhs.mAge &&
            aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mChildId == aRhs.mChildId &&
@@ -80,7 +91,7 @@ bool operator==(const otbr::DBus::ChildInfo &aLhs, const otbr::DBus::ChildInfo &
            aLhs.mFullNetworkData == aRhs.mFullNetworkData && aLhs.mIsStateRestoring == aRhs.mIsStateRestoring;
 }
 
-bool operator==(const otbr::DBus::NeighborInfo &aLhs, const otbr::DBus::NeighborInfo &aRhs)
+bool operator==(const NeighborInfo &aLhs, const NeighborInfo &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mAge == aRhs.mAge && aLhs.mRloc16 == aRhs.mRloc16 &&
            aLhs.mLinkFrameCounter == aRhs.mLinkFrameCounter && aLhs.mMleFrameCounter == aRhs.mMleFrameCounter &&
@@ -91,14 +102,14 @@ bool operator==(const otbr::DBus::NeighborInfo &aLhs, const otbr::DBus::Neighbor
            aLhs.mIsChild == aRhs.mIsChild;
 }
 
-bool operator==(const otbr::DBus::LeaderData &aLhs, const otbr::DBus::LeaderData &aRhs)
+bool operator==(const LeaderData &aLhs, const LeaderData &aRhs)
 {
     return aLhs.mPartitionId == aRhs.mPartitionId && aLhs.mWeighting == aRhs.mWeighting &&
            aLhs.mDataVersion == aRhs.mDataVersion && aLhs.mStableDataVersion == aRhs.mStableDataVersion &&
            aLhs.mLeaderRouterId == aRhs.mLeaderRouterId;
 }
 
-bool operator==(const otbr::DBus::ActiveScanResult &aLhs, const otbr::DBus::ActiveScanResult &aRhs)
+bool operator==(const ActiveScanResult &aLhs, const ActiveScanResult &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mNetworkName == aRhs.mNetworkName &&
            aLhs.mExtendedPanId == aRhs.mExtendedPanId && aLhs.mSteeringData == aRhs.mSteeringData &&
@@ -107,7 +118,7 @@ bool operator==(const otbr::DBus::ActiveScanResult &aLhs, const otbr::DBus::Acti
            aLhs.mIsNative == aRhs.mIsNative;
 }
 
-bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &aRhs)
+bool operator==(const Ip6Prefix &aLhs, const Ip6Prefix &aRhs)
 {
     bool prefixDataEquality = (aLhs.mPrefix.size() == aRhs.mPrefix.size()) &&
                               (memcmp(&aLhs.mPrefix[0], &aRhs.mPrefix[0], aLhs.mPrefix.size()) == 0);
@@ -115,12 +126,15 @@ bool operator==(const otbr::DBus::Ip6Prefix &aLhs, const otbr::DBus::Ip6Prefix &
     return prefixDataEquality && aLhs.mLength == aRhs.mLength;
 }
 
-bool operator==(const otbr::DBus::ExternalRoute &aLhs, const otbr::DBus::ExternalRoute &aRhs)
+bool operator==(const ExternalRoute &aLhs, const ExternalRoute &aRhs)
 {
     return aLhs.mPrefix == aRhs.mPrefix && aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mPreference == aRhs.mPreference &&
            aLhs.mStable == aRhs.mStable && aLhs.mNextHopIsThisDevice == aRhs.mNextHopIsThisDevice;
 }
 
+} // namespace DBus
+} // namespace otbr
+
 inline otbrError DBusMessageEncode(DBusMessageIter *aIter, const TestStruct &aValue)
 {
     otbrError       error = OTBR_ERROR_DBUS;
@@ -155,8 +169,6 @@ exit:
     return error;
 }
 
-TEST_GROUP(DBusMessage){};
-
 TEST(DBusMessage, TestVectorMessage)
 {
     DBusMessage *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -328,3 +340,280 @@ TEST(DBusMessage, TestOtbrExternalRoute)
 
     dbus_message_unref(msg);
 }
+
+TEST(DBusMessage, TestOtbrMainloopLatency)
+{
+    DBusMessage                         *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<otbr::DBus::MainloopLatency>   setVals;
+    tuple<otbr::DBus::MainloopLatency>   getVals;
+    otbr::DBus::MainloopLatency         &setLatency = std::get<0>(setVals);
+    const otbr::DBus::MainloopLatency   &getLatency = std::get<0>(getVals);
+    otbr::DBus::MainloopProcessorLatency processor;
+
+    EXPECT_NE(msg, nullptr);
+
+    setLatency.mProfilingEnabled = true;
+    setLatency.mStallBudgetMs    = 100;
+    setLatency.mStallCount       = 2;
+    setLatency.mIterationLatency.Record(150000);
+    setLatency.mIterationLatency.Record(30);
+
+    processor.mName       = "otbr::Ncp::RcpHost";
+    processor.mStallCount = 2;
+    processor.mUpdateLatency.Record(5);
+    processor.mProcessLatency.Record(140000);
+    setLatency.mProcessors.push_back(processor);
+
+    EXPECT_EQ(TupleToDBusMessage(*msg, setVals), OTBR_ERROR_NONE);
+    EXPECT_EQ(DBusMessageToTuple(*msg, getVals), OTBR_ERROR_NONE);
+
+    EXPECT_TRUE(getLatency.mProfilingEnabled);
+    EXPECT_EQ(getLatency.mStallBudgetMs, 100u);
+    EXPECT_EQ(getLatency.mStallCount, 2u);
+    EXPECT_EQ(getLatency.mIterationLatency.GetCount(), 2u);
+    EXPECT_EQ(getLatency.mIterationLatency.GetMax(), 150000u);
+    ASSERT_EQ(getLatency.mProcessors.size(), 1u);
+    EXPECT_EQ(getLatency.mProcessors[0].mName, processor.mName);
+    EXPECT_EQ(getLatency.mProcessors[0].mStallCount, 2u);
+    EXPECT_EQ(getLatency.mProcessors[0].mUpdateLatency.GetMax(), 5u);
+    EXPECT_EQ(getLatency.mProcessors[0].mProcessLatency.GetCount(), 1u);
+    EXPECT_EQ(getLatency.mProcessors[0].mProcessLatency.GetPercentile(50), 140000u);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestFixedArrayView)
+{
+    DBusMessage    *msg     = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    const uint8_t   bytes[] = {1, 2, 3, 4, 5};
+    vector<uint8_t> getVals;
+    vector<uint8_t> emptyVals;
+    DBusMessageIter iter;
+
+    ASSERT_NE(msg, nullptr);
+
+    dbus_message_iter_init_append(msg, &iter);
+    EXPECT_EQ(DBusMessageEncodeToVariant(&iter, FixedArrayView<uint8_t>{bytes, sizeof(bytes)}), OTBR_ERROR_NONE);
+    EXPECT_EQ(DBusMessageEncodeToVariant(&iter, FixedArrayView<uint8_t>{bytes, 0}), OTBR_ERROR_NONE);
+
+    ASSERT_TRUE(dbus_message_iter_init(msg, &iter));
+    EXPECT_EQ(DBusMessageExtractFromVariant(&iter, getVals), OTBR_ERROR_NONE);
+    EXPECT_EQ(getVals, vector<uint8_t>(bytes, bytes + sizeof(bytes)));
+    dbus_message_iter_next(&iter);
+    EXPECT_EQ(DBusMessageExtractFromVariant(&iter, emptyVals), OTBR_ERROR_NONE);
+    EXPECT_TRUE(emptyVals.empty());
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestEncodeArrayToVariant)
+{
+    DBusMessage                      *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    vector<otbr::DBus::ExternalRoute> setVals;
+    vector<otbr::DBus::ExternalRoute> getVals;
+    vector<otbr::DBus::ExternalRoute> emptyVals;
+    size_t                            index   = 0;
+    auto                              getNext = [&](otbr::DBus::ExternalRoute &aRoute) {
+        bool found = index < setVals.size();
+
+        if (found)
+        {
+            aRoute = setVals[index++];
+        }
+
+        return found;
+    };
+    DBusMessageIter iter;
+
+    ASSERT_NE(msg, nullptr);
+
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        setVals.push_back({otbr::DBus::Ip6Prefix({{0xfd, i, 0, 0, 0, 0, 0, 0}, 64}), uint16_t(0xfc00 + i), 1, true,
+                           i % 2 == 0});
+    }
+
+    dbus_message_iter_init_append(msg, &iter);
+    EXPECT_EQ(DBusMessageEncodeArrayToVariant<otbr::DBus::ExternalRoute>(&iter, getNext), OTBR_ERROR_NONE);
+    // The table is exhausted, so the second array is empty.
+    EXPECT_EQ(DBusMessageEncodeArrayToVariant<otbr::DBus::ExternalRoute>(&iter, getNext), OTBR_ERROR_NONE);
+
+    ASSERT_TRUE(dbus_message_iter_init(msg, &iter));
+    EXPECT_EQ(DBusMessageExtractFromVariant(&iter, getVals), OTBR_ERROR_NONE);
+    dbus_message_iter_next(&iter);
+    EXPECT_EQ(DBusMessageExtractFromVariant(&iter, emptyVals), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(setVals.size(), getVals.size());
+    for (size_t i = 0; i < setVals.size(); i++)
+    {
+        EXPECT_EQ(setVals[i], getVals[i]);
+    }
+    EXPECT_TRUE(emptyVals.empty());
+
+    dbus_message_unref(msg);
+}
+
+namespace {
+
+constexpr size_t kNumTableEntries = 500;
+constexpr int    kNumIterations   = 200;
+
+// Measures the time spent encoding a table into `kNumIterations`
+// property replies, in microseconds per reply.
+double MeasureEncoding(const std::function<otbrError(DBusMessageIter *)> &aEncode)
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration total = Clock::duration::zero();
+
+    for (int i = 0; i < kNumIterations; i++)
+    {
+        DBusMessage      *msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+        DBusMessageIter   iter;
+        Clock::time_point start;
+
+        dbus_message_iter_init_append(msg, &iter);
+        start = Clock::now();
+        EXPECT_EQ(aEncode(&iter), OTBR_ERROR_NONE);
+        total += Clock::now() - start;
+        dbus_message_unref(msg);
+    }
+
+    return std::chrono::duration<double, std::micro>(total).count() / kNumIterations;
+}
+
+// Fills the synthetic table entry `aIndex` as a server handler fills
+// it from an OpenThread iterator.
+void MakeChildInfo(size_t aIndex, otbr::DBus::ChildInfo &aInfo)
+{
+    aInfo.mExtAddress         = 0x1122334455667700 + aIndex;
+    aInfo.mTimeout            = 240;
+    aInfo.mAge                = static_cast<uint32_t>(aIndex);
+    aInfo.mRloc16             = static_cast<uint16_t>(0x4400 + aIndex);
+    aInfo.mChildId            = static_cast<uint16_t>(aIndex);
+    aInfo.mNetworkDataVersion = 1;
+    aInfo.mLinkQualityIn      = 3;
+    aInfo.mAverageRssi        = -60;
+    aInfo.mLastRssi           = -62;
+    aInfo.mFrameErrorRate     = 0;
+    aInfo.mMessageErrorRate   = 0;
+    aInfo.mRxOnWhenIdle       = aIndex % 2 == 0;
+    aInfo.mFullThreadDevice   = false;
+    aInfo.mFullNetworkData    = true;
+    aInfo.mIsStateRestoring   = false;
+}
+
+void MakeOnMeshPrefix(size_t aIndex, otbr::DBus::OnMeshPrefix &aPrefix)
+{
+    const uint8_t prefix[] = {0xfd, 0x00, static_cast<uint8_t>(aIndex >> 8), static_cast<uint8_t>(aIndex), 0, 0, 0, 0};
+
+    aPrefix.mPrefix.mPrefix.assign(prefix, prefix + sizeof(prefix));
+    aPrefix.mPrefix.mLength = 64;
+    aPrefix.mRloc16         = static_cast<uint16_t>(aIndex);
+    aPrefix.mPreference     = 0;
+    aPrefix.mPreferred      = true;
+    aPrefix.mSlaac          = true;
+    aPrefix.mDhcp           = false;
+    aPrefix.mConfigure      = false;
+    aPrefix.mDefaultRoute   = true;
+    aPrefix.mOnMesh         = true;
+    aPrefix.mStable         = true;
+    aPrefix.mNdDns          = false;
+    aPrefix.mDp             = false;
+}
+
+} // namespace
+
+// Compares the encoding of synthetic 500-entry tables copied into a
+// `std::vector` first, as the server handlers used to do, with the
+// encoding streamed from the table, and the element by element
+// encoding of an array of integers with the fixed array encoding.
+TEST(DBusMessage, DISABLED_BenchmarkEncode500EntryTables)
+{
+    vector<uint32_t> counters(kNumTableEntries);
+    double           copiedUs;
+    double           streamedUs;
+
+    for (size_t i = 0; i < kNumTableEntries; i++)
+    {
+        counters[i] = static_cast<uint32_t>(i * 7);
+    }
+
+    copiedUs   = MeasureEncoding([](DBusMessageIter *aIter) {
+        vector<otbr::DBus::ChildInfo> table;
+
+        for (size_t i = 0; i < kNumTableEntries; i++)
+        {
+            otbr::DBus::ChildInfo info;
+
+            MakeChildInfo(i, info);
+            table.push_back(info);
+        }
+
+        return DBusMessageEncodeToVariant(aIter, table);
+    });
+    streamedUs = MeasureEncoding([](DBusMessageIter *aIter) {
+        size_t index = 0;
+
+        return DBusMessageEncodeArrayToVariant<otbr::DBus::ChildInfo>(aIter, [&index](otbr::DBus::ChildInfo &aInfo) {
+            bool found = index < kNumTableEntries;
+
+            if (found)
+            {
+                MakeChildInfo(index++, aInfo);
+            }
+
+            return found;
+        });
+    });
+    printf("%zu child entries: copied %.1f us, streamed %.1f us\n", kNumTableEntries, copiedUs, streamedUs);
+
+    copiedUs   = MeasureEncoding([](DBusMessageIter *aIter) {
+        vector<otbr::DBus::OnMeshPrefix> table;
+
+        for (size_t i = 0; i < kNumTableEntries; i++)
+        {
+            otbr::DBus::OnMeshPrefix prefix;
+
+            MakeOnMeshPrefix(i, prefix);
+            table.push_back(prefix);
+        }
+
+        return DBusMessageEncodeToVariant(aIter, table);
+    });
+    streamedUs = MeasureEncoding([](DBusMessageIter *aIter) {
+        size_t index = 0;
+
+        return DBusMessageEncodeArrayToVariant<otbr::DBus::OnMeshPrefix>(
+            aIter, [&index](otbr::DBus::OnMeshPrefix &aPrefix) {
+                bool found = index < kNumTableEntries;
+
+                if (found)
+                {
+                    MakeOnMeshPrefix(index++, aPrefix);
+                }
+
+                return found;
+            });
+    });
+    printf("%zu on-mesh prefixes: copied %.1f us, streamed %.1f us\n", kNumTableEntries, copiedUs, streamedUs);
+
+    copiedUs   = MeasureEncoding([&counters](DBusMessageIter *aIter) {
+        otbrError       error = OTBR_ERROR_NONE;
+        DBusMessageIter subIter;
+
+        VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_ARRAY, DBUS_TYPE_UINT32_AS_STRING, &subIter),
+                     error = OTBR_ERROR_DBUS);
+        for (uint32_t counter : counters)
+        {
+            SuccessOrExit(error = DBusMessageEncode(&subIter, counter));
+        }
+        VerifyOrExit(dbus_message_iter_close_container(aIter, &subIter), error = OTBR_ERROR_DBUS);
+
+    exit:
+        return error;
+    });
+    streamedUs = MeasureEncoding([&counters](DBusMessageIter *aIter) { return DBusMessageEncode(aIter, counters); });
+    printf("%zu uint32 values: element by element %.1f us, fixed array %.1f us\n", kNumTableEntries, copiedUs,
+           streamedUs);
+}
@@ -28,7 +28,15 @@
 
 #define OTBR_LOG_TAG "TEST"
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <signal.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -36,6 +44,78 @@
 
 #include "common/logging.hpp"
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * This class redirects the standard out to a pipe and collects what is written.
+ *
+ * The reader can be slowed down to emulate a log daemon which doesn't keep up with the logs.
+ */
+class StdoutCapture
+{
+public:
+    explicit StdoutCapture(std::chrono::microseconds aReadDelay = std::chrono::microseconds(0))
+        : mReadDelay(aReadDelay)
+    {
+        int fds[2];
+
+        fflush(stdout);
+        EXPECT_EQ(pipe(fds), 0);
+        mSavedStdout = dup(STDOUT_FILENO);
+        EXPECT_EQ(dup2(fds[1], STDOUT_FILENO), STDOUT_FILENO);
+        close(fds[1]);
+        mReadFd = fds[0];
+        mThread = std::thread([this] { Run(); });
+    }
+
+    // Restores the standard out and returns everything written to the pipe.
+    const std::string &Finish(void)
+    {
+        fflush(stdout);
+        EXPECT_EQ(dup2(mSavedStdout, STDOUT_FILENO), STDOUT_FILENO);
+        close(mSavedStdout);
+        mThread.join();
+        close(mReadFd);
+
+        return mOutput;
+    }
+
+private:
+    void Run(void)
+    {
+        char    buffer[4096];
+        ssize_t count;
+
+        while ((count = read(mReadFd, buffer, sizeof(buffer))) > 0)
+        {
+            mOutput.append(buffer, static_cast<size_t>(count));
+            std::this_thread::sleep_for(mReadDelay);
+        }
+    }
+
+    std::chrono::microseconds mReadDelay;
+    int                       mSavedStdout;
+    int                       mReadFd;
+    std::string               mOutput;
+    std::thread               mThread;
+};
+
+size_t CountOccurrences(const std::string &aText, const std::string &aPattern)
+{
+    size_t count = 0;
+
+    for (size_t pos = aText.find(aPattern); pos != std::string::npos; pos = aText.find(aPattern, pos + 1))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+} // namespace
+
 TEST(Logging, TestLoggingHigherLevel)
 {
     char ident[20];
@@ -128,3 +208,156 @@ TEST(Logging, TestLoggingDump)
     snprintf(cmd, sizeof(cmd), "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     EXPECT_EQ(system(cmd), 0);
 }
+
+TEST(Logging, AsyncLoggingKeepsOrder)
+{
+    StdoutCapture capture;
+    std::string   output;
+    size_t        pos = 0;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+    otbrLogAsyncStart();
+    for (int i = 0; i < 100; i++)
+    {
+        otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "async-%03d", i);
+    }
+    otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "async-filtered");
+    otbrLogDeinit();
+    output = capture.Finish();
+
+    for (int i = 0; i < 100; i++)
+    {
+        char line[32];
+
+        snprintf(line, sizeof(line), "-TEST----: async-%03d\n", i);
+        pos = output.find(line, pos);
+        ASSERT_NE(pos, std::string::npos) << line;
+    }
+    EXPECT_EQ(output.find("async-filtered"), std::string::npos);
+}
+
+TEST(Logging, AsyncLoggingAccountsDroppedLogs)
+{
+    static constexpr uint32_t kNumLogs = 20000;
+
+    StdoutCapture capture(std::chrono::microseconds(100));
+    std::string   output;
+    uint32_t      droppedCount = otbrLogGetDroppedCount();
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+    otbrLogAsyncStart();
+    for (uint32_t i = 0; i < kNumLogs; i++)
+    {
+        otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "overflow-%u", i);
+    }
+    otbrLogDeinit();
+    output       = capture.Finish();
+    droppedCount = otbrLogGetDroppedCount() - droppedCount;
+
+    EXPECT_GT(droppedCount, 0u);
+    EXPECT_EQ(CountOccurrences(output, ": overflow-") + droppedCount, kNumLogs);
+    EXPECT_GT(CountOccurrences(output, "logs were dropped as the log buffer was full"), 0u);
+}
+
+// The agent exits without `otbrLogDeinit()` on fatal errors, which must
+// drain the pending logs instead of aborting on the running writer thread.
+TEST(Logging, AsyncLoggingExitsCleanly)
+{
+    EXPECT_EXIT(
+        {
+            dup2(STDERR_FILENO, STDOUT_FILENO);
+            otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+            otbrLogAsyncStart();
+            otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "exiting-with-async-log");
+            exit(EXIT_SUCCESS);
+        },
+        ::testing::ExitedWithCode(EXIT_SUCCESS), "exiting-with-async-log");
+}
+
+TEST(Logging, AsyncLoggingRestoresCrashHandlers)
+{
+    struct sigaction previous;
+    struct sigaction action;
+    struct sigaction current;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_IGN;
+    sigemptyset(&action.sa_mask);
+    ASSERT_EQ(sigaction(SIGFPE, &action, &previous), 0);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+    otbrLogAsyncStart();
+    ASSERT_EQ(sigaction(SIGFPE, nullptr, &current), 0);
+    EXPECT_NE(current.sa_handler, SIG_IGN);
+
+    otbrLogDeinit();
+    ASSERT_EQ(sigaction(SIGFPE, nullptr, &current), 0);
+    EXPECT_EQ(current.sa_handler, SIG_IGN);
+
+    EXPECT_EQ(sigaction(SIGFPE, &previous, nullptr), 0);
+}
+
+// Emulates mainloop iterations which log a burst of messages while the
+// log daemon reading the standard out falls behind, and compares the
+// iteration latency of the synchronous and the asynchronous logging.
+TEST(Logging, DISABLED_BenchmarkMainloopLatency)
+{
+    static constexpr int kNumIterations    = 200;
+    static constexpr int kLogsPerIteration = 20;
+
+    double meanUs[2];
+    double maxUs[2];
+
+    for (int async = 0; async < 2; async++)
+    {
+        StdoutCapture capture(std::chrono::microseconds(200));
+        double        totalUs = 0;
+
+        // Writes every line as soon as it's logged, as syslog() does.
+        setvbuf(stdout, nullptr, _IOLBF, BUFSIZ);
+        maxUs[async] = 0;
+        otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+        if (async)
+        {
+            otbrLogAsyncStart();
+        }
+
+        for (int i = 0; i < kNumIterations; i++)
+        {
+            Clock::time_point start = Clock::now();
+            double            us;
+
+            for (int j = 0; j < kLogsPerIteration; j++)
+            {
+                otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "iteration %d log %d: %0100d", i, j, 0);
+            }
+
+            us           = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            maxUs[async] = std::max(maxUs[async], us);
+
+            totalUs += us;
+        }
+
+        otbrLogDeinit();
+        EXPECT_GT(CountOccurrences(capture.Finish(), "iteration "), 0u);
+        meanUs[async] = totalUs / kNumIterations;
+    }
+
+    printf("%d iterations of %d logs, latency in us (mean/max): sync %.1f/%.1f, async %.1f/%.1f\n", kNumIterations,
+           kLogsPerIteration, meanUs[0], maxUs[0], meanUs[1], maxUs[1]);
+}
+
+TEST(Logging, FilteredLogsDoNotEvaluateArguments)
+{
+    StdoutCapture capture;
+    int           evaluationCount = 0;
+    auto          evaluate        = [&evaluationCount](void) { return ++evaluationCount; };
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+    otbrLogDebug("lazy-debug %d", evaluate());
+    otbrLogInfo("lazy-info %d", evaluate());
+    otbrLogDeinit();
+
+    EXPECT_EQ(evaluationCount, 1);
+    EXPECT_NE(capture.Finish().find("lazy-info 1"), std::string::npos);
+}
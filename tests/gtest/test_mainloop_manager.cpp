@@ -0,0 +1,222 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop_manager.hpp"
+
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+using otbr::MainloopProcessor;
+using otbr::Milliseconds;
+
+namespace {
+
+class FastProcessor : public MainloopProcessor
+{
+public:
+    void Update(MainloopContext &aMainloop) override { aMainloop.mTimeout.tv_sec = 0; }
+    void Process(const MainloopContext &aMainloop) override { mProcessCount += aMainloop.mMaxFd + 2; }
+
+    int mProcessCount = 0;
+};
+
+class SlowProcessor : public MainloopProcessor
+{
+public:
+    void Update(MainloopContext &aMainloop) override { OTBR_UNUSED_VARIABLE(aMainloop); }
+    void Process(const MainloopContext &aMainloop) override
+    {
+        OTBR_UNUSED_VARIABLE(aMainloop);
+
+        if (mIsStalling)
+        {
+            std::this_thread::sleep_for(Milliseconds(20));
+        }
+    }
+
+    bool mIsStalling = false;
+};
+
+const MainloopManager::ProcessorStats *FindStats(const std::vector<MainloopManager::ProcessorStats> &aStats,
+                                                 const std::string                                 &aName)
+{
+    const MainloopManager::ProcessorStats *found = nullptr;
+
+    for (const MainloopManager::ProcessorStats &stats : aStats)
+    {
+        if (stats.mName.find(aName) != std::string::npos)
+        {
+            found = &stats;
+        }
+    }
+
+    return found;
+}
+
+void RunIteration(MainloopManager &aManager)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {1, 0};
+
+    aManager.Update(mainloop);
+    aManager.Process(mainloop);
+}
+
+} // namespace
+
+TEST(MainloopManager, DisabledProfilingRecordsNothing)
+{
+    MainloopManager manager;
+    FastProcessor   processor;
+    otbr::Timepoint start;
+
+    manager.AddMainloopProcessor(&processor);
+    RunIteration(manager);
+
+    start = manager.StartSection();
+    EXPECT_EQ(start, otbr::Timepoint());
+    manager.EndSection("Section", start);
+
+    EXPECT_FALSE(manager.IsProfilingEnabled());
+    EXPECT_EQ(processor.mProcessCount, 1);
+    EXPECT_TRUE(manager.GetProcessorStats().empty());
+    EXPECT_EQ(manager.GetIterationLatency().GetCount(), 0u);
+
+    manager.RemoveMainloopProcessor(&processor);
+}
+
+TEST(MainloopManager, ProfilingRecordsProcessorsAndSections)
+{
+    MainloopManager                              manager;
+    FastProcessor                                fast;
+    SlowProcessor                                slow;
+    std::vector<MainloopManager::ProcessorStats> stats;
+    const MainloopManager::ProcessorStats       *fastStats;
+    const MainloopManager::ProcessorStats       *slowStats;
+    const MainloopManager::ProcessorStats       *sectionStats;
+
+    manager.AddMainloopProcessor(&fast);
+    manager.AddMainloopProcessor(&slow);
+    manager.EnableProfiling(Milliseconds(10));
+
+    RunIteration(manager);
+    manager.EndSection("Section", manager.StartSection());
+
+    slow.mIsStalling = true;
+    RunIteration(manager);
+    slow.mIsStalling = false;
+
+    // The second iteration is finished by the next update.
+    RunIteration(manager);
+
+    stats        = manager.GetProcessorStats();
+    fastStats    = FindStats(stats, "FastProcessor");
+    slowStats    = FindStats(stats, "SlowProcessor");
+    sectionStats = FindStats(stats, "Section");
+
+    ASSERT_EQ(stats.size(), 3u);
+    ASSERT_NE(fastStats, nullptr);
+    ASSERT_NE(slowStats, nullptr);
+    ASSERT_NE(sectionStats, nullptr);
+
+    EXPECT_EQ(fastStats->mUpdateLatency.GetCount(), 3u);
+    EXPECT_EQ(fastStats->mProcessLatency.GetCount(), 3u);
+    EXPECT_EQ(sectionStats->mUpdateLatency.GetCount(), 0u);
+    EXPECT_EQ(sectionStats->mProcessLatency.GetCount(), 1u);
+    EXPECT_GE(slowStats->mProcessLatency.GetMax(), 20000u);
+
+    EXPECT_EQ(manager.GetIterationLatency().GetCount(), 2u);
+    EXPECT_EQ(manager.GetStallCount(), 1u);
+    EXPECT_EQ(slowStats->mStallCount, 1u);
+    EXPECT_EQ(fastStats->mStallCount, 0u);
+
+    // Re-enabling clears the statistics.
+    manager.EnableProfiling(Milliseconds(0));
+    EXPECT_TRUE(manager.GetProcessorStats().empty());
+    EXPECT_EQ(manager.GetStallCount(), 0u);
+
+    manager.RemoveMainloopProcessor(&slow);
+    manager.RemoveMainloopProcessor(&fast);
+}
+
+// Measures the cost of running the processors of a typical mainloop
+// with profiling disabled and enabled.
+TEST(MainloopManager, DISABLED_BenchmarkProfilingOverhead)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kNumProcessors = 12;
+    static constexpr int kIterations    = 100000;
+
+    MainloopManager                             manager;
+    std::vector<std::unique_ptr<FastProcessor>> processors;
+    Clock::time_point                           start;
+    double                                      disabledNs;
+    double                                      enabledNs;
+
+    for (int i = 0; i < kNumProcessors; i++)
+    {
+        processors.emplace_back(new FastProcessor());
+        manager.AddMainloopProcessor(processors.back().get());
+    }
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        RunIteration(manager);
+    }
+    disabledNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIterations;
+
+    manager.EnableProfiling(Milliseconds(0));
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        RunIteration(manager);
+    }
+    enabledNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIterations;
+
+    EXPECT_EQ(manager.GetIterationLatency().GetCount(), static_cast<uint32_t>(kIterations - 1));
+
+    printf("%d processors, ns per iteration: profiling disabled %.1f, enabled %.1f\n", kNumProcessors, disabledNs,
+           enabledNs);
+
+    for (std::unique_ptr<FastProcessor> &processor : processors)
+    {
+        manager.RemoveMainloopProcessor(processor.get());
+    }
+}
@@ -0,0 +1,556 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <arpa/inet.h>
+#include <functional>
+#include <string>
+#include <sys/select.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mdns/mdns_avahi.cpp"
+
+using otbr::Mdns::AvahiPoller;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherAvahi;
+
+namespace {
+
+struct ServiceResolver
+{
+    AvahiServiceResolver        *mResolver;
+    std::string                  mInstanceName;
+    AvahiServiceResolverCallback mCallback;
+    void                        *mContext;
+};
+
+struct RecordBrowser
+{
+    AvahiRecordBrowser        *mBrowser;
+    AvahiRecordBrowserCallback mCallback;
+    void                      *mContext;
+};
+
+AvahiClient                 *sClient;
+AvahiClientCallback          sClientCallback;
+void                        *sClientContext;
+AvahiServiceBrowser         *sServiceBrowser;
+AvahiServiceBrowserCallback  sServiceBrowserCallback;
+void                        *sServiceBrowserContext;
+std::vector<ServiceResolver> sServiceResolvers;
+std::vector<RecordBrowser>   sRecordBrowsers;
+uintptr_t                    sNextObject;
+
+template <typename ObjectType> ObjectType *AllocateObject(void)
+{
+    return reinterpret_cast<ObjectType *>(++sNextObject);
+}
+
+} // namespace
+
+// The Avahi client API is faked here so that the tests run without an Avahi daemon, the lookups are answered by
+// calling the saved callbacks.
+extern "C" {
+
+AvahiClient *avahi_client_new(const AvahiPoll    *aPoll,
+                              AvahiClientFlags    aFlags,
+                              AvahiClientCallback aCallback,
+                              void               *aContext,
+                              int                *aError)
+{
+    OTBR_UNUSED_VARIABLE(aPoll);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    *aError         = AVAHI_OK;
+    sClient         = AllocateObject<AvahiClient>();
+    sClientCallback = aCallback;
+    sClientContext  = aContext;
+
+    return sClient;
+}
+
+void avahi_client_free(AvahiClient *aClient)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+}
+
+const char *avahi_client_get_host_name(AvahiClient *aClient)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+
+    return "host";
+}
+
+int avahi_client_errno(AvahiClient *aClient)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+
+    return AVAHI_ERR_FAILURE;
+}
+
+const char *avahi_strerror(int aError)
+{
+    OTBR_UNUSED_VARIABLE(aError);
+
+    return "error";
+}
+
+AvahiEntryGroup *avahi_entry_group_new(AvahiClient *aClient, AvahiEntryGroupCallback aCallback, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+    OTBR_UNUSED_VARIABLE(aCallback);
+    OTBR_UNUSED_VARIABLE(aContext);
+
+    return nullptr;
+}
+
+int avahi_entry_group_free(AvahiEntryGroup *aGroup)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+
+    return AVAHI_OK;
+}
+
+int avahi_entry_group_commit(AvahiEntryGroup *aGroup)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+int avahi_entry_group_reset(AvahiEntryGroup *aGroup)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+
+    return AVAHI_OK;
+}
+
+AvahiClient *avahi_entry_group_get_client(AvahiEntryGroup *aGroup)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+
+    return nullptr;
+}
+
+int avahi_entry_group_add_service_strlst(AvahiEntryGroup  *aGroup,
+                                         AvahiIfIndex      aInterfaceIndex,
+                                         AvahiProtocol     aProtocol,
+                                         AvahiPublishFlags aFlags,
+                                         const char       *aName,
+                                         const char       *aType,
+                                         const char       *aDomain,
+                                         const char       *aHost,
+                                         uint16_t          aPort,
+                                         AvahiStringList  *aTxt)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aHost);
+    OTBR_UNUSED_VARIABLE(aPort);
+    OTBR_UNUSED_VARIABLE(aTxt);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+int avahi_entry_group_add_service_subtype(AvahiEntryGroup  *aGroup,
+                                          AvahiIfIndex      aInterfaceIndex,
+                                          AvahiProtocol     aProtocol,
+                                          AvahiPublishFlags aFlags,
+                                          const char       *aName,
+                                          const char       *aType,
+                                          const char       *aDomain,
+                                          const char       *aSubType)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aSubType);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+int avahi_entry_group_update_service_txt_strlst(AvahiEntryGroup  *aGroup,
+                                                AvahiIfIndex      aInterfaceIndex,
+                                                AvahiProtocol     aProtocol,
+                                                AvahiPublishFlags aFlags,
+                                                const char       *aName,
+                                                const char       *aType,
+                                                const char       *aDomain,
+                                                AvahiStringList  *aTxt)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aTxt);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+int avahi_entry_group_add_address(AvahiEntryGroup    *aGroup,
+                                  AvahiIfIndex        aInterfaceIndex,
+                                  AvahiProtocol       aProtocol,
+                                  AvahiPublishFlags   aFlags,
+                                  const char         *aName,
+                                  const AvahiAddress *aAddress)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aAddress);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+int avahi_entry_group_add_record(AvahiEntryGroup  *aGroup,
+                                 AvahiIfIndex      aInterfaceIndex,
+                                 AvahiProtocol     aProtocol,
+                                 AvahiPublishFlags aFlags,
+                                 const char       *aName,
+                                 uint16_t          aClass,
+                                 uint16_t          aType,
+                                 uint32_t          aTtl,
+                                 const void       *aRdata,
+                                 size_t            aSize)
+{
+    OTBR_UNUSED_VARIABLE(aGroup);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aClass);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aTtl);
+    OTBR_UNUSED_VARIABLE(aRdata);
+    OTBR_UNUSED_VARIABLE(aSize);
+
+    return AVAHI_ERR_NOT_SUPPORTED;
+}
+
+AvahiServiceBrowser *avahi_service_browser_new(AvahiClient                *aClient,
+                                               AvahiIfIndex                aInterfaceIndex,
+                                               AvahiProtocol               aProtocol,
+                                               const char                 *aType,
+                                               const char                 *aDomain,
+                                               AvahiLookupFlags            aFlags,
+                                               AvahiServiceBrowserCallback aCallback,
+                                               void                       *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    sServiceBrowser         = AllocateObject<AvahiServiceBrowser>();
+    sServiceBrowserCallback = aCallback;
+    sServiceBrowserContext  = aContext;
+
+    return sServiceBrowser;
+}
+
+int avahi_service_browser_free(AvahiServiceBrowser *aBrowser)
+{
+    OTBR_UNUSED_VARIABLE(aBrowser);
+
+    return AVAHI_OK;
+}
+
+AvahiServiceResolver *avahi_service_resolver_new(AvahiClient                 *aClient,
+                                                 AvahiIfIndex                 aInterfaceIndex,
+                                                 AvahiProtocol                aProtocol,
+                                                 const char                  *aName,
+                                                 const char                  *aType,
+                                                 const char                  *aDomain,
+                                                 AvahiProtocol                aAddressProtocol,
+                                                 AvahiLookupFlags             aFlags,
+                                                 AvahiServiceResolverCallback aCallback,
+                                                 void                        *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aAddressProtocol);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    sServiceResolvers.push_back({AllocateObject<AvahiServiceResolver>(), aName, aCallback, aContext});
+
+    return sServiceResolvers.back().mResolver;
+}
+
+int avahi_service_resolver_free(AvahiServiceResolver *aResolver)
+{
+    OTBR_UNUSED_VARIABLE(aResolver);
+
+    return AVAHI_OK;
+}
+
+AvahiRecordBrowser *avahi_record_browser_new(AvahiClient               *aClient,
+                                             AvahiIfIndex               aInterfaceIndex,
+                                             AvahiProtocol              aProtocol,
+                                             const char                *aName,
+                                             uint16_t                   aClass,
+                                             uint16_t                   aType,
+                                             AvahiLookupFlags           aFlags,
+                                             AvahiRecordBrowserCallback aCallback,
+                                             void                      *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aClient);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aClass);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    sRecordBrowsers.push_back({AllocateObject<AvahiRecordBrowser>(), aCallback, aContext});
+
+    return sRecordBrowsers.back().mBrowser;
+}
+
+int avahi_record_browser_free(AvahiRecordBrowser *aBrowser)
+{
+    OTBR_UNUSED_VARIABLE(aBrowser);
+
+    return AVAHI_OK;
+}
+
+AvahiStringList *avahi_string_list_get_next(AvahiStringList *aList)
+{
+    return aList->next;
+}
+
+size_t avahi_string_list_get_size(AvahiStringList *aList)
+{
+    return aList->size;
+}
+
+size_t avahi_string_list_serialize(AvahiStringList *aList, void *aData, size_t aSize)
+{
+    OTBR_UNUSED_VARIABLE(aList);
+    OTBR_UNUSED_VARIABLE(aData);
+    OTBR_UNUSED_VARIABLE(aSize);
+
+    return 0;
+}
+
+} // extern "C"
+
+namespace {
+
+struct FakeTimeout
+{
+    AvahiTimeout             *mTimeout   = nullptr;
+    int                       mFireCount = 0;
+    std::function<void(void)> mAction;
+
+    static void HandleTimeout(AvahiTimeout *aTimeout, void *aContext)
+    {
+        FakeTimeout &timeout = *static_cast<FakeTimeout *>(aContext);
+
+        EXPECT_EQ(aTimeout, timeout.mTimeout);
+        timeout.mFireCount++;
+
+        if (timeout.mAction)
+        {
+            timeout.mAction();
+        }
+    }
+};
+
+void RunIteration(AvahiPoller &aPoller)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aPoller.Update(mainloop);
+    aPoller.Process(mainloop);
+}
+
+} // namespace
+
+TEST(AvahiPoller, TimeoutDisarmedByEarlierCallbackIsNotFired)
+{
+    static const struct timeval kNow   = {0, 0};
+    static const struct timeval kLater = {10, 0};
+
+    AvahiPoller      poller;
+    const AvahiPoll *poll = poller.GetAvahiPoll();
+    FakeTimeout      timeouts[4];
+
+    for (FakeTimeout &timeout : timeouts)
+    {
+        timeout.mTimeout = poll->timeout_new(poll, &kNow, FakeTimeout::HandleTimeout, &timeout);
+    }
+
+    // All the timeouts are due at once, and whichever of a pair fires
+    // first disarms the other, or re-arms it to a later time.
+    timeouts[0].mAction = [&]() { poll->timeout_update(timeouts[1].mTimeout, nullptr); };
+    timeouts[1].mAction = [&]() { poll->timeout_update(timeouts[0].mTimeout, nullptr); };
+    timeouts[2].mAction = [&]() { poll->timeout_update(timeouts[3].mTimeout, &kLater); };
+    timeouts[3].mAction = [&]() { poll->timeout_update(timeouts[2].mTimeout, &kLater); };
+
+    RunIteration(poller);
+    EXPECT_EQ(timeouts[0].mFireCount + timeouts[1].mFireCount, 1);
+    EXPECT_EQ(timeouts[2].mFireCount + timeouts[3].mFireCount, 1);
+
+    // Fired timeouts are disarmed, and the re-armed one isn't due yet.
+    RunIteration(poller);
+    EXPECT_EQ(timeouts[0].mFireCount + timeouts[1].mFireCount, 1);
+    EXPECT_EQ(timeouts[2].mFireCount + timeouts[3].mFireCount, 1);
+
+    for (FakeTimeout &timeout : timeouts)
+    {
+        poll->timeout_free(timeout.mTimeout);
+    }
+}
+
+class MdnsAvahiTest : public ::testing::Test
+{
+protected:
+    static constexpr const char *kType = "_test._udp";
+
+    MdnsAvahiTest(void)
+        : mPublisher([](Publisher::State aState) { OTBR_UNUSED_VARIABLE(aState); })
+    {
+        sClient                 = nullptr;
+        sClientCallback         = nullptr;
+        sClientContext          = nullptr;
+        sServiceBrowser         = nullptr;
+        sServiceBrowserCallback = nullptr;
+        sServiceBrowserContext  = nullptr;
+        sServiceResolvers.clear();
+        sRecordBrowsers.clear();
+
+        EXPECT_EQ(mPublisher.Start(), OTBR_ERROR_NONE);
+        EXPECT_NE(sClientCallback, nullptr);
+        sClientCallback(sClient, AVAHI_CLIENT_S_RUNNING, sClientContext);
+    }
+
+    static void Browse(const char *aInstanceName)
+    {
+        ASSERT_NE(sServiceBrowserCallback, nullptr);
+        sServiceBrowserCallback(sServiceBrowser, /* aInterfaceIndex */ 1, AVAHI_PROTO_INET6, AVAHI_BROWSER_NEW,
+                                aInstanceName, kType, "local", static_cast<AvahiLookupResultFlags>(0),
+                                sServiceBrowserContext);
+    }
+
+    static void ResolveService(const ServiceResolver &aResolver)
+    {
+        aResolver.mCallback(aResolver.mResolver, /* aInterfaceIndex */ 1, AVAHI_PROTO_INET6, AVAHI_RESOLVER_FOUND,
+                            aResolver.mInstanceName.c_str(), kType, "local", "host.local", /* aAddress */ nullptr,
+                            /* aPort */ 1234, /* aTxt */ nullptr, static_cast<AvahiLookupResultFlags>(0),
+                            aResolver.mContext);
+    }
+
+    static void BrowseRecord(const RecordBrowser &aBrowser, AvahiBrowserEvent aEvent, const void *aRdata, size_t aSize)
+    {
+        aBrowser.mCallback(aBrowser.mBrowser, /* aInterfaceIndex */ 1, AVAHI_PROTO_INET6, aEvent, "host.local",
+                           AVAHI_DNS_CLASS_IN, AVAHI_DNS_TYPE_AAAA, aRdata, aSize,
+                           static_cast<AvahiLookupResultFlags>(0), aBrowser.mContext);
+    }
+
+    static std::vector<std::string> GetResolvedInstanceNames(void)
+    {
+        std::vector<std::string> names;
+
+        for (const ServiceResolver &resolver : sServiceResolvers)
+        {
+            names.push_back(resolver.mInstanceName);
+        }
+
+        return names;
+    }
+
+    PublisherAvahi mPublisher;
+};
+
+TEST_F(MdnsAvahiTest, HostWithoutRoutableAddressFinishesWhenAllAddressesAreReported)
+{
+    in6_addr linkLocal;
+    in_addr  ip4;
+
+    ASSERT_EQ(inet_pton(AF_INET6, "fe80::1", &linkLocal), 1);
+    ASSERT_EQ(inet_pton(AF_INET, "192.0.2.1", &ip4), 1);
+
+    mPublisher.SetMaxConcurrentResolutions(1);
+    mPublisher.SubscribeService(kType, "");
+
+    Browse("a");
+    Browse("b");
+    ASSERT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a"}));
+    ResolveService(sServiceResolvers[0]);
+    ASSERT_EQ(sRecordBrowsers.size(), 1u);
+
+    // The host only has a link-local and an IPv4 address, which are ignored.
+    BrowseRecord(sRecordBrowsers[0], AVAHI_BROWSER_NEW, &linkLocal, sizeof(linkLocal));
+    BrowseRecord(sRecordBrowsers[0], AVAHI_BROWSER_NEW, &ip4, sizeof(ip4));
+    BrowseRecord(sRecordBrowsers[0], AVAHI_BROWSER_CACHE_EXHAUSTED, nullptr, 0);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a"}));
+
+    // Once all the addresses are reported, the queued resolution starts.
+    BrowseRecord(sRecordBrowsers[0], AVAHI_BROWSER_ALL_FOR_NOW, nullptr, 0);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "b"}));
+}
+
+TEST_F(MdnsAvahiTest, FailedHostBrowseFinishesResolution)
+{
+    mPublisher.SetMaxConcurrentResolutions(1);
+    mPublisher.SubscribeService(kType, "");
+
+    Browse("a");
+    Browse("b");
+    ResolveService(sServiceResolvers[0]);
+    ASSERT_EQ(sRecordBrowsers.size(), 1u);
+
+    BrowseRecord(sRecordBrowsers[0], AVAHI_BROWSER_FAILURE, nullptr, 0);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "b"}));
+}
@@ -26,6 +26,13 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <arpa/inet.h>
+#include <dns_sd.h>
+#include <netinet/in.h>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "mdns/mdns_mdnssd.cpp"
@@ -65,3 +72,450 @@ TEST(MdnsSd, TestDNSErrorToString)
     EXPECT_NE(otbr::Mdns::DNSErrorToString(kDNSServiceErr_PollingMode), nullptr);
     EXPECT_NE(otbr::Mdns::DNSErrorToString(kDNSServiceErr_Timeout), nullptr);
 }
+
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherMDnsSd;
+
+namespace {
+
+struct Resolution
+{
+    std::string            mInstanceName;
+    DNSServiceResolveReply mCallback;
+    void                  *mContext;
+};
+
+DNSServiceBrowseReply      sBrowseCallback;
+void                      *sBrowseContext;
+DNSServiceErrorType        sResolveError;
+std::vector<Resolution>    sResolutions;
+DNSServiceGetAddrInfoReply sGetAddrInfoCallback;
+void                      *sGetAddrInfoContext;
+DNSServiceFlags            sGetAddrInfoFlags;
+DNSServiceRegisterReply    sRegisterCallback;
+void                      *sRegisterContext;
+int                        sRegisterCount;
+int                        sUpdateRecordCount;
+uintptr_t                  sNextServiceRef;
+
+DNSServiceRef AllocateServiceRef(void)
+{
+    return reinterpret_cast<DNSServiceRef>(++sNextServiceRef);
+}
+
+} // namespace
+
+// The dns_sd API is faked here so that the tests run without an mDNSResponder daemon, the resolutions are answered by
+// calling the saved callbacks.
+extern "C" {
+
+int DNSServiceRefSockFD(DNSServiceRef aServiceRef)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+
+    return -1;
+}
+
+DNSServiceErrorType DNSServiceProcessResult(DNSServiceRef aServiceRef)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+
+    return kDNSServiceErr_NoError;
+}
+
+void DNSServiceRefDeallocate(DNSServiceRef aServiceRef)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+}
+
+DNSServiceErrorType DNSServiceCreateConnection(DNSServiceRef *aServiceRef)
+{
+    *aServiceRef = AllocateServiceRef();
+
+    return kDNSServiceErr_NoError;
+}
+
+DNSServiceErrorType DNSServiceRegister(DNSServiceRef          *aServiceRef,
+                                       DNSServiceFlags         aFlags,
+                                       uint32_t                aInterfaceIndex,
+                                       const char             *aName,
+                                       const char             *aType,
+                                       const char             *aDomain,
+                                       const char             *aHost,
+                                       uint16_t                aPort,
+                                       uint16_t                aTxtLen,
+                                       const void             *aTxtRecord,
+                                       DNSServiceRegisterReply aCallback,
+                                       void                   *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aName);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+    OTBR_UNUSED_VARIABLE(aHost);
+    OTBR_UNUSED_VARIABLE(aPort);
+    OTBR_UNUSED_VARIABLE(aTxtLen);
+    OTBR_UNUSED_VARIABLE(aTxtRecord);
+
+    *aServiceRef      = AllocateServiceRef();
+    sRegisterCallback = aCallback;
+    sRegisterContext  = aContext;
+    sRegisterCount++;
+
+    return kDNSServiceErr_NoError;
+}
+
+DNSServiceErrorType DNSServiceAddRecord(DNSServiceRef   aServiceRef,
+                                        DNSRecordRef   *aRecordRef,
+                                        DNSServiceFlags aFlags,
+                                        uint16_t        aRrType,
+                                        uint16_t        aRdLen,
+                                        const void     *aRData,
+                                        uint32_t        aTtl)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aRecordRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aRrType);
+    OTBR_UNUSED_VARIABLE(aRdLen);
+    OTBR_UNUSED_VARIABLE(aRData);
+    OTBR_UNUSED_VARIABLE(aTtl);
+
+    return kDNSServiceErr_Unsupported;
+}
+
+DNSServiceErrorType DNSServiceUpdateRecord(DNSServiceRef   aServiceRef,
+                                           DNSRecordRef    aRecordRef,
+                                           DNSServiceFlags aFlags,
+                                           uint16_t        aRdLen,
+                                           const void     *aRData,
+                                           uint32_t        aTtl)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aRecordRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aRdLen);
+    OTBR_UNUSED_VARIABLE(aRData);
+    OTBR_UNUSED_VARIABLE(aTtl);
+
+    sUpdateRecordCount++;
+
+    return kDNSServiceErr_NoError;
+}
+
+DNSServiceErrorType DNSServiceRemoveRecord(DNSServiceRef aServiceRef, DNSRecordRef aRecordRef, DNSServiceFlags aFlags)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aRecordRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+
+    return kDNSServiceErr_Unsupported;
+}
+
+DNSServiceErrorType DNSServiceRegisterRecord(DNSServiceRef                 aServiceRef,
+                                             DNSRecordRef                 *aRecordRef,
+                                             DNSServiceFlags               aFlags,
+                                             uint32_t                      aInterfaceIndex,
+                                             const char                   *aFullName,
+                                             uint16_t                      aRrType,
+                                             uint16_t                      aRrClass,
+                                             uint16_t                      aRdLen,
+                                             const void                   *aRData,
+                                             uint32_t                      aTtl,
+                                             DNSServiceRegisterRecordReply aCallback,
+                                             void                         *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aServiceRef);
+    OTBR_UNUSED_VARIABLE(aRecordRef);
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aFullName);
+    OTBR_UNUSED_VARIABLE(aRrType);
+    OTBR_UNUSED_VARIABLE(aRrClass);
+    OTBR_UNUSED_VARIABLE(aRdLen);
+    OTBR_UNUSED_VARIABLE(aRData);
+    OTBR_UNUSED_VARIABLE(aTtl);
+    OTBR_UNUSED_VARIABLE(aCallback);
+    OTBR_UNUSED_VARIABLE(aContext);
+
+    return kDNSServiceErr_Unsupported;
+}
+
+DNSServiceErrorType DNSServiceBrowse(DNSServiceRef        *aServiceRef,
+                                     DNSServiceFlags       aFlags,
+                                     uint32_t              aInterfaceIndex,
+                                     const char           *aType,
+                                     const char           *aDomain,
+                                     DNSServiceBrowseReply aCallback,
+                                     void                 *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    *aServiceRef    = AllocateServiceRef();
+    sBrowseCallback = aCallback;
+    sBrowseContext  = aContext;
+
+    return kDNSServiceErr_NoError;
+}
+
+DNSServiceErrorType DNSServiceResolve(DNSServiceRef         *aServiceRef,
+                                      DNSServiceFlags        aFlags,
+                                      uint32_t               aInterfaceIndex,
+                                      const char            *aName,
+                                      const char            *aType,
+                                      const char            *aDomain,
+                                      DNSServiceResolveReply aCallback,
+                                      void                  *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aFlags);
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aDomain);
+
+    sResolutions.push_back({aName, aCallback, aContext});
+
+    if (sResolveError == kDNSServiceErr_NoError)
+    {
+        *aServiceRef = AllocateServiceRef();
+    }
+
+    return sResolveError;
+}
+
+DNSServiceErrorType DNSServiceGetAddrInfo(DNSServiceRef             *aServiceRef,
+                                          DNSServiceFlags            aFlags,
+                                          uint32_t                   aInterfaceIndex,
+                                          DNSServiceProtocol         aProtocol,
+                                          const char                *aHostName,
+                                          DNSServiceGetAddrInfoReply aCallback,
+                                          void                      *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aInterfaceIndex);
+    OTBR_UNUSED_VARIABLE(aProtocol);
+    OTBR_UNUSED_VARIABLE(aHostName);
+
+    *aServiceRef         = AllocateServiceRef();
+    sGetAddrInfoCallback = aCallback;
+    sGetAddrInfoContext  = aContext;
+    sGetAddrInfoFlags    = aFlags;
+
+    return kDNSServiceErr_NoError;
+}
+
+} // extern "C"
+
+class MdnsSdTest : public ::testing::Test
+{
+protected:
+    static constexpr const char *kType = "_test._udp";
+
+    MdnsSdTest(void)
+        : mPublisher([](Publisher::State aState) { OTBR_UNUSED_VARIABLE(aState); })
+    {
+        sBrowseCallback = nullptr;
+        sBrowseContext  = nullptr;
+        sResolveError   = kDNSServiceErr_NoError;
+        sResolutions.clear();
+        sGetAddrInfoCallback = nullptr;
+        sGetAddrInfoContext  = nullptr;
+        sGetAddrInfoFlags    = 0;
+        sRegisterCallback    = nullptr;
+        sRegisterContext     = nullptr;
+        sRegisterCount       = 0;
+        sUpdateRecordCount   = 0;
+
+        EXPECT_EQ(mPublisher.Start(), OTBR_ERROR_NONE);
+    }
+
+    void Browse(const char *aInstanceName, bool aIsAdd)
+    {
+        ASSERT_NE(sBrowseCallback, nullptr);
+        sBrowseCallback(nullptr, aIsAdd ? kDNSServiceFlagsAdd : 0, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError,
+                        aInstanceName, "_test._udp.", "local.", sBrowseContext);
+    }
+
+    static void CompleteResolution(const Resolution &aResolution)
+    {
+        std::string         fullName = aResolution.mInstanceName + "._test._udp.local.";
+        struct sockaddr_in6 address  = {};
+
+        aResolution.mCallback(nullptr, 0, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError, fullName.c_str(),
+                              "host.local.", htons(1234), 0, nullptr, aResolution.mContext);
+
+        address.sin6_family = AF_INET6;
+        ASSERT_EQ(inet_pton(AF_INET6, "2001:db8::1", &address.sin6_addr), 1);
+        ASSERT_NE(sGetAddrInfoCallback, nullptr);
+        sGetAddrInfoCallback(nullptr, kDNSServiceFlagsAdd, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError,
+                             "host.local.", reinterpret_cast<const struct sockaddr *>(&address), /* aTtl */ 120,
+                             sGetAddrInfoContext);
+    }
+
+    void PublishService(const Publisher::SubTypeList &aSubTypeList, const Publisher::TxtData &aTxtData)
+    {
+        mError = OTBR_ERROR_ERRNO;
+        mPublisher.PublishService("", "service", kType, aSubTypeList, 1234, aTxtData,
+                                  [this](otbrError aError) { mError = aError; });
+    }
+
+    static void CompleteRegistration(void)
+    {
+        ASSERT_NE(sRegisterCallback, nullptr);
+        sRegisterCallback(nullptr, kDNSServiceFlagsAdd, kDNSServiceErr_NoError, "service", "_test._udp.", "local.",
+                          sRegisterContext);
+    }
+
+    static std::vector<std::string> GetResolvedInstanceNames(void)
+    {
+        std::vector<std::string> names;
+
+        for (const Resolution &resolution : sResolutions)
+        {
+            names.push_back(resolution.mInstanceName);
+        }
+
+        return names;
+    }
+
+    // Declared before `mPublisher` which reports the pending registrations as aborted when destroyed.
+    otbrError       mError = OTBR_ERROR_NONE;
+    PublisherMDnsSd mPublisher;
+};
+
+TEST_F(MdnsSdTest, RemovedInstanceIsNotResolved)
+{
+    mPublisher.SetMaxConcurrentResolutions(1);
+    mPublisher.SubscribeService(kType, "");
+
+    Browse("a", /* aIsAdd */ true);
+    Browse("b", /* aIsAdd */ true);
+    Browse("c", /* aIsAdd */ true);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a"}));
+    EXPECT_EQ(mPublisher.GetServiceResolutionCount(), 3u);
+
+    // The queued resolution of the removed instance is dropped.
+    Browse("b", /* aIsAdd */ false);
+    EXPECT_EQ(mPublisher.GetServiceResolutionCount(), 2u);
+
+    CompleteResolution(sResolutions[0]);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "c"}));
+}
+
+TEST_F(MdnsSdTest, FailedResolveIsRemoved)
+{
+    mPublisher.SetMaxConcurrentResolutions(1);
+    mPublisher.SubscribeService(kType, "");
+
+    sResolveError = kDNSServiceErr_NoMemory;
+    Browse("a", /* aIsAdd */ true);
+    Browse("b", /* aIsAdd */ true);
+
+    // Each failure frees the slot of the queue, and the resolution is not kept.
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(mPublisher.GetServiceResolutionCount(), 0u);
+
+    sResolveError = kDNSServiceErr_NoError;
+    Browse("c", /* aIsAdd */ true);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "b", "c"}));
+    EXPECT_EQ(mPublisher.GetServiceResolutionCount(), 1u);
+}
+
+TEST_F(MdnsSdTest, HostWithoutRoutableAddressFinishesOnTimeout)
+{
+    std::string         fullName  = "a._test._udp.local.";
+    struct sockaddr_in6 linkLocal = {};
+    struct sockaddr_in  ip4       = {};
+
+    mPublisher.SetMaxConcurrentResolutions(1);
+    mPublisher.SubscribeService(kType, "");
+
+    Browse("a", /* aIsAdd */ true);
+    Browse("b", /* aIsAdd */ true);
+    ASSERT_EQ(sResolutions.size(), 1u);
+    sResolutions[0].mCallback(nullptr, 0, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError, fullName.c_str(),
+                              "host.local.", htons(1234), 0, nullptr, sResolutions[0].mContext);
+    ASSERT_NE(sGetAddrInfoCallback, nullptr);
+    EXPECT_NE(sGetAddrInfoFlags & kDNSServiceFlagsTimeout, 0u);
+
+    // The host only has a link-local and an IPv4 address, which are ignored.
+    linkLocal.sin6_family = AF_INET6;
+    ASSERT_EQ(inet_pton(AF_INET6, "fe80::1", &linkLocal.sin6_addr), 1);
+    sGetAddrInfoCallback(nullptr, kDNSServiceFlagsAdd, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError, "host.local.",
+                         reinterpret_cast<const struct sockaddr *>(&linkLocal), /* aTtl */ 120, sGetAddrInfoContext);
+    ip4.sin_family = AF_INET;
+    ASSERT_EQ(inet_pton(AF_INET, "192.0.2.1", &ip4.sin_addr), 1);
+    sGetAddrInfoCallback(nullptr, kDNSServiceFlagsAdd, /* aInterfaceIndex */ 1, kDNSServiceErr_NoError, "host.local.",
+                         reinterpret_cast<const struct sockaddr *>(&ip4), /* aTtl */ 120, sGetAddrInfoContext);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a"}));
+
+    // The timeout of the query frees the slot for the queued resolution.
+    sGetAddrInfoCallback(nullptr, 0, /* aInterfaceIndex */ 1, kDNSServiceErr_Timeout, "host.local.", nullptr,
+                         /* aTtl */ 0, sGetAddrInfoContext);
+    EXPECT_EQ(GetResolvedInstanceNames(), std::vector<std::string>({"a", "b"}));
+}
+
+TEST_F(MdnsSdTest, UnchangedServiceIsNotRegisteredAgain)
+{
+    PublishService({"_b", "_a"}, {1, 2});
+    EXPECT_EQ(sRegisterCount, 1);
+    EXPECT_EQ(mError, OTBR_ERROR_ERRNO);
+    CompleteRegistration();
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+
+    // The order of the sub-types doesn't matter.
+    PublishService({"_a", "_b"}, {1, 2});
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(sRegisterCount, 1);
+
+    // Sub-types with the same size but different content are a change.
+    PublishService({"_a", "_a"}, {1, 2});
+    EXPECT_EQ(mError, OTBR_ERROR_ERRNO);
+    EXPECT_EQ(sRegisterCount, 2);
+    EXPECT_EQ(sUpdateRecordCount, 0);
+}
+
+TEST_F(MdnsSdTest, TxtOnlyChangeIsUpdatedInPlace)
+{
+    PublishService({"_a"}, {1, 2});
+    CompleteRegistration();
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+
+    PublishService({"_a"}, {3, 4});
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(sRegisterCount, 1);
+    EXPECT_EQ(sUpdateRecordCount, 1);
+
+    // The updated TXT data is now the registered one.
+    PublishService({"_a"}, {3, 4});
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(sRegisterCount, 1);
+    EXPECT_EQ(sUpdateRecordCount, 1);
+
+    // A port or sub-type change still registers the service again.
+    PublishService({"_b"}, {3, 4});
+    EXPECT_EQ(sRegisterCount, 2);
+    EXPECT_EQ(sUpdateRecordCount, 1);
+}
+
+TEST_F(MdnsSdTest, AbortedRegistrationIsNotCountedInLatency)
+{
+    const otbr::MdnsTelemetryInfo &info = mPublisher.GetMdnsTelemetryInfo();
+
+    PublishService({"_a"}, {1, 2});
+    std::this_thread::sleep_for(otbr::Milliseconds(20));
+
+    // The pending registration is replaced, which aborts it.
+    PublishService({"_b"}, {1, 2});
+    EXPECT_EQ(info.mServiceRegistrations.mAborted, 1u);
+    EXPECT_EQ(info.mServiceRegistrationEmaLatency, 0u);
+    EXPECT_EQ(info.mLatencyHistograms.mServiceRegistration.GetCount(), 0u);
+
+    CompleteRegistration();
+    EXPECT_EQ(mError, OTBR_ERROR_NONE);
+    EXPECT_EQ(info.mServiceRegistrations.mSuccess, 1u);
+    EXPECT_LT(info.mServiceRegistrationEmaLatency, 20u);
+    EXPECT_EQ(info.mLatencyHistograms.mServiceRegistration.GetCount(), 1u);
+}
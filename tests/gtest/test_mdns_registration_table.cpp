@@ -0,0 +1,225 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mdns/registration_table.hpp"
+
+using otbr::Mdns::NameKey;
+using otbr::Mdns::RegistrationTable;
+
+namespace {
+
+struct FakeService
+{
+    FakeService(std::string aName, std::string aType)
+        : mName(std::move(aName))
+        , mType(std::move(aType))
+    {
+    }
+
+    NameKey GetNameKey(void) const { return NameKey(mName, mType); }
+
+    std::string mName;
+    std::string mType;
+};
+
+using FakeServicePtr = std::unique_ptr<FakeService>;
+
+std::string MakeInstanceName(size_t aIndex)
+{
+    return "srp-client-" + std::to_string(aIndex);
+}
+
+} // namespace
+
+TEST(NameKey, EqualityDoesNotDependOnSplit)
+{
+    std::string name     = "instance";
+    std::string type     = "_srv._udp";
+    std::string fullName = "instance._srv._udp";
+    std::string other    = "instance._srv._tcp";
+
+    EXPECT_TRUE(NameKey(name, type) == NameKey(fullName));
+    EXPECT_EQ(NameKey(name, type).GetHash(), NameKey(fullName).GetHash());
+    EXPECT_EQ(NameKey(name, type).GetLength(), fullName.size());
+    EXPECT_FALSE(NameKey(name, type) == NameKey(other));
+    EXPECT_FALSE(NameKey(name) == NameKey(fullName));
+}
+
+TEST(RegistrationTable, AddFindRemove)
+{
+    RegistrationTable<FakeService> table;
+    std::string                    type = "_srv._udp";
+    std::string                    missing("missing");
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        table.Add(FakeServicePtr(new FakeService(MakeInstanceName(i), type)));
+    }
+    EXPECT_EQ(table.size(), 1000u);
+
+    // Adding a duplicate keeps the existing registration.
+    {
+        FakeService *existing = table.Find(NameKey(MakeInstanceName(7), type));
+
+        table.Add(FakeServicePtr(new FakeService(MakeInstanceName(7), type)));
+        EXPECT_EQ(table.size(), 1000u);
+        EXPECT_EQ(table.Find(NameKey(MakeInstanceName(7), type)), existing);
+    }
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        std::string  name    = MakeInstanceName(i);
+        FakeService *service = table.Find(NameKey(name, type));
+
+        ASSERT_NE(service, nullptr);
+        EXPECT_EQ(service->mName, name);
+    }
+    EXPECT_EQ(table.Find(NameKey(missing, type)), nullptr);
+
+    // Remove every other registration and verify the rest are still reachable.
+    for (size_t i = 0; i < 1000; i += 2)
+    {
+        std::string name = MakeInstanceName(i);
+
+        EXPECT_NE(table.Remove(NameKey(name, type)), nullptr);
+        EXPECT_EQ(table.Remove(NameKey(name, type)), nullptr);
+    }
+    EXPECT_EQ(table.size(), 500u);
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        std::string name = MakeInstanceName(i);
+
+        EXPECT_EQ(table.Find(NameKey(name, type)) != nullptr, i % 2 == 1);
+    }
+
+    {
+        size_t count = 0;
+
+        for (const FakeServicePtr &service : table)
+        {
+            EXPECT_NE(service, nullptr);
+            count++;
+        }
+        EXPECT_EQ(count, 500u);
+    }
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.Find(NameKey(MakeInstanceName(1), type)), nullptr);
+}
+
+// Simulates an SRP server with 10k services: registers every service
+// (with the duplicate check), looks them up as lease refreshes do and
+// removes them, comparing the table with the `std::map` keyed by full
+// names which was used before.
+TEST(RegistrationTable, DISABLED_Benchmark10kServices)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kNumServices = 10000;
+
+    RegistrationTable<FakeService>        table;
+    std::map<std::string, FakeServicePtr> map;
+    std::vector<FakeServicePtr>           tableServices;
+    std::vector<FakeServicePtr>           mapServices;
+    std::string                           type = "_matter._tcp";
+    Clock::time_point                     start;
+    double                                tableMs[3];
+    double                                mapMs[3];
+
+    for (size_t i = 0; i < kNumServices; i++)
+    {
+        tableServices.emplace_back(new FakeService(MakeInstanceName(i), type));
+        mapServices.emplace_back(new FakeService(MakeInstanceName(i), type));
+    }
+
+    start = Clock::now();
+    for (FakeServicePtr &service : tableServices)
+    {
+        if (table.Find(service->GetNameKey()) == nullptr)
+        {
+            table.Add(std::move(service));
+        }
+    }
+    tableMs[0] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (const FakeServicePtr &service : mapServices)
+    {
+        ASSERT_NE(table.Find(NameKey(service->mName, service->mType)), nullptr);
+    }
+    tableMs[1] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (const FakeServicePtr &service : mapServices)
+    {
+        ASSERT_NE(table.Remove(NameKey(service->mName, service->mType)), nullptr);
+    }
+    tableMs[2] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    EXPECT_TRUE(table.empty());
+
+    start = Clock::now();
+    for (FakeServicePtr &service : mapServices)
+    {
+        std::string fullName = service->mName + "." + service->mType + ".local";
+
+        if (map.find(fullName) == map.end())
+        {
+            map.emplace(fullName, std::move(service));
+        }
+    }
+    mapMs[0] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (size_t i = 0; i < kNumServices; i++)
+    {
+        ASSERT_NE(map.find(MakeInstanceName(i) + "." + type + ".local"), map.end());
+    }
+    mapMs[1] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (size_t i = 0; i < kNumServices; i++)
+    {
+        map.erase(map.find(MakeInstanceName(i) + "." + type + ".local"));
+    }
+    mapMs[2] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    EXPECT_TRUE(map.empty());
+
+    printf("%zu services, add/find/remove in ms: RegistrationTable %.2f/%.2f/%.2f, std::map %.2f/%.2f/%.2f\n",
+           kNumServices, tableMs[0], tableMs[1], tableMs[2], mapMs[0], mapMs[1], mapMs[2]);
+}
@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <map>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "mdns/resolution_queue.hpp"
+
+using otbr::Mdns::ResolutionQueue;
+
+TEST(ResolutionQueue, LimitsInFlightResolutions)
+{
+    ResolutionQueue          queue(2);
+    std::vector<std::string> started;
+
+    for (const char *name : {"a", "b", "c", "d"})
+    {
+        queue.Add(name, [&started, name]() { started.push_back(name); });
+    }
+
+    EXPECT_EQ(started, std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(queue.GetInFlightCount(), 2);
+    EXPECT_EQ(queue.GetPendingCount(), 2u);
+
+    queue.Cancel("c");
+    EXPECT_EQ(queue.GetPendingCount(), 1u);
+
+    queue.Finish();
+    EXPECT_EQ(started, std::vector<std::string>({"a", "b", "d"}));
+    EXPECT_EQ(queue.GetInFlightCount(), 2);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+
+    queue.Finish();
+    queue.Finish();
+    EXPECT_EQ(queue.GetInFlightCount(), 0);
+}
+
+TEST(ResolutionQueue, StartFailureStartsNextResolution)
+{
+    ResolutionQueue queue(1);
+    int             startCount = 0;
+
+    // Every start fails right away, which must not stall the queue.
+    for (int i = 0; i < 1000; i++)
+    {
+        queue.Add("instance", [&queue, &startCount]() {
+            startCount++;
+            queue.Finish();
+        });
+    }
+
+    EXPECT_EQ(startCount, 1000);
+    EXPECT_EQ(queue.GetInFlightCount(), 0);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+}
+
+TEST(ResolutionQueue, ClearDropsQueuedResolutions)
+{
+    ResolutionQueue queue(1);
+    int             startCount = 0;
+
+    queue.Add("a", [&startCount]() { startCount++; });
+    queue.Add("b", [&startCount]() { startCount++; });
+    queue.Clear();
+    queue.Finish();
+
+    EXPECT_EQ(startCount, 1);
+    EXPECT_EQ(queue.GetInFlightCount(), 0);
+}
+
+// Simulates a Discovery Proxy browse query for a service type with many
+// instances which are all discovered at once and each take the same time
+// to resolve, and reports when the first and the last instances are
+// answered. The in-flight limit of 1 corresponds to resolving the
+// instances one after another.
+TEST(ResolutionQueue, DISABLED_BenchmarkAnswerLatency)
+{
+    static constexpr uint32_t kResolveTimeMs = 100;
+    static constexpr size_t   kNumInstances  = 64;
+
+    for (uint16_t maxInFlight : {1, 4, 16, 0})
+    {
+        ResolutionQueue                 queue(maxInFlight);
+        std::multimap<uint32_t, size_t> completions; // Completion time => instance index
+        uint32_t                        now         = 0;
+        uint32_t                        firstAnswer = 0;
+        uint32_t                        lastAnswer  = 0;
+        size_t                          numAnswers  = 0;
+
+        for (size_t i = 0; i < kNumInstances; i++)
+        {
+            queue.Add("instance" + std::to_string(i),
+                      [&completions, &now, i]() { completions.emplace(now + kResolveTimeMs, i); });
+        }
+
+        while (!completions.empty())
+        {
+            now = completions.begin()->first;
+            completions.erase(completions.begin());
+
+            if (numAnswers++ == 0)
+            {
+                firstAnswer = now;
+            }
+            lastAnswer = now;
+
+            queue.Finish();
+        }
+
+        EXPECT_EQ(numAnswers, kNumInstances);
+        EXPECT_EQ(firstAnswer, kResolveTimeMs);
+
+        if (maxInFlight != 0)
+        {
+            EXPECT_EQ(lastAnswer, kResolveTimeMs * ((kNumInstances + maxInFlight - 1) / maxInFlight));
+        }
+        else
+        {
+            EXPECT_EQ(lastAnswer, kResolveTimeMs);
+        }
+
+        printf("%zu instances, in-flight limit %3u: first answer after %4u ms, all answers after %4u ms\n",
+               kNumInstances, maxInFlight, firstAnswer, lastAnswer);
+    }
+}
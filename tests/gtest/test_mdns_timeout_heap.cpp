@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/time.hpp"
+#include "mdns/timeout_heap.hpp"
+
+using otbr::Clock;
+using otbr::Timepoint;
+using otbr::Mdns::TimeoutHeap;
+
+namespace {
+
+struct FakeTimeout
+{
+    Timepoint mTimeout;
+    size_t    mHeapIndex = TimeoutHeap<FakeTimeout>::kNotInHeap;
+    bool      mArmed     = false;
+};
+
+Timepoint FindEarliest(const std::vector<FakeTimeout> &aTimeouts)
+{
+    Timepoint earliest = Timepoint::max();
+
+    for (const FakeTimeout &timeout : aTimeouts)
+    {
+        if (timeout.mArmed && timeout.mTimeout < earliest)
+        {
+            earliest = timeout.mTimeout;
+        }
+    }
+
+    return earliest;
+}
+
+} // namespace
+
+TEST(TimeoutHeap, MatchesLinearScan)
+{
+    std::vector<FakeTimeout>           timeouts(200);
+    TimeoutHeap<FakeTimeout>           heap;
+    std::mt19937                       random(1);
+    std::uniform_int_distribution<int> delay(0, 10000);
+    Timepoint                          base = Clock::now();
+
+    for (int i = 0; i < 20000; i++)
+    {
+        FakeTimeout &timeout = timeouts[random() % timeouts.size()];
+
+        if (random() % 4 == 0)
+        {
+            heap.Remove(timeout);
+            timeout.mArmed = false;
+        }
+        else
+        {
+            timeout.mTimeout = base + std::chrono::milliseconds(delay(random));
+            timeout.mArmed   = true;
+            heap.Update(timeout);
+        }
+
+        ASSERT_EQ(heap.IsEmpty(), FindEarliest(timeouts) == Timepoint::max());
+        if (!heap.IsEmpty())
+        {
+            ASSERT_EQ(heap.GetTop()->mTimeout, FindEarliest(timeouts));
+        }
+    }
+
+    // Draining the heap yields the timeouts in order.
+    {
+        Timepoint last = Timepoint::min();
+
+        while (!heap.IsEmpty())
+        {
+            FakeTimeout *top = heap.GetTop();
+
+            EXPECT_GE(top->mTimeout, last);
+            last = top->mTimeout;
+            heap.Remove(*top);
+            EXPECT_FALSE(TimeoutHeap<FakeTimeout>::Contains(*top));
+        }
+    }
+}
+
+// Simulates the per-iteration mainloop work of the Avahi poller while
+// every published service has a pending Avahi timeout: computing the
+// mainloop timeout, then firing the earliest timeout and re-arming it.
+// The linear scan is what the poller did before it kept a heap.
+TEST(TimeoutHeap, DISABLED_BenchmarkMainloopOverhead)
+{
+    using Duration = std::chrono::duration<double, std::micro>;
+
+    static constexpr size_t kIterations = 2000;
+
+    for (size_t numServices : {10, 100, 1000, 10000})
+    {
+        std::vector<FakeTimeout> scanTimeouts(numServices);
+        std::vector<FakeTimeout> heapTimeouts(numServices);
+        TimeoutHeap<FakeTimeout> heap;
+        Timepoint                base = Clock::now();
+        Clock::time_point        start;
+        double                   scanUs;
+        double                   heapUs;
+
+        for (size_t i = 0; i < numServices; i++)
+        {
+            scanTimeouts[i].mTimeout = base + std::chrono::milliseconds(i);
+            scanTimeouts[i].mArmed   = true;
+            heapTimeouts[i].mTimeout = base + std::chrono::milliseconds(i);
+            heap.Update(heapTimeouts[i]);
+        }
+
+        start = Clock::now();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            Timepoint earliest = FindEarliest(scanTimeouts);
+
+            for (FakeTimeout &timeout : scanTimeouts)
+            {
+                if (timeout.mTimeout == earliest)
+                {
+                    timeout.mTimeout += std::chrono::milliseconds(numServices);
+                    break;
+                }
+            }
+        }
+        scanUs = Duration(Clock::now() - start).count() / kIterations;
+
+        start = Clock::now();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            FakeTimeout *top = heap.GetTop();
+
+            heap.Remove(*top);
+            top->mTimeout += std::chrono::milliseconds(numServices);
+            heap.Update(*top);
+        }
+        heapUs = Duration(Clock::now() - start).count() / kIterations;
+
+        EXPECT_EQ(heap.GetSize(), numServices);
+        EXPECT_EQ(heap.GetTop()->mTimeout, FindEarliest(scanTimeouts));
+
+        printf("%5zu services: %.3f us per loop with linear scan, %.3f us per loop with heap\n", numServices, scanUs,
+               heapUs);
+    }
+}
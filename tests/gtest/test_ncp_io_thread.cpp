@@ -0,0 +1,401 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "lib/spinel/spinel.h"
+#include "ncp/ncp_io_thread.hpp"
+
+using otbr::MainloopContext;
+using otbr::Ncp::NcpIoThread;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr spinel_iid_t kIid = 0;
+
+// A spinel transport over a socket pair, the other end plays the NCP.
+class FakeTransport : public NcpIoThread::Transport
+{
+public:
+    FakeTransport(void)
+    {
+        int fds[2];
+
+        EXPECT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0, fds), 0);
+        mHostFd = fds[0];
+        mNcpFd  = fds[1];
+    }
+
+    ~FakeTransport(void) override
+    {
+        close(mHostFd);
+        close(mNcpFd);
+    }
+
+    void SetReceiveHandler(NcpIoThread::FrameHandler aHandler) override { mReceiveHandler = std::move(aHandler); }
+
+    void UpdateFdSet(MainloopContext &aContext) override { aContext.AddFdToReadSet(mHostFd); }
+
+    void Process(const MainloopContext &aContext) override
+    {
+        uint8_t frame[SPINEL_FRAME_MAX_SIZE];
+        ssize_t length;
+
+        if (!FD_ISSET(mHostFd, &aContext.mReadFdSet))
+        {
+            return;
+        }
+
+        while ((length = recv(mHostFd, frame, sizeof(frame), 0)) > 0)
+        {
+            mReceiveHandler(frame, static_cast<uint16_t>(length));
+        }
+    }
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength) override
+    {
+        return send(mHostFd, aFrame, aLength, 0) == aLength ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    }
+
+    int GetHostFd(void) const { return mHostFd; }
+    int GetNcpFd(void) const { return mNcpFd; }
+
+private:
+    int                       mHostFd;
+    int                       mNcpFd;
+    NcpIoThread::FrameHandler mReceiveHandler;
+};
+
+// A pair of sockets playing the TUN device, `mHostFd` is the end of the host IPv6 stack.
+struct FakeTun
+{
+    FakeTun(void)
+    {
+        int fds[2];
+
+        EXPECT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0, fds), 0);
+        mTunFd  = fds[0];
+        mHostFd = fds[1];
+    }
+
+    ~FakeTun(void)
+    {
+        close(mTunFd);
+        close(mHostFd);
+    }
+
+    int mTunFd;
+    int mHostFd;
+};
+
+std::vector<uint8_t> MakeFrame(uint8_t                     aTid,
+                               unsigned int                aCommand,
+                               spinel_prop_key_t           aKey,
+                               const std::vector<uint8_t> &aData)
+{
+    std::vector<uint8_t> frame(SPINEL_FRAME_MAX_SIZE);
+    spinel_ssize_t       length;
+
+    length = spinel_datatype_pack(frame.data(), frame.size(), "Cii" SPINEL_DATATYPE_DATA_WLEN_S,
+                                  SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(kIid) | aTid, aCommand, aKey, aData.data(),
+                                  static_cast<uint16_t>(aData.size()));
+    EXPECT_GT(length, 0);
+    frame.resize(static_cast<size_t>(length));
+
+    return frame;
+}
+
+std::vector<uint8_t> MakeStreamNetFrame(const std::vector<uint8_t> &aPacket)
+{
+    return MakeFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_NET, aPacket);
+}
+
+void SendPacket(int aFd, const std::vector<uint8_t> &aPacket)
+{
+    ASSERT_EQ(send(aFd, aPacket.data(), aPacket.size(), 0), static_cast<ssize_t>(aPacket.size()));
+}
+
+std::vector<uint8_t> ReceivePacket(int aFd, int aTimeoutMs = 1000)
+{
+    std::vector<uint8_t> packet(SPINEL_FRAME_MAX_SIZE);
+    fd_set               readFdSet;
+    timeval              timeout = otbr::ToTimeval(otbr::Milliseconds(aTimeoutMs));
+    ssize_t              length  = -1;
+
+    FD_ZERO(&readFdSet);
+    FD_SET(aFd, &readFdSet);
+    if (select(aFd + 1, &readFdSet, nullptr, nullptr, &timeout) > 0)
+    {
+        length = recv(aFd, packet.data(), packet.size(), 0);
+    }
+    packet.resize(length > 0 ? static_cast<size_t>(length) : 0);
+
+    return packet;
+}
+
+// Runs one iteration of a mainloop with the I/O thread as its only processor.
+void RunMainloopOnce(NcpIoThread &aIoThread, otbr::Milliseconds aTimeout)
+{
+    MainloopContext context;
+
+    context.mMaxFd   = -1;
+    context.mTimeout = otbr::ToTimeval(aTimeout);
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    aIoThread.Update(context);
+    ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                     &context.mTimeout),
+              0);
+    aIoThread.Process(context);
+}
+
+} // namespace
+
+TEST(NcpIoThread, ForwardsPacketsAndHandsControlFramesToMainloop)
+{
+    FakeTransport                     transport;
+    FakeTun                           tun;
+    NcpIoThread                       ioThread(transport, tun.mTunFd, kIid);
+    std::vector<std::vector<uint8_t>> controlFrames;
+    std::vector<std::vector<uint8_t>> expectedControlFrames;
+    std::vector<uint8_t>              packet = {0x60, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03};
+    std::vector<uint8_t>              frame;
+    auto handler = [&controlFrames](const uint8_t *aFrame, uint16_t aLength) {
+        controlFrames.emplace_back(aFrame, aFrame + aLength);
+    };
+
+    ASSERT_EQ(ioThread.Start(handler), OTBR_ERROR_NONE);
+    EXPECT_TRUE(ioThread.IsRunning());
+    EXPECT_EQ(ioThread.Start(nullptr), OTBR_ERROR_INVALID_STATE);
+
+    // Packets from the NCP are written to the TUN device without the mainloop.
+    SendPacket(transport.GetNcpFd(), MakeStreamNetFrame(packet));
+    EXPECT_EQ(ReceivePacket(tun.mHostFd), packet);
+
+    // Packets from the TUN device are sent as `STREAM_NET` frames with TID 0.
+    SendPacket(tun.mHostFd, packet);
+    frame = ReceivePacket(transport.GetNcpFd());
+    EXPECT_EQ(frame, MakeFrame(0, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET, packet));
+
+    // Responses and other notifications are handed to the mainloop in order.
+    expectedControlFrames.push_back(MakeFrame(1, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, {0}));
+    expectedControlFrames.push_back(MakeFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_NET_ROLE, {2}));
+    expectedControlFrames.push_back(MakeFrame(2, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_NET, packet));
+    for (const std::vector<uint8_t> &controlFrame : expectedControlFrames)
+    {
+        SendPacket(transport.GetNcpFd(), controlFrame);
+    }
+
+    for (int i = 0; i < 100 && controlFrames.size() < expectedControlFrames.size(); i++)
+    {
+        RunMainloopOnce(ioThread, otbr::Milliseconds(10));
+    }
+    EXPECT_EQ(controlFrames, expectedControlFrames);
+
+    ioThread.Stop();
+    EXPECT_FALSE(ioThread.IsRunning());
+    EXPECT_EQ(ioThread.GetCounters().mPacketsFromNcp, 1u);
+    EXPECT_EQ(ioThread.GetCounters().mPacketsToNcp, 1u);
+    EXPECT_EQ(ioThread.GetCounters().mControlFrames, expectedControlFrames.size());
+}
+
+TEST(NcpIoThread, DefersControlFramesWhenRingIsFull)
+{
+    static constexpr size_t kNumFrames = 200;
+
+    FakeTransport        transport;
+    FakeTun              tun;
+    NcpIoThread          ioThread(transport, tun.mTunFd, kIid);
+    std::vector<uint8_t> roles;
+
+    auto                 handler = [&roles](const uint8_t *aFrame, uint16_t aLength) {
+        roles.push_back(aFrame[aLength - 1]);
+    };
+
+    ASSERT_EQ(ioThread.Start(handler), OTBR_ERROR_NONE);
+
+    // The mainloop doesn't run while the NCP sends more frames than the ring holds.
+    for (size_t i = 0; i < kNumFrames; i++)
+    {
+        SendPacket(transport.GetNcpFd(),
+                   MakeFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_NET_ROLE, {static_cast<uint8_t>(i)}));
+    }
+
+    for (int i = 0; i < 1000 && roles.size() < kNumFrames; i++)
+    {
+        RunMainloopOnce(ioThread, otbr::Milliseconds(10));
+    }
+
+    ASSERT_EQ(roles.size(), kNumFrames);
+    for (size_t i = 0; i < kNumFrames; i++)
+    {
+        EXPECT_EQ(roles[i], static_cast<uint8_t>(i));
+    }
+    EXPECT_GT(ioThread.GetCounters().mDeferredControlFrames, 0u);
+}
+
+// Measures the latency of packets from the NCP to the TUN device while
+// the handlers on the mainloop stall for 20 ms per iteration, with the
+// packets forwarded by the I/O thread and by the stalled mainloop as
+// before.
+TEST(NcpIoThread, DISABLED_BenchmarkForwardingLatencyWithStalledMainloop)
+{
+    static constexpr size_t             kNumPackets       = 200;
+    static constexpr size_t             kControlFrameRate = 10;
+    static constexpr otbr::Milliseconds kStall            = otbr::Milliseconds(20);
+
+    struct Result
+    {
+        double mAverageUs;
+        double mMaxUs;
+    };
+
+    auto sendPackets = [](int aNcpFd) {
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            int64_t              now = Clock::now().time_since_epoch().count();
+            std::vector<uint8_t> packet(reinterpret_cast<uint8_t *>(&now), reinterpret_cast<uint8_t *>(&now + 1));
+
+            SendPacket(aNcpFd, MakeStreamNetFrame(packet));
+            if (i % kControlFrameRate == 0)
+            {
+                SendPacket(aNcpFd, MakeFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_NET_ROLE, {2}));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    auto receivePackets = [](int aHostFd, Result &aResult) {
+        double total = 0;
+
+        aResult.mMaxUs = 0;
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            std::vector<uint8_t> packet = ReceivePacket(aHostFd, 5000);
+            int64_t              sent;
+            double               latencyUs;
+
+            ASSERT_EQ(packet.size(), sizeof(sent));
+            memcpy(&sent, packet.data(), sizeof(sent));
+            latencyUs = std::chrono::duration<double, std::micro>(Clock::now().time_since_epoch() -
+                                                                  Clock::duration(sent))
+                            .count();
+            total += latencyUs;
+            aResult.mMaxUs = std::max(aResult.mMaxUs, latencyUs);
+        }
+        aResult.mAverageUs = total / kNumPackets;
+    };
+
+    Result threadResult;
+    Result mainloopResult;
+    size_t numControlFrames = 0;
+
+    {
+        FakeTransport transport;
+        FakeTun       tun;
+        NcpIoThread   ioThread(transport, tun.mTunFd, kIid);
+        std::thread   ncp(sendPackets, transport.GetNcpFd());
+        std::thread   host(receivePackets, tun.mHostFd, std::ref(threadResult));
+
+        ASSERT_EQ(ioThread.Start([&numControlFrames](const uint8_t *, uint16_t) { numControlFrames++; }),
+                  OTBR_ERROR_NONE);
+        while (ioThread.GetCounters().mPacketsFromNcp < kNumPackets)
+        {
+            RunMainloopOnce(ioThread, otbr::Milliseconds(10));
+            std::this_thread::sleep_for(kStall);
+        }
+        ncp.join();
+        host.join();
+        ioThread.Stop();
+    }
+    EXPECT_EQ(numControlFrames, (kNumPackets + kControlFrameRate - 1) / kControlFrameRate);
+
+    // The mainloop reads the transport and forwards the packets itself.
+    {
+        FakeTransport transport;
+        FakeTun       tun;
+        std::thread   ncp(sendPackets, transport.GetNcpFd());
+        std::thread   host(receivePackets, tun.mHostFd, std::ref(mainloopResult));
+        size_t        numPackets = 0;
+
+        transport.SetReceiveHandler([&tun, &numPackets](const uint8_t *aFrame, uint16_t aLength) {
+            uint8_t        header;
+            unsigned int   command;
+            unsigned int   key;
+            const uint8_t *packet;
+            unsigned int   packetLength;
+
+            ASSERT_GT(spinel_datatype_unpack(aFrame, aLength, "Cii" SPINEL_DATATYPE_DATA_WLEN_S, &header, &command,
+                                             &key, &packet, &packetLength),
+                      0);
+            if (key == SPINEL_PROP_STREAM_NET)
+            {
+                ASSERT_EQ(write(tun.mTunFd, packet, packetLength), static_cast<ssize_t>(packetLength));
+                numPackets++;
+            }
+        });
+        while (numPackets < kNumPackets)
+        {
+            MainloopContext context;
+
+            context.mMaxFd   = -1;
+            context.mTimeout = otbr::ToTimeval(otbr::Milliseconds(10));
+            FD_ZERO(&context.mReadFdSet);
+            FD_ZERO(&context.mWriteFdSet);
+            FD_ZERO(&context.mErrorFdSet);
+
+            transport.UpdateFdSet(context);
+            ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, nullptr, nullptr, &context.mTimeout), 0);
+            transport.Process(context);
+            std::this_thread::sleep_for(kStall);
+        }
+        ncp.join();
+        host.join();
+    }
+
+    printf("%zu packets with a %lld ms mainloop stall, latency in us: I/O thread avg %.1f max %.1f, mainloop avg %.1f "
+           "max %.1f\n",
+           kNumPackets, static_cast<long long>(kStall.count()), threadResult.mAverageUs, threadResult.mMaxUs,
+           mainloopResult.mAverageUs, mainloopResult.mMaxUs);
+}
@@ -0,0 +1,762 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string>
+#include <sys/select.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "lib/spinel/spinel.h"
+#include "lib/spinel/spinel_driver.hpp"
+#include "lib/spinel/spinel_interface.hpp"
+#include "ncp/async_task.hpp"
+#include "ncp/ncp_spinel.hpp"
+
+using otbr::Clock;
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+using otbr::Microseconds;
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::Ncp::AsyncTask;
+using otbr::Ncp::AsyncTaskPtr;
+using otbr::Ncp::NcpSpinel;
+
+namespace {
+
+constexpr spinel_iid_t kIid         = 0;
+constexpr Milliseconds kTimeoutWait = Milliseconds(2200);
+
+using Frame = std::vector<uint8_t>;
+
+Frame PackFrame(spinel_tid_t aTid, unsigned int aCommand, spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    Frame          frame(SPINEL_FRAME_MAX_SIZE);
+    spinel_ssize_t headerLength;
+    spinel_ssize_t valueLength;
+    va_list        args;
+
+    headerLength = spinel_datatype_pack(frame.data(), frame.size(), "Cii",
+                                        SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(kIid) | aTid, aCommand, aKey);
+    EXPECT_GT(headerLength, 0);
+
+    va_start(args, aFormat);
+    valueLength = spinel_datatype_vpack(frame.data() + headerLength, frame.size() - headerLength, aFormat, args);
+    va_end(args);
+    EXPECT_GE(valueLength, 0);
+
+    frame.resize(headerLength + valueLength);
+
+    return frame;
+}
+
+// A spinel interface playing the NCP. It answers the queries the spinel driver
+// sends while initializing and records the frames sent by `NcpSpinel`.
+class FakeSpinelInterface : public ot::Spinel::SpinelInterface
+{
+public:
+    otError Init(ReceiveFrameCallback aCallback, void *aCallbackContext, RxFrameBuffer &aFrameBuffer) override
+    {
+        mReceiveCallback = aCallback;
+        mCallbackContext = aCallbackContext;
+        mRxFrameBuffer   = &aFrameBuffer;
+
+        return OT_ERROR_NONE;
+    }
+
+    void Deinit(void) override {}
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength) override
+    {
+        spinel_tid_t      tid = SPINEL_HEADER_GET_TID(aFrame[0]);
+        unsigned int      cmd;
+        spinel_prop_key_t key;
+
+        VerifyOrExit(mSendError == OT_ERROR_NONE);
+
+        if (aLength >= 2 && aFrame[1] == SPINEL_CMD_RESET)
+        {
+            mPendingFrames.push_back(
+                PackFrame(0, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, "i", SPINEL_STATUS_RESET_SOFTWARE));
+            ExitNow();
+        }
+
+        if (spinel_datatype_unpack(aFrame, aLength, "Cii", nullptr, &cmd, &key) > 0 && cmd == SPINEL_CMD_PROP_VALUE_GET)
+        {
+            switch (key)
+            {
+            case SPINEL_PROP_PROTOCOL_VERSION:
+                mPendingFrames.push_back(PackFrame(tid, SPINEL_CMD_PROP_VALUE_IS, key, "ii",
+                                                   SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                                                   SPINEL_PROTOCOL_VERSION_THREAD_MINOR));
+                break;
+            case SPINEL_PROP_NCP_VERSION:
+                mPendingFrames.push_back(PackFrame(tid, SPINEL_CMD_PROP_VALUE_IS, key, "U", "FAKE-NCP"));
+                break;
+            case SPINEL_PROP_CAPS:
+                mPendingFrames.push_back(PackFrame(tid, SPINEL_CMD_PROP_VALUE_IS, key, "i", SPINEL_CAP_CONFIG_FTD));
+                break;
+            default:
+                break;
+            }
+            ExitNow();
+        }
+
+        mSentFrames.emplace_back(aFrame, aFrame + aLength);
+
+    exit:
+        return mSendError;
+    }
+
+    otError WaitForFrame(uint64_t aTimeoutUs) override
+    {
+        OTBR_UNUSED_VARIABLE(aTimeoutUs);
+
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(!mPendingFrames.empty(), error = OT_ERROR_RESPONSE_TIMEOUT);
+
+        for (uint8_t byte : mPendingFrames.front())
+        {
+            SuccessOrExit(error = mRxFrameBuffer->WriteByte(byte));
+        }
+        mPendingFrames.pop_front();
+        mReceiveCallback(mCallbackContext);
+
+    exit:
+        return error;
+    }
+
+    void UpdateFdSet(void *aMainloopContext) override { OTBR_UNUSED_VARIABLE(aMainloopContext); }
+    void Process(const void *aMainloopContext) override { OTBR_UNUSED_VARIABLE(aMainloopContext); }
+
+    uint32_t                     GetBusSpeed(void) const override { return 0; }
+    otError                      HardwareReset(void) override { return OT_ERROR_NOT_IMPLEMENTED; }
+    const otRcpInterfaceMetrics *GetRcpInterfaceMetrics(void) const override { return nullptr; }
+
+    std::vector<Frame> mSentFrames;
+    otError            mSendError = OT_ERROR_NONE;
+
+private:
+    ReceiveFrameCallback mReceiveCallback = nullptr;
+    void                *mCallbackContext = nullptr;
+    RxFrameBuffer       *mRxFrameBuffer   = nullptr;
+    std::deque<Frame>    mPendingFrames;
+};
+
+class FakePropsObserver : public otbr::Ncp::PropsObserver
+{
+public:
+    void SetDeviceRole(otDeviceRole aRole) override { OTBR_UNUSED_VARIABLE(aRole); }
+};
+
+// The result of a request, `OT_ERROR_PENDING` until its async task is completed.
+struct Result
+{
+    otError mError = OT_ERROR_PENDING;
+    int     mCount = 0;
+};
+
+AsyncTaskPtr MakeTask(Result &aResult)
+{
+    return std::make_shared<AsyncTask>([&aResult](otError aError, const std::string &aErrorInfo) {
+        OTBR_UNUSED_VARIABLE(aErrorInfo);
+
+        aResult.mError = aError;
+        aResult.mCount++;
+    });
+}
+
+void RunMainloop(Milliseconds aDuration)
+{
+    Timepoint end = Clock::now() + aDuration;
+
+    do
+    {
+        MainloopContext mainloop;
+        Microseconds    remaining = std::chrono::duration_cast<Microseconds>(end - Clock::now());
+
+        remaining = std::max(remaining, Microseconds(0));
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {static_cast<time_t>(remaining.count() / 1000000),
+                             static_cast<suseconds_t>(remaining.count() % 1000000)};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+        EXPECT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                         &mainloop.mTimeout),
+                  0);
+        MainloopManager::GetInstance().Process(mainloop);
+    } while (Clock::now() < end);
+}
+
+void RunMainloopUntil(const std::function<bool(void)> &aCondition, Milliseconds aMaxDuration)
+{
+    Timepoint end = Clock::now() + aMaxDuration;
+
+    while (!aCondition() && Clock::now() < end)
+    {
+        RunMainloop(Milliseconds(1));
+    }
+}
+
+// Builds an IPv6 packet carrying `aId`. `aHeaders` lists the extension headers
+// followed by the upper-layer protocol, a Fragment header gets `aFragmentOffset`.
+Frame MakeIp6Packet(const std::vector<uint8_t> &aHeaders, uint8_t aId, uint16_t aFragmentOffset = 0)
+{
+    static constexpr uint16_t kIp6HeaderSize = 40;
+    static constexpr uint16_t kPayloadSize   = 8;
+
+    Frame packet(kIp6HeaderSize);
+
+    packet[0] = 0x60;
+    packet[6] = aHeaders.front();
+
+    for (size_t i = 0; i + 1 < aHeaders.size(); i++)
+    {
+        uint8_t extensionHeader[8] = {aHeaders[i + 1]};
+
+        if (aHeaders[i] == IPPROTO_FRAGMENT)
+        {
+            extensionHeader[2] = static_cast<uint8_t>(aFragmentOffset >> 5);
+            extensionHeader[3] = static_cast<uint8_t>(aFragmentOffset << 3);
+        }
+
+        packet.insert(packet.end(), extensionHeader, extensionHeader + sizeof(extensionHeader));
+    }
+
+    packet.resize(packet.size() + kPayloadSize);
+    packet.back() = aId;
+    packet[4]     = static_cast<uint8_t>((packet.size() - kIp6HeaderSize) >> 8);
+    packet[5]     = static_cast<uint8_t>(packet.size() - kIp6HeaderSize);
+
+    return packet;
+}
+
+class NcpSpinelTest : public ::testing::Test
+{
+protected:
+    void SetUp(void) override
+    {
+        static const spinel_iid_t kIidList[] = {kIid};
+
+        EXPECT_EQ(mDriver.Init(mInterface, /* aSoftwareReset */ true, kIidList, 1), OT_COPROCESSOR_NCP);
+        mNcpSpinel.Init(mDriver, mObserver);
+    }
+
+    void TearDown(void) override { mNcpSpinel.Deinit(); }
+
+    spinel_tid_t GetLastSentTid(void) const { return SPINEL_HEADER_GET_TID(mInterface.mSentFrames.back()[0]); }
+
+    // Answers a request setting a boolean property, as the NCP does.
+    void RespondBool(spinel_tid_t aTid, spinel_prop_key_t aKey)
+    {
+        Receive(PackFrame(aTid, SPINEL_CMD_PROP_VALUE_IS, aKey, SPINEL_DATATYPE_BOOL_S, true));
+    }
+
+    void RespondStatus(spinel_tid_t aTid, spinel_status_t aStatus)
+    {
+        Receive(PackFrame(aTid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, SPINEL_DATATYPE_UINT_PACKED_S,
+                          aStatus));
+    }
+
+    void Receive(const Frame &aFrame)
+    {
+        mNcpSpinel.HandleReceivedFrame(aFrame.data(), static_cast<uint16_t>(aFrame.size()));
+    }
+
+    // Sends requests until all TIDs are in use, then completes them.
+    size_t CountAvailableTids(void)
+    {
+        std::vector<spinel_tid_t> tids;
+
+        for (int i = 0; i < 16; i++)
+        {
+            size_t numSent = mInterface.mSentFrames.size();
+
+            mNcpSpinel.Ip6SetEnabled(true, MakeTask(AddResult()));
+            if (mInterface.mSentFrames.size() == numSent)
+            {
+                break;
+            }
+            tids.push_back(GetLastSentTid());
+        }
+
+        // Runs the posted result of the request which failed.
+        RunMainloop(Milliseconds(0));
+
+        for (spinel_tid_t tid : tids)
+        {
+            RespondBool(tid, SPINEL_PROP_NET_IF_UP);
+        }
+
+        return tids.size();
+    }
+
+    otbrError Ip6Send(const Frame &aPacket)
+    {
+        return mNcpSpinel.Ip6Send(aPacket.data(), static_cast<uint16_t>(aPacket.size()));
+    }
+
+    // Answers the IPv6 packets sent to the NCP until the transmit queue is empty, returns
+    // the IDs of all the packets sent.
+    std::vector<uint8_t> DrainIp6TxQueue(void)
+    {
+        std::vector<uint8_t> ids;
+        size_t               numAnswered = 0;
+
+        for (int i = 0; i < 100 && (numAnswered < mInterface.mSentFrames.size() || mNcpSpinel.GetIp6TxQueueDepth() > 0);
+             i++)
+        {
+            RunMainloop(Milliseconds(0));
+
+            for (; numAnswered < mInterface.mSentFrames.size(); numAnswered++)
+            {
+                const Frame      &frame = mInterface.mSentFrames[numAnswered];
+                unsigned int      cmd;
+                spinel_prop_key_t key;
+                const uint8_t    *packet;
+                spinel_size_t     packetLength;
+
+                if (spinel_datatype_unpack(frame.data(), frame.size(), "Cii" SPINEL_DATATYPE_DATA_WLEN_S, nullptr, &cmd,
+                                           &key, &packet, &packetLength) > 0 &&
+                    key == SPINEL_PROP_STREAM_NET)
+                {
+                    ids.push_back(packet[packetLength - 1]);
+                    RespondStatus(SPINEL_HEADER_GET_TID(frame[0]), SPINEL_STATUS_OK);
+                }
+            }
+        }
+
+        return ids;
+    }
+
+    // The results outlive `mNcpSpinel`, which fails the requests still pending when it's destroyed.
+    Result &AddResult(void)
+    {
+        mResults.emplace_back();
+        return mResults.back();
+    }
+
+    std::deque<Result>       mResults;
+    FakeSpinelInterface      mInterface;
+    ot::Spinel::SpinelDriver mDriver;
+    FakePropsObserver        mObserver;
+    NcpSpinel                mNcpSpinel;
+};
+
+} // namespace
+
+// The OpenThread core linked in for the string helpers of its API needs this,
+// it's provided by the agent's main.
+extern "C" void otPlatReset(otInstance *aInstance)
+{
+    OTBR_UNUSED_VARIABLE(aInstance);
+}
+
+TEST_F(NcpSpinelTest, OutOfOrderResponsesCompleteTheirOwnRequests)
+{
+    Result      &ip6Result    = AddResult();
+    Result      &threadResult = AddResult();
+    spinel_tid_t ip6Tid;
+    spinel_tid_t threadTid;
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(ip6Result));
+    ip6Tid = GetLastSentTid();
+    mNcpSpinel.ThreadSetEnabled(true, MakeTask(threadResult));
+    threadTid = GetLastSentTid();
+
+    // Both requests are sent without waiting for the first response.
+    ASSERT_EQ(mInterface.mSentFrames.size(), 2u);
+    EXPECT_NE(ip6Tid, threadTid);
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mMaxInFlight, 2);
+
+    RespondBool(threadTid, SPINEL_PROP_NET_STACK_UP);
+    EXPECT_EQ(ip6Result.mError, OT_ERROR_PENDING);
+    EXPECT_EQ(threadResult.mError, OT_ERROR_NONE);
+
+    RespondBool(ip6Tid, SPINEL_PROP_NET_IF_UP);
+    EXPECT_EQ(ip6Result.mError, OT_ERROR_NONE);
+    EXPECT_EQ(ip6Result.mCount, 1);
+    EXPECT_EQ(threadResult.mCount, 1);
+
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mSent, 2u);
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mCompleted, 2u);
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mLatency.GetCount(), 2u);
+}
+
+TEST_F(NcpSpinelTest, MismatchedResponseFailsTheRequest)
+{
+    Result &result = AddResult();
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(result));
+    RespondBool(GetLastSentTid(), SPINEL_PROP_NET_STACK_UP);
+
+    EXPECT_EQ(result.mError, OT_ERROR_FAILED);
+}
+
+TEST_F(NcpSpinelTest, ExhaustedTidsFailWithBusy)
+{
+    std::vector<spinel_tid_t> tids;
+    Result                   &busyResult = AddResult();
+    Result                   &nextResult = AddResult();
+
+    for (int i = 0; i < 15; i++)
+    {
+        mNcpSpinel.ThreadSetEnabled(true, MakeTask(AddResult()));
+        tids.push_back(GetLastSentTid());
+    }
+
+    std::sort(tids.begin(), tids.end());
+    EXPECT_EQ(std::unique(tids.begin(), tids.end()), tids.end());
+
+    mNcpSpinel.ThreadSetEnabled(true, MakeTask(busyResult));
+    EXPECT_EQ(mInterface.mSentFrames.size(), 15u);
+    RunMainloop(Milliseconds(0));
+    EXPECT_EQ(busyResult.mError, OT_ERROR_BUSY);
+
+    // A response frees its TID for the next request.
+    RespondBool(tids[3], SPINEL_PROP_NET_STACK_UP);
+    mNcpSpinel.ThreadSetEnabled(true, MakeTask(nextResult));
+    EXPECT_EQ(GetLastSentTid(), tids[3]);
+    EXPECT_EQ(nextResult.mError, OT_ERROR_PENDING);
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mMaxInFlight, 15);
+}
+
+TEST_F(NcpSpinelTest, LateResponseDoesNotCompleteAnotherRequest)
+{
+    Result               &timedOutResult = AddResult();
+    Result               &busyResult     = AddResult();
+    Result               &reusedResult   = AddResult();
+    std::vector<Result *> results;
+    spinel_tid_t          timedOutTid;
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(timedOutResult));
+    timedOutTid = GetLastSentTid();
+
+    RunMainloop(kTimeoutWait);
+    EXPECT_EQ(timedOutResult.mError, OT_ERROR_RESPONSE_TIMEOUT);
+    EXPECT_EQ(mNcpSpinel.GetTransactionMetrics().mTimedOut, 1u);
+
+    // The timed-out TID isn't reused while its response may still arrive.
+    for (int i = 0; i < 14; i++)
+    {
+        results.push_back(&AddResult());
+        mNcpSpinel.Ip6SetEnabled(true, MakeTask(*results.back()));
+        EXPECT_NE(GetLastSentTid(), timedOutTid);
+    }
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(busyResult));
+    RunMainloop(Milliseconds(0));
+    EXPECT_EQ(busyResult.mError, OT_ERROR_BUSY);
+
+    RespondBool(timedOutTid, SPINEL_PROP_NET_IF_UP);
+    for (const Result *result : results)
+    {
+        EXPECT_EQ(result->mError, OT_ERROR_PENDING);
+    }
+    EXPECT_EQ(timedOutResult.mCount, 1);
+
+    // The late response releases the TID.
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(reusedResult));
+    EXPECT_EQ(GetLastSentTid(), timedOutTid);
+    RespondBool(timedOutTid, SPINEL_PROP_NET_IF_UP);
+    EXPECT_EQ(reusedResult.mError, OT_ERROR_NONE);
+}
+
+TEST_F(NcpSpinelTest, LaterResponseOrResetReleasesTimedOutTids)
+{
+    Result &timedOutResult = AddResult();
+    Result &resetResult    = AddResult();
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(timedOutResult));
+    RunMainloop(kTimeoutWait);
+    EXPECT_EQ(timedOutResult.mError, OT_ERROR_RESPONSE_TIMEOUT);
+
+    // The NCP responds in order, so the responses to the later requests mean the timed-out one was lost.
+    EXPECT_EQ(CountAvailableTids(), 14u);
+    EXPECT_EQ(CountAvailableTids(), 15u);
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(resetResult));
+    RunMainloop(kTimeoutWait);
+    EXPECT_EQ(resetResult.mError, OT_ERROR_RESPONSE_TIMEOUT);
+
+    RespondStatus(0, SPINEL_STATUS_RESET_SOFTWARE);
+    EXPECT_EQ(CountAvailableTids(), 15u);
+}
+
+TEST_F(NcpSpinelTest, SlowRequestsHaveLongerTimeout)
+{
+    Result &ip6Result   = AddResult();
+    Result &eraseResult = AddResult();
+
+    mNcpSpinel.Ip6SetEnabled(true, MakeTask(ip6Result));
+    mNcpSpinel.ThreadErasePersistentInfo(MakeTask(eraseResult));
+
+    RunMainloop(kTimeoutWait);
+    EXPECT_EQ(ip6Result.mError, OT_ERROR_RESPONSE_TIMEOUT);
+    EXPECT_EQ(eraseResult.mError, OT_ERROR_PENDING);
+
+    RespondStatus(GetLastSentTid(), SPINEL_STATUS_OK);
+    EXPECT_EQ(eraseResult.mError, OT_ERROR_NONE);
+}
+
+// Measures how long the three requests of a join take when each is sent after
+// the previous one completed, and when they are pipelined. The fake NCP answers
+// each request after a transport round trip and handles one at a time.
+TEST_F(NcpSpinelTest, DISABLED_BenchmarkJoinRequests)
+{
+    static constexpr Milliseconds kRoundTrip  = Milliseconds(10);
+    static constexpr Milliseconds kProcessing = Milliseconds(2);
+    static constexpr int          kRounds     = 20;
+
+    otbr::TaskRunner         ncp;
+    Timepoint                ncpIdleTime = Clock::now();
+    size_t                   numAnswered = 0;
+    otOperationalDatasetTlvs dataset     = {};
+    Microseconds             serial(0);
+    Microseconds             pipelined(0);
+
+    auto answerRequests = [&]() {
+        for (; numAnswered < mInterface.mSentFrames.size(); numAnswered++)
+        {
+            const Frame      &frame = mInterface.mSentFrames[numAnswered];
+            spinel_tid_t      tid   = SPINEL_HEADER_GET_TID(frame[0]);
+            unsigned int      cmd;
+            spinel_prop_key_t key;
+
+            ASSERT_GT(spinel_datatype_unpack(frame.data(), frame.size(), "Cii", nullptr, &cmd, &key), 0);
+            ncpIdleTime = std::max(ncpIdleTime, Clock::now() + kRoundTrip / 2) + kProcessing;
+            ncp.Post(std::chrono::duration_cast<Milliseconds>(ncpIdleTime + kRoundTrip / 2 - Clock::now()),
+                     [this, tid, key]() { RespondBool(tid, key); });
+        }
+    };
+    std::function<void(AsyncTaskPtr)> requests[] = {
+        [&](AsyncTaskPtr aTask) { mNcpSpinel.DatasetSetActiveTlvs(dataset, aTask); },
+        [&](AsyncTaskPtr aTask) { mNcpSpinel.Ip6SetEnabled(true, aTask); },
+        [&](AsyncTaskPtr aTask) { mNcpSpinel.ThreadSetEnabled(true, aTask); },
+    };
+
+    for (int round = 0; round < kRounds; round++)
+    {
+        Timepoint start = Clock::now();
+
+        for (auto &request : requests)
+        {
+            Result &result = AddResult();
+
+            request(MakeTask(result));
+            answerRequests();
+            RunMainloopUntil([&result]() { return result.mError != OT_ERROR_PENDING; }, Milliseconds(1000));
+            EXPECT_EQ(result.mError, OT_ERROR_NONE);
+        }
+        serial += std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    }
+
+    for (int round = 0; round < kRounds; round++)
+    {
+        Timepoint start = Clock::now();
+        Result   *last  = nullptr;
+
+        for (auto &request : requests)
+        {
+            last = &AddResult();
+            request(MakeTask(*last));
+        }
+        answerRequests();
+        RunMainloopUntil([last]() { return last->mError != OT_ERROR_PENDING; }, Milliseconds(1000));
+        EXPECT_EQ(last->mError, OT_ERROR_NONE);
+        pipelined += std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    }
+
+    printf("join requests with a %lld ms round trip: serial %.1f ms, pipelined %.1f ms\n",
+           static_cast<long long>(kRoundTrip.count()), serial.count() / 1000.0 / kRounds,
+           pipelined.count() / 1000.0 / kRounds);
+}
+
+TEST_F(NcpSpinelTest, Ip6TxQueueDrainsInOrder)
+{
+    std::vector<uint8_t> expectedIds;
+
+    // The spinel interface is out of buffers.
+    mInterface.mSendError = OT_ERROR_NO_BUFS;
+
+    for (uint8_t id = 0; id < 5; id++)
+    {
+        EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_UDP}, id)), OTBR_ERROR_NONE);
+        expectedIds.push_back(id);
+    }
+
+    EXPECT_TRUE(mInterface.mSentFrames.empty());
+    EXPECT_EQ(mNcpSpinel.GetIp6TxQueueDepth(), 5);
+
+    mInterface.mSendError = OT_ERROR_NONE;
+
+    // A new packet waits for the queued ones.
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_ICMPV6}, 5)), OTBR_ERROR_NONE);
+    expectedIds.push_back(5);
+    EXPECT_TRUE(mInterface.mSentFrames.empty());
+
+    // The retry timer drains the queue up to the number of free TIDs, the responses drain the rest.
+    RunMainloop(Milliseconds(20));
+    EXPECT_EQ(DrainIp6TxQueue(), expectedIds);
+
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mSentPackets, 6u);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mQueuedPackets, 6u);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mDroppedPackets, 0u);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mMaxQueueDepth, 6);
+}
+
+TEST_F(NcpSpinelTest, Ip6TxQueueDrainsWhenTidsAreFreed)
+{
+    std::vector<uint8_t> expectedIds;
+
+    for (int i = 0; i < 15; i++)
+    {
+        mNcpSpinel.Ip6SetEnabled(true, MakeTask(AddResult()));
+    }
+
+    for (uint8_t id = 0; id < 20; id++)
+    {
+        EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_TCP}, id)), OTBR_ERROR_NONE);
+        expectedIds.push_back(id);
+    }
+    EXPECT_EQ(mNcpSpinel.GetIp6TxQueueDepth(), 20);
+
+    // A response frees a TID for the oldest queued packet.
+    RespondBool(SPINEL_HEADER_GET_TID(mInterface.mSentFrames[0][0]), SPINEL_PROP_NET_IF_UP);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxQueueDepth(), 19);
+
+    for (size_t i = 1; i < 15; i++)
+    {
+        RespondBool(SPINEL_HEADER_GET_TID(mInterface.mSentFrames[i][0]), SPINEL_PROP_NET_IF_UP);
+    }
+    mInterface.mSentFrames.erase(mInterface.mSentFrames.begin(), mInterface.mSentFrames.begin() + 15);
+
+    EXPECT_EQ(DrainIp6TxQueue(), expectedIds);
+}
+
+TEST_F(NcpSpinelTest, Ip6TxQueueOverflowKeepsIcmp6)
+{
+    static constexpr uint8_t kQueueLength = 64;
+
+    std::vector<uint8_t> expectedIds;
+
+    mInterface.mSendError = OT_ERROR_NO_BUFS;
+
+    for (uint8_t id = 0; id < kQueueLength; id++)
+    {
+        EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_UDP}, id)), OTBR_ERROR_NONE);
+    }
+
+    // A new packet of another protocol is dropped.
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_UDP}, 100)), OTBR_ERROR_DROPPED);
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_FRAGMENT, IPPROTO_ICMPV6}, 101, /* aFragmentOffset */ 1)),
+              OTBR_ERROR_DROPPED);
+
+    // ICMPv6 packets, also after extension headers, replace the oldest packets of other protocols.
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_ICMPV6}, 102)), OTBR_ERROR_NONE);
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_HOPOPTS, IPPROTO_ICMPV6}, 103)), OTBR_ERROR_NONE);
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_HOPOPTS, IPPROTO_DSTOPTS, IPPROTO_ROUTING, IPPROTO_ICMPV6}, 104)),
+              OTBR_ERROR_NONE);
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_FRAGMENT, IPPROTO_ICMPV6}, 105)), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(mNcpSpinel.GetIp6TxQueueDepth(), kQueueLength);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mDroppedPackets, 6u);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mMaxQueueDepth, kQueueLength);
+
+    for (uint8_t id = 4; id < kQueueLength; id++)
+    {
+        expectedIds.push_back(id);
+    }
+    for (uint8_t id = 102; id <= 105; id++)
+    {
+        expectedIds.push_back(id);
+    }
+
+    mInterface.mSendError = OT_ERROR_NONE;
+    RunMainloop(Milliseconds(20));
+    EXPECT_EQ(DrainIp6TxQueue(), expectedIds);
+}
+
+TEST_F(NcpSpinelTest, Ip6TxQueueFullOfIcmp6DropsNewIcmp6)
+{
+    static constexpr uint8_t kQueueLength = 64;
+
+    mInterface.mSendError = OT_ERROR_NO_BUFS;
+
+    for (uint8_t id = 0; id < kQueueLength; id++)
+    {
+        EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_ICMPV6}, id)), OTBR_ERROR_NONE);
+    }
+
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_ICMPV6}, 100)), OTBR_ERROR_DROPPED);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxQueueDepth(), kQueueLength);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mDroppedPackets, 1u);
+}
+
+TEST_F(NcpSpinelTest, Ip6TxQueueTailDropDropsNewIcmp6)
+{
+    static constexpr uint8_t kQueueLength = 64;
+
+    std::vector<uint8_t> expectedIds;
+
+    mNcpSpinel.Ip6SetTxDropPolicy(NcpSpinel::Ip6TxDropPolicy::kTailDrop);
+    mInterface.mSendError = OT_ERROR_NO_BUFS;
+
+    for (uint8_t id = 0; id < kQueueLength; id++)
+    {
+        EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_UDP}, id)), OTBR_ERROR_NONE);
+        expectedIds.push_back(id);
+    }
+
+    // The queued packets are kept whatever the protocol of the new packet.
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_UDP}, 100)), OTBR_ERROR_DROPPED);
+    EXPECT_EQ(Ip6Send(MakeIp6Packet({IPPROTO_ICMPV6}, 101)), OTBR_ERROR_DROPPED);
+    EXPECT_EQ(mNcpSpinel.GetIp6TxCounters().mDroppedPackets, 2u);
+
+    mInterface.mSendError = OT_ERROR_NONE;
+    RunMainloop(Milliseconds(20));
+    EXPECT_EQ(DrainIp6TxQueue(), expectedIds);
+}
@@ -0,0 +1,893 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/if_packet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/ip6.h>
+#include <poll.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#include "backbone_router/nd_proxy.hpp"
+#include "backbone_router/nd_proxy_filter.hpp"
+#include "common/types.hpp"
+#include "utils/route_netlink.hpp"
+
+namespace {
+
+// The Backbone interface `ndp0` is a veth peered with `ndp1`, where a host
+// resolves a DUA which is routed to the Thread interface `ndp2`.
+constexpr char    kBackboneIf[]                   = "ndp0";
+constexpr char    kHostIf[]                       = "ndp1";
+constexpr uint8_t kBackboneMacAddr[ETH_ALEN]      = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+constexpr uint8_t kHostMacAddr[ETH_ALEN]          = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+constexpr char    kHostAddr[]                     = "fe80::2";
+constexpr char    kDua[]                          = "fd00:7d03:7d03:7d03::1234";
+constexpr char    kSetUpNetworkCommand[]          = "ip link set lo up && "
+                                                    "ip link add ndp0 address 02:00:00:00:00:01 type veth "
+                                                    "peer name ndp1 address 02:00:00:00:00:02 && "
+                                                    "ip link add ndp2 type veth peer name ndp3 && "
+                                                    "ip link set ndp0 up && ip link set ndp1 up && "
+                                                    "ip link set ndp2 up && "
+                                                    "ip -6 route add fd00:7d03:7d03:7d03::/64 dev ndp2 && "
+                                                    "ip -6 neigh add fe80::2 lladdr 02:00:00:00:00:02 dev ndp0";
+constexpr size_t  kNumSolicitations               = 20000;
+constexpr size_t  kMaxOutstandingSolicitations    = 32;
+constexpr int     kAdvertisementTimeoutMs         = 200;
+constexpr uint8_t kSolicitedNodeMacAddr[ETH_ALEN] = {0x33, 0x33, 0xff, 0x00, 0x12, 0x34};
+constexpr char    kSolicitedNodeAddr[]            = "ff02::1:ff00:1234";
+constexpr char    kDomainPrefix[]                 = "fd00:7d03:7d03:7d03::";
+constexpr size_t  kNumMulticastSolicitations      = 20000;
+constexpr size_t  kMulticastBurstSize             = 32;
+constexpr size_t  kReceiveBatchSize               = 8;
+
+struct NeighborSolicitationFrame
+{
+    ether_header        mEthernet;
+    ip6_hdr             mIp6;
+    nd_neighbor_solicit mSolicit;
+    nd_opt_hdr          mSourceLinkAddrOption;
+    uint8_t             mSourceLinkAddr[ETH_ALEN];
+} __attribute__((packed));
+
+bool WriteSysctl(const char *aName, const char *aValue)
+{
+    std::string path = std::string("/proc/sys/net/ipv6/") + aName;
+    int         fd   = open(path.c_str(), O_WRONLY);
+    bool        ok   = (fd >= 0 && write(fd, aValue, strlen(aValue)) == static_cast<ssize_t>(strlen(aValue)));
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return ok;
+}
+
+uint16_t ComputeIcmp6Checksum(const ip6_hdr &aIp6, const uint8_t *aMessage, uint16_t aLength)
+{
+    uint32_t sum = aLength + IPPROTO_ICMPV6;
+
+    for (size_t i = 0; i < sizeof(in6_addr); i += 2)
+    {
+        sum += (aIp6.ip6_src.s6_addr[i] << 8) | aIp6.ip6_src.s6_addr[i + 1];
+        sum += (aIp6.ip6_dst.s6_addr[i] << 8) | aIp6.ip6_dst.s6_addr[i + 1];
+    }
+
+    for (uint16_t i = 0; i < aLength; i += 2)
+    {
+        sum += (aMessage[i] << 8) | (i + 1 < aLength ? aMessage[i + 1] : 0);
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return htons(static_cast<uint16_t>(~sum));
+}
+
+// Builds a solicitation from the host for `aTarget`, which is sent to
+// `aDst` and the link-layer address `aDstMacAddr`.
+void InitSolicitationFrame(NeighborSolicitationFrame &aFrame,
+                           const uint8_t             *aDstMacAddr,
+                           const char                *aDst,
+                           const char                *aTarget)
+{
+    memset(&aFrame, 0, sizeof(aFrame));
+    memcpy(aFrame.mEthernet.ether_dhost, aDstMacAddr, ETH_ALEN);
+    memcpy(aFrame.mEthernet.ether_shost, kHostMacAddr, ETH_ALEN);
+    aFrame.mEthernet.ether_type = htons(ETH_P_IPV6);
+
+    aFrame.mIp6.ip6_flow = htonl(6 << 28);
+    aFrame.mIp6.ip6_plen = htons(sizeof(aFrame) - sizeof(aFrame.mEthernet) - sizeof(aFrame.mIp6));
+    aFrame.mIp6.ip6_nxt  = IPPROTO_ICMPV6;
+    aFrame.mIp6.ip6_hlim = 255;
+    inet_pton(AF_INET6, kHostAddr, &aFrame.mIp6.ip6_src);
+    inet_pton(AF_INET6, aDst, &aFrame.mIp6.ip6_dst);
+
+    aFrame.mSolicit.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+    inet_pton(AF_INET6, aTarget, &aFrame.mSolicit.nd_ns_target);
+    aFrame.mSourceLinkAddrOption.nd_opt_type = ND_OPT_SOURCE_LINKADDR;
+    aFrame.mSourceLinkAddrOption.nd_opt_len  = 1;
+    memcpy(aFrame.mSourceLinkAddr, kHostMacAddr, ETH_ALEN);
+    aFrame.mSolicit.nd_ns_cksum = ComputeIcmp6Checksum(
+        aFrame.mIp6, reinterpret_cast<const uint8_t *>(&aFrame.mSolicit), ntohs(aFrame.mIp6.ip6_plen));
+}
+
+int OpenPacketSocket(const char *aInterfaceName)
+{
+    int         fd = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_IPV6));
+    sockaddr_ll addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sll_family   = AF_PACKET;
+    addr.sll_protocol = htons(ETH_P_IPV6);
+    addr.sll_ifindex  = static_cast<int>(if_nametoindex(aInterfaceName));
+
+    if (fd >= 0 && bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+// Receives a frame without blocking and returns the ICMPv6 message of the
+// given type in it, or `nullptr` if it's something else. `aIsEmpty` tells
+// whether there was no frame to receive.
+const uint8_t *ReceiveIcmp6(int aFd, uint8_t aType, uint8_t *aBuffer, size_t aSize, bool &aIsEmpty)
+{
+    sockaddr_ll    from;
+    socklen_t      fromLen = sizeof(from);
+    const ip6_hdr *ip6     = reinterpret_cast<const ip6_hdr *>(aBuffer + sizeof(ether_header));
+    const uint8_t *message = aBuffer + sizeof(ether_header) + sizeof(ip6_hdr);
+    ssize_t        len;
+
+    len      = recvfrom(aFd, aBuffer, aSize, MSG_DONTWAIT, reinterpret_cast<sockaddr *>(&from), &fromLen);
+    aIsEmpty = (len < 0);
+
+    if (len < static_cast<ssize_t>(sizeof(ether_header) + sizeof(ip6_hdr) + sizeof(nd_neighbor_solicit)) ||
+        from.sll_pkttype == PACKET_OUTGOING || ip6->ip6_nxt != IPPROTO_ICMPV6 || message[0] != aType)
+    {
+        message = nullptr;
+    }
+
+    return message;
+}
+
+// Answers solicitations for the DUA from user space, which costs a receive
+// and a send system call per solicitation like the NFQUEUE fallback does.
+void RunUserSpaceProxy(int aPacketFd, const std::atomic<bool> &aIsRunning)
+{
+    int          icmp6Fd = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+    int          hops    = 255;
+    uint8_t      buffer[1500];
+    in6_addr     dua;
+    sockaddr_in6 dst;
+
+    inet_pton(AF_INET6, kDua, &dua);
+    setsockopt(icmp6Fd, SOL_SOCKET, SO_BINDTODEVICE, kBackboneIf, strlen(kBackboneIf));
+    setsockopt(icmp6Fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops));
+
+    memset(&dst, 0, sizeof(dst));
+    dst.sin6_family   = AF_INET6;
+    dst.sin6_scope_id = if_nametoindex(kBackboneIf);
+
+    while (aIsRunning)
+    {
+        pollfd         pfd = {aPacketFd, POLLIN, 0};
+        bool           isEmpty;
+        const uint8_t *message;
+
+        if (poll(&pfd, 1, 10) <= 0 ||
+            (message = ReceiveIcmp6(aPacketFd, ND_NEIGHBOR_SOLICIT, buffer, sizeof(buffer), isEmpty)) == nullptr)
+        {
+            continue;
+        }
+
+        const nd_neighbor_solicit &ns = *reinterpret_cast<const nd_neighbor_solicit *>(message);
+        nd_neighbor_advert         na;
+
+        if (memcmp(&ns.nd_ns_target, &dua, sizeof(dua)) != 0)
+        {
+            continue;
+        }
+
+        memset(&na, 0, sizeof(na));
+        na.nd_na_type           = ND_NEIGHBOR_ADVERT;
+        na.nd_na_flags_reserved = ND_NA_FLAG_SOLICITED | ND_NA_FLAG_ROUTER;
+        na.nd_na_target         = dua;
+
+        dst.sin6_addr = reinterpret_cast<const ip6_hdr *>(buffer + sizeof(ether_header))->ip6_src;
+        sendto(icmp6Fd, &na, sizeof(na), 0, reinterpret_cast<sockaddr *>(&dst), sizeof(dst));
+    }
+
+    close(icmp6Fd);
+}
+
+// Sends unicast solicitations for the DUA from the host, with at most
+// `kMaxOutstandingSolicitations` of them unanswered at any time, and
+// returns the number of advertisements received for them.
+size_t SolicitDua(double &aSeconds)
+{
+    int                       fd = OpenPacketSocket(kHostIf);
+    NeighborSolicitationFrame frame;
+    uint8_t                   buffer[1500];
+    size_t                    sent     = 0;
+    size_t                    answered = 0;
+    size_t                    lost     = 0;
+    auto                      start    = std::chrono::steady_clock::now();
+
+    InitSolicitationFrame(frame, kBackboneMacAddr, kDua, kDua);
+
+    while (answered + lost < kNumSolicitations)
+    {
+        pollfd pfd     = {fd, POLLIN, 0};
+        bool   isEmpty = false;
+
+        while (sent < kNumSolicitations && sent - answered - lost < kMaxOutstandingSolicitations)
+        {
+            if (send(fd, &frame, sizeof(frame), 0) == static_cast<ssize_t>(sizeof(frame)))
+            {
+                sent++;
+            }
+        }
+
+        if (poll(&pfd, 1, kAdvertisementTimeoutMs) <= 0)
+        {
+            lost = sent - answered;
+            continue;
+        }
+
+        while (!isEmpty)
+        {
+            const uint8_t *message = ReceiveIcmp6(fd, ND_NEIGHBOR_ADVERT, buffer, sizeof(buffer), isEmpty);
+
+            if (message != nullptr &&
+                memcmp(&reinterpret_cast<const nd_neighbor_advert *>(message)->nd_na_target,
+                       &frame.mSolicit.nd_ns_target, sizeof(in6_addr)) == 0)
+            {
+                answered++;
+            }
+        }
+    }
+
+    aSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    close(fd);
+
+    return answered;
+}
+
+int RunBenchmark(void)
+{
+    otbr::Utils::RouteNetlink routeNetlink;
+    size_t                    answered[2];
+    double                    seconds[2];
+
+    if (unshare(CLONE_NEWNET) != 0 || !WriteSysctl("conf/default/accept_dad", "0") ||
+        system(kSetUpNetworkCommand) != 0 || !WriteSysctl("conf/all/forwarding", "1"))
+    {
+        printf("Failed to set up the network namespace\n");
+        return 1;
+    }
+
+    {
+        int               packetFd = OpenPacketSocket(kBackboneIf);
+        std::atomic<bool> isRunning(true);
+        std::thread       proxy(RunUserSpaceProxy, packetFd, std::cref(isRunning));
+
+        answered[0] = SolicitDua(seconds[0]);
+        isRunning   = false;
+        proxy.join();
+        close(packetFd);
+    }
+
+    routeNetlink.AddNeighborProxy(otbr::Ip6Address(kDua), if_nametoindex(kBackboneIf));
+
+    if (routeNetlink.Open() != OTBR_ERROR_NONE || routeNetlink.Commit() != OTBR_ERROR_NONE ||
+        !WriteSysctl("conf/all/proxy_ndp", "1") || !WriteSysctl("conf/ndp0/proxy_ndp", "1"))
+    {
+        printf("Failed to enable kernel ND proxy\n");
+        return 1;
+    }
+
+    answered[1] = SolicitDua(seconds[1]);
+
+    printf("%zu unicast NS, answered NS per second: user space %.0f (%zu answered), kernel proxy %.0f (%zu answered)\n",
+           kNumSolicitations, answered[0] / seconds[0], answered[0], answered[1] / seconds[1], answered[1]);
+
+    return (answered[0] > 0 && answered[1] > 0) ? 0 : 1;
+}
+
+// Opens a raw ICMPv6 socket on the Backbone interface which receives the
+// solicitations sent to the solicited-node group of the DUA, like the one of
+// the ND Proxy manager.
+int OpenIcmp6Socket(void)
+{
+    int          fd = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+    icmp6_filter filter;
+    ipv6_mreq    mreq;
+
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(ND_NEIGHBOR_SOLICIT, &filter);
+    mreq.ipv6mr_interface = if_nametoindex(kBackboneIf);
+    inet_pton(AF_INET6, kSolicitedNodeAddr, &mreq.ipv6mr_multiaddr);
+
+    if (fd >= 0 && (setsockopt(fd, SOL_SOCKET, SO_BINDTODEVICE, kBackboneIf, strlen(kBackboneIf)) != 0 ||
+                    setsockopt(fd, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) != 0 ||
+                    setsockopt(fd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) != 0))
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+struct ReceiveCounters
+{
+    size_t mNumPackets;
+    size_t mNumSolicitationsForDua;
+    size_t mNumCalls;
+    double mSeconds;
+};
+
+// Receives the packets queued to the socket, one per `recvmsg()` if
+// `aBatchSize` is 1 and in batches of `recvmmsg()` otherwise.
+void ReceiveQueuedPackets(int aFd, size_t aBatchSize, ReceiveCounters &aCounters)
+{
+    uint8_t  packets[kReceiveBatchSize][1500];
+    iovec    iovecs[kReceiveBatchSize];
+    mmsghdr  messages[kReceiveBatchSize];
+    in6_addr dua;
+    int      count;
+    auto     start = std::chrono::steady_clock::now();
+
+    inet_pton(AF_INET6, kDua, &dua);
+    memset(messages, 0, sizeof(messages));
+
+    for (size_t i = 0; i < kReceiveBatchSize; i++)
+    {
+        iovecs[i].iov_base             = packets[i];
+        iovecs[i].iov_len              = sizeof(packets[i]);
+        messages[i].msg_hdr.msg_iov    = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    do
+    {
+        if (aBatchSize == 1)
+        {
+            ssize_t len = recvmsg(aFd, &messages[0].msg_hdr, MSG_DONTWAIT);
+
+            count               = (len >= 0) ? 1 : -1;
+            messages[0].msg_len = static_cast<unsigned int>(len);
+        }
+        else
+        {
+            count = recvmmsg(aFd, messages, static_cast<unsigned int>(aBatchSize), MSG_DONTWAIT, nullptr);
+        }
+
+        aCounters.mNumCalls++;
+
+        for (int i = 0; i < count; i++)
+        {
+            const nd_neighbor_solicit &ns = *reinterpret_cast<const nd_neighbor_solicit *>(packets[i]);
+
+            aCounters.mNumPackets++;
+
+            if (messages[i].msg_len >= sizeof(ns) && memcmp(&ns.nd_ns_target, &dua, sizeof(dua)) == 0)
+            {
+                aCounters.mNumSolicitationsForDua++;
+            }
+        }
+    } while (count > 0);
+
+    aCounters.mSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Sends multicast solicitations to the solicited-node group of the DUA, one in
+// four of them for the DUA and the others for addresses out of the Domain
+// Prefix in the same group, and receives them on a socket without a filter and
+// on one with the filter of the ND Proxy manager.
+int RunMulticastFilterBenchmark(void)
+{
+    const char *targets[] = {kDua, "fe80::1234", "2001:db8::1234", "fd00:7d03:7d03:7d04::1234"};
+
+    NeighborSolicitationFrame frames[sizeof(targets) / sizeof(targets[0])];
+    ReceiveCounters           counters[2];
+    int                       packetFd;
+    int                       fds[2];
+    size_t                    sent = 0;
+
+    if (unshare(CLONE_NEWNET) != 0 || !WriteSysctl("conf/default/accept_dad", "0") || system(kSetUpNetworkCommand) != 0)
+    {
+        printf("Failed to set up the network namespace\n");
+        return 1;
+    }
+
+    packetFd = OpenPacketSocket(kHostIf);
+    fds[0]   = OpenIcmp6Socket();
+    fds[1]   = OpenIcmp6Socket();
+
+    if (packetFd < 0 || fds[0] < 0 || fds[1] < 0 ||
+        otbr::BackboneRouter::NdProxyFilter(otbr::Ip6Prefix(kDomainPrefix, 64)).Attach(fds[1]) != OTBR_ERROR_NONE)
+    {
+        printf("Failed to open the sockets\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++)
+    {
+        InitSolicitationFrame(frames[i], kSolicitedNodeMacAddr, kSolicitedNodeAddr, targets[i]);
+    }
+
+    memset(counters, 0, sizeof(counters));
+
+    while (sent < kNumMulticastSolicitations)
+    {
+        for (size_t i = 0; i < kMulticastBurstSize; i++, sent++)
+        {
+            const NeighborSolicitationFrame &frame = frames[sent % (sizeof(frames) / sizeof(frames[0]))];
+
+            if (send(packetFd, &frame, sizeof(frame), 0) != static_cast<ssize_t>(sizeof(frame)))
+            {
+                printf("Failed to send: %s\n", strerror(errno));
+                return 1;
+            }
+        }
+
+        ReceiveQueuedPackets(fds[0], 1, counters[0]);
+        ReceiveQueuedPackets(fds[1], kReceiveBatchSize, counters[1]);
+    }
+
+    // Pick up the solicitations which were still on their way.
+    for (size_t i = 0; i < 2; i++)
+    {
+        pollfd pfd = {fds[i], POLLIN, 0};
+
+        while (poll(&pfd, 1, kAdvertisementTimeoutMs) > 0)
+        {
+            ReceiveQueuedPackets(fds[i], (i == 0) ? 1 : kReceiveBatchSize, counters[i]);
+        }
+
+        close(fds[i]);
+    }
+
+    close(packetFd);
+
+    printf("%zu multicast NS, 1 in 4 for the DUA: without filter received %zu NS in %zu recvmsg() calls (%.1f ms), "
+           "with filter received %zu NS in %zu recvmmsg() calls (%.1f ms)\n",
+           sent, counters[0].mNumPackets, counters[0].mNumCalls, counters[0].mSeconds * 1000, counters[1].mNumPackets,
+           counters[1].mNumCalls, counters[1].mSeconds * 1000);
+
+    return (counters[0].mNumSolicitationsForDua > 0 && counters[0].mNumPackets > counters[1].mNumPackets &&
+            counters[1].mNumPackets == counters[1].mNumSolicitationsForDua &&
+            counters[1].mNumSolicitationsForDua == counters[0].mNumSolicitationsForDua)
+               ? 0
+               : 1;
+}
+
+// The network is set up in a namespace of its own, so the functions are run
+// in a child process and the namespace goes away with it.
+void ExpectSuccessInChildProcess(int (*aFunction)(void))
+{
+    pid_t pid;
+    int   status;
+
+    fflush(stdout);
+    ASSERT_GE(pid = fork(), 0);
+
+    if (pid == 0)
+    {
+        status = aFunction();
+        fflush(stdout);
+        _exit(status);
+    }
+
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+} // namespace
+
+TEST(NdProxy, DISABLED_BenchmarkNeighborSolicitationAnswers)
+{
+    ExpectSuccessInChildProcess(RunBenchmark);
+}
+
+TEST(NdProxy, DISABLED_BenchmarkMulticastSolicitationFilter)
+{
+    ExpectSuccessInChildProcess(RunMulticastFilterBenchmark);
+}
+
+#if OTBR_ENABLE_DUA_ROUTING
+
+namespace {
+
+char ReadSysctl(const char *aName)
+{
+    std::string path  = std::string("/proc/sys/net/ipv6/") + aName;
+    int         fd    = open(path.c_str(), O_RDONLY);
+    char        value = '\0';
+
+    if (fd >= 0)
+    {
+        if (read(fd, &value, sizeof(value)) != sizeof(value))
+        {
+            value = '\0';
+        }
+
+        close(fd);
+    }
+
+    return value;
+}
+
+// Receives the solicited advertisements for the DUA which were sent to the
+// host, or the unsolicited ones sent to all nodes, checking their contents.
+size_t ReceiveAdvertisements(int aFd, bool aSolicited)
+{
+    uint8_t  buffer[1500];
+    in6_addr dua;
+    in6_addr dst;
+    size_t   count   = 0;
+    bool     isEmpty = false;
+
+    inet_pton(AF_INET6, kDua, &dua);
+    inet_pton(AF_INET6, aSolicited ? kHostAddr : "ff02::1", &dst);
+
+    while (!isEmpty)
+    {
+        const uint8_t *message = ReceiveIcmp6(aFd, ND_NEIGHBOR_ADVERT, buffer, sizeof(buffer), isEmpty);
+        const ip6_hdr &ip6     = *reinterpret_cast<const ip6_hdr *>(buffer + sizeof(ether_header));
+
+        if (message == nullptr)
+        {
+            continue;
+        }
+
+        const nd_neighbor_advert &na  = *reinterpret_cast<const nd_neighbor_advert *>(message);
+        const nd_opt_hdr         &opt = *reinterpret_cast<const nd_opt_hdr *>(message + sizeof(na));
+
+        // The host and the Backbone interface resolve each other too.
+        if (((na.nd_na_flags_reserved & ND_NA_FLAG_SOLICITED) != 0) != aSolicited ||
+            memcmp(&na.nd_na_target, &dua, sizeof(dua)) != 0)
+        {
+            continue;
+        }
+
+        EXPECT_EQ(memcmp(&ip6.ip6_dst, &dst, sizeof(dst)), 0);
+        EXPECT_TRUE(na.nd_na_flags_reserved & ND_NA_FLAG_ROUTER);
+        EXPECT_EQ(opt.nd_opt_type, ND_OPT_TARGET_LINKADDR);
+        EXPECT_EQ(memcmp(&opt + 1, kBackboneMacAddr, ETH_ALEN), 0);
+        count++;
+    }
+
+    return count;
+}
+
+// Indicates whether the kernel has a proxy neighbor entry for the DUA.
+bool HasNeighborProxy(void)
+{
+    char  line[256];
+    bool  found = false;
+    FILE *ip    = popen("ip -6 neigh show proxy dev ndp0", "r");
+
+    if (ip == nullptr)
+    {
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), ip) != nullptr)
+    {
+        found = found || strncmp(line, kDua, strlen(kDua)) == 0;
+    }
+
+    pclose(ip);
+
+    return found;
+}
+
+// Indicates whether unicast solicitations for the Domain Prefix are steered
+// to NFQUEUE.
+bool HasNetfilterQueueRule(void)
+{
+    return system("ip6tables -t raw -C PREROUTING -6 -d fd00:7d03:7d03:7d03::/64 -p icmpv6 --icmpv6-type "
+                  "neighbor-solicitation -i ndp0 -j NFQUEUE --queue-num 88 2>/dev/null") == 0;
+}
+
+// Runs the ND Proxy manager in a network namespace of its own, which is left
+// again when the test ends.
+class NdProxyManagerTest : public testing::Test, public otbr::BackboneRouter::NdProxyManager::Dependencies
+{
+protected:
+    NdProxyManagerTest(void)
+        : mManager(*this, kBackboneIf)
+        , mNetNsFd(-1)
+    {
+        inet_pton(AF_INET6, kDua, mDua.mFields.m8);
+    }
+
+    // OpenThread isn't running in these tests, the DUA is the only one in its
+    // ND Proxy table.
+    otbrError GetNdProxyInfo(const otbr::Ip6Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo) override
+    {
+        memset(&aNdProxyInfo, 0, sizeof(aNdProxyInfo));
+
+        return aDua == otbr::Ip6Address(kDua) ? OTBR_ERROR_NONE : OTBR_ERROR_NOT_FOUND;
+    }
+
+    void SetUp(void) override
+    {
+        int netNsFd = open("/proc/self/ns/net", O_RDONLY | O_CLOEXEC);
+
+        if (netNsFd < 0 || unshare(CLONE_NEWNET) != 0)
+        {
+            if (netNsFd >= 0)
+            {
+                close(netNsFd);
+            }
+
+            GTEST_SKIP() << "Creating a network namespace requires root";
+        }
+
+        mNetNsFd = netNsFd;
+
+        ASSERT_TRUE(WriteSysctl("conf/default/accept_dad", "0"));
+        ASSERT_EQ(system(kSetUpNetworkCommand), 0);
+
+        mManager.Init();
+    }
+
+    void TearDown(void) override
+    {
+        mManager.Disable();
+
+        if (mNetNsFd >= 0)
+        {
+            EXPECT_EQ(setns(mNetNsFd, CLONE_NEWNET), 0);
+            close(mNetNsFd);
+        }
+    }
+
+    // Runs the mainloop of the manager for `aTimeoutMs` milliseconds.
+    void RunMainloop(int aTimeoutMs)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(aTimeoutMs);
+
+        do
+        {
+            otbr::MainloopContext mainloop;
+            auto                  remaining = deadline - std::chrono::steady_clock::now();
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = otbr::ToTimeval(std::max(
+                std::chrono::duration_cast<otbr::Microseconds>(remaining), otbr::Microseconds::zero()));
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            mManager.Update(mainloop);
+            ASSERT_GE(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                             &mainloop.mTimeout),
+                      0);
+            mManager.Process(mainloop);
+        } while (std::chrono::steady_clock::now() < deadline);
+    }
+
+    // Sends a unicast solicitation for the DUA from the host and returns the
+    // number of solicited advertisements received while the manager runs.
+    size_t SolicitDua(int aFd)
+    {
+        NeighborSolicitationFrame frame;
+
+        InitSolicitationFrame(frame, kBackboneMacAddr, kDua, kDua);
+        EXPECT_EQ(send(aFd, &frame, sizeof(frame), 0), static_cast<ssize_t>(sizeof(frame)));
+        RunMainloop(kAdvertisementTimeoutMs);
+
+        return ReceiveAdvertisements(aFd, /* aSolicited */ true);
+    }
+
+    otbr::BackboneRouter::NdProxyManager mManager;
+    otIp6Address                         mDua;
+    int                                  mNetNsFd;
+};
+
+} // namespace
+
+TEST_F(NdProxyManagerTest, AnswersMulticastSolicitationsInBatches)
+{
+    // One in four solicitations is answered, the others have a bad hop limit,
+    // or their targets aren't proxied or are out of the Domain Prefix.
+    const char *targets[]   = {kDua, kDua, "fd00:7d03:7d03:7d03:1::1234", "fd00:7d03:7d03:7d04::1234"};
+    const int   hopLimits[] = {255, 254, 255, 255};
+
+    NeighborSolicitationFrame frames[sizeof(targets) / sizeof(targets[0])];
+    int                       packetFd = OpenPacketSocket(kHostIf);
+    size_t                    numSent  = 0;
+
+    ASSERT_GE(packetFd, 0);
+    ASSERT_TRUE(WriteSysctl("conf/all/forwarding", "1"));
+    // Keep the kernel from answering the solicitations for the proxy entry
+    // of the DUA while the test runs.
+    ASSERT_TRUE(WriteSysctl("neigh/ndp0/proxy_delay", "1000000"));
+
+    mManager.Enable(otbr::Ip6Prefix(kDomainPrefix, 64));
+    ASSERT_TRUE(mManager.IsEnabled());
+
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &mDua);
+    RunMainloop(0);
+
+    for (size_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++)
+    {
+        InitSolicitationFrame(frames[i], kSolicitedNodeMacAddr, kSolicitedNodeAddr, targets[i]);
+        frames[i].mIp6.ip6_hlim = static_cast<uint8_t>(hopLimits[i]);
+    }
+
+    // More solicitations than received by one `recvmmsg()` are queued before
+    // the manager runs.
+    for (; numSent < 8 * kReceiveBatchSize; numSent++)
+    {
+        const NeighborSolicitationFrame &frame = frames[numSent % (sizeof(frames) / sizeof(frames[0]))];
+
+        ASSERT_EQ(send(packetFd, &frame, sizeof(frame), 0), static_cast<ssize_t>(sizeof(frame)));
+    }
+
+    RunMainloop(kAdvertisementTimeoutMs);
+
+    EXPECT_EQ(ReceiveAdvertisements(packetFd, /* aSolicited */ true), numSent / 4);
+
+    close(packetFd);
+}
+
+TEST_F(NdProxyManagerTest, LetsKernelAnswerWhenForwarding)
+{
+    int packetFd = OpenPacketSocket(kHostIf);
+
+    ASSERT_GE(packetFd, 0);
+    ASSERT_TRUE(WriteSysctl("conf/all/forwarding", "1"));
+    // Settings which differ are restored to what they were, not to a default.
+    ASSERT_TRUE(WriteSysctl("conf/all/proxy_ndp", "1"));
+    ASSERT_TRUE(WriteSysctl("conf/ndp0/proxy_ndp", "0"));
+
+    mManager.Enable(otbr::Ip6Prefix(kDomainPrefix, 64));
+    ASSERT_TRUE(mManager.IsEnabled());
+    EXPECT_TRUE(mManager.IsKernelProxyEnabled());
+    EXPECT_EQ(ReadSysctl("conf/all/proxy_ndp"), '1');
+    EXPECT_EQ(ReadSysctl("conf/ndp0/proxy_ndp"), '1');
+    EXPECT_FALSE(HasNetfilterQueueRule());
+
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &mDua);
+    RunMainloop(0);
+    EXPECT_TRUE(HasNeighborProxy());
+    EXPECT_EQ(SolicitDua(packetFd), 1u);
+
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_REMOVED, &mDua);
+    RunMainloop(0);
+    EXPECT_FALSE(HasNeighborProxy());
+    EXPECT_EQ(SolicitDua(packetFd), 0u);
+
+    // The proxy entries are removed along with the kernel proxy.
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &mDua);
+    RunMainloop(0);
+    mManager.Disable();
+    EXPECT_FALSE(mManager.IsEnabled());
+    EXPECT_FALSE(HasNeighborProxy());
+    EXPECT_EQ(ReadSysctl("conf/all/proxy_ndp"), '1');
+    EXPECT_EQ(ReadSysctl("conf/ndp0/proxy_ndp"), '0');
+
+    close(packetFd);
+}
+
+TEST_F(NdProxyManagerTest, AdvertisesOnlyDuasRegisteredWhileEnabled)
+{
+    int packetFd = OpenPacketSocket(kHostIf);
+
+    ASSERT_GE(packetFd, 0);
+    ASSERT_TRUE(WriteSysctl("conf/all/forwarding", "1"));
+
+    // Registrations seen while disabled are tracked but not queued for an
+    // unsolicited advertisement.
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &mDua);
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_RENEWED, &mDua);
+    mManager.Enable(otbr::Ip6Prefix(kDomainPrefix, 64));
+    ASSERT_TRUE(mManager.IsEnabled());
+    RunMainloop(kAdvertisementTimeoutMs);
+    EXPECT_TRUE(HasNeighborProxy());
+    EXPECT_EQ(ReceiveAdvertisements(packetFd, /* aSolicited */ false), 0u);
+
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_RENEWED, &mDua);
+    RunMainloop(kAdvertisementTimeoutMs);
+    EXPECT_EQ(ReceiveAdvertisements(packetFd, /* aSolicited */ false), 1u);
+
+    close(packetFd);
+}
+
+TEST_F(NdProxyManagerTest, FallsBackToNetfilterQueueWithoutForwarding)
+{
+    int packetFd = OpenPacketSocket(kHostIf);
+
+    ASSERT_GE(packetFd, 0);
+    ASSERT_TRUE(WriteSysctl("conf/all/forwarding", "0"));
+    ASSERT_TRUE(WriteSysctl("conf/all/proxy_ndp", "0"));
+    ASSERT_TRUE(WriteSysctl("conf/ndp0/proxy_ndp", "0"));
+
+    mManager.Enable(otbr::Ip6Prefix(kDomainPrefix, 64));
+
+    // The kernel proxy is left alone even when the fallback fails.
+    EXPECT_FALSE(mManager.IsKernelProxyEnabled());
+    EXPECT_EQ(ReadSysctl("conf/all/proxy_ndp"), '0');
+    EXPECT_EQ(ReadSysctl("conf/ndp0/proxy_ndp"), '0');
+
+    if (!mManager.IsEnabled())
+    {
+        close(packetFd);
+        GTEST_SKIP() << "NFQUEUE is unavailable";
+    }
+
+    EXPECT_TRUE(HasNetfilterQueueRule());
+
+    mManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &mDua);
+    RunMainloop(0);
+    EXPECT_FALSE(HasNeighborProxy());
+    EXPECT_EQ(SolicitDua(packetFd), 1u);
+
+    mManager.Disable();
+    EXPECT_FALSE(mManager.IsEnabled());
+    EXPECT_FALSE(HasNetfilterQueueRule());
+
+    close(packetFd);
+}
+
+#endif // OTBR_ENABLE_DUA_ROUTING
+
+#endif // __linux__
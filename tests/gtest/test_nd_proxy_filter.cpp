@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+
+#include <arpa/inet.h>
+#include <netinet/icmp6.h>
+#include <string.h>
+#include <vector>
+
+#include "backbone_router/nd_proxy_filter.hpp"
+#include "common/types.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::BackboneRouter::NdProxyFilter;
+
+namespace {
+
+constexpr char kPrefixAddress[] = "fd00:7d03:7d03:7d03:1122:3344:5566:7788";
+
+// Runs the program on a packet the way the kernel does, for the instructions
+// which `NdProxyFilter` generates. Returns the number of bytes to keep.
+uint32_t RunProgram(const std::vector<sock_filter> &aProgram, const uint8_t *aPacket, size_t aLength)
+{
+    uint32_t accumulator = 0;
+
+    for (size_t pc = 0; pc < aProgram.size(); pc++)
+    {
+        const sock_filter &insn = aProgram[pc];
+
+        switch (insn.code)
+        {
+        case BPF_LD | BPF_B | BPF_ABS:
+            if (insn.k + 1 > aLength)
+            {
+                return 0;
+            }
+            accumulator = aPacket[insn.k];
+            break;
+
+        case BPF_LD | BPF_W | BPF_ABS:
+            if (insn.k + 4 > aLength)
+            {
+                return 0;
+            }
+            accumulator = (static_cast<uint32_t>(aPacket[insn.k]) << 24) |
+                          (static_cast<uint32_t>(aPacket[insn.k + 1]) << 16) |
+                          (static_cast<uint32_t>(aPacket[insn.k + 2]) << 8) | aPacket[insn.k + 3];
+            break;
+
+        case BPF_ALU | BPF_AND | BPF_K:
+            accumulator &= insn.k;
+            break;
+
+        case BPF_JMP | BPF_JEQ | BPF_K:
+            pc += (accumulator == insn.k) ? insn.jt : insn.jf;
+            break;
+
+        case BPF_RET | BPF_K:
+            return insn.k;
+
+        default:
+            ADD_FAILURE() << "Unexpected instruction 0x" << std::hex << insn.code;
+            return 0;
+        }
+    }
+
+    ADD_FAILURE() << "The program doesn't return";
+    return 0;
+}
+
+bool Passes(const NdProxyFilter &aFilter, uint8_t aType, const Ip6Address &aTarget)
+{
+    nd_neighbor_solicit ns;
+
+    memset(&ns, 0, sizeof(ns));
+    ns.nd_ns_type = aType;
+    memcpy(&ns.nd_ns_target, aTarget.m8, sizeof(ns.nd_ns_target));
+
+    return RunProgram(aFilter.GetProgram(), reinterpret_cast<const uint8_t *>(&ns), sizeof(ns)) != 0;
+}
+
+Ip6Address FlipBit(const Ip6Address &aAddress, uint8_t aBit)
+{
+    Ip6Address address = aAddress;
+
+    address.m8[aBit / 8] ^= static_cast<uint8_t>(0x80 >> (aBit % 8));
+
+    return address;
+}
+
+} // namespace
+
+TEST(NdProxyFilter, PassesSolicitationsForTargetsInPrefix)
+{
+    const uint8_t kLengths[] = {1, 7, 16, 31, 32, 33, 48, 56, 63, 64, 65, 96, 100, 127, 128};
+
+    for (uint8_t length : kLengths)
+    {
+        NdProxyFilter filter(Ip6Prefix(kPrefixAddress, length));
+        Ip6Address    target(kPrefixAddress);
+
+        SCOPED_TRACE(testing::Message() << "prefix length " << static_cast<int>(length));
+
+        EXPECT_TRUE(Passes(filter, ND_NEIGHBOR_SOLICIT, target));
+        EXPECT_FALSE(Passes(filter, ND_NEIGHBOR_ADVERT, target));
+
+        // Every bit of the prefix is checked, from the first to the last one.
+        EXPECT_FALSE(Passes(filter, ND_NEIGHBOR_SOLICIT, FlipBit(target, 0)));
+        EXPECT_FALSE(Passes(filter, ND_NEIGHBOR_SOLICIT, FlipBit(target, length - 1)));
+
+        // The bits which follow the prefix are not.
+        if (length < 128)
+        {
+            EXPECT_TRUE(Passes(filter, ND_NEIGHBOR_SOLICIT, FlipBit(target, length)));
+            EXPECT_TRUE(Passes(filter, ND_NEIGHBOR_SOLICIT, FlipBit(target, 127)));
+        }
+    }
+}
+
+TEST(NdProxyFilter, DropsTruncatedSolicitations)
+{
+    NdProxyFilter       filter(Ip6Prefix(kPrefixAddress, 60));
+    nd_neighbor_solicit ns;
+
+    memset(&ns, 0, sizeof(ns));
+    ns.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+    inet_pton(AF_INET6, kPrefixAddress, &ns.nd_ns_target);
+
+    EXPECT_NE(RunProgram(filter.GetProgram(), reinterpret_cast<const uint8_t *>(&ns), sizeof(ns)), 0u);
+    EXPECT_EQ(RunProgram(filter.GetProgram(), reinterpret_cast<const uint8_t *>(&ns), sizeof(ns) - 9), 0u);
+}
+
+#endif // __linux__
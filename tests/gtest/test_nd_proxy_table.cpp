@@ -0,0 +1,286 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <set>
+#include <stdio.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "backbone_router/nd_proxy_table.hpp"
+
+using otbr::Ip6Address;
+using otbr::BackboneRouter::NdProxyTable;
+
+namespace {
+
+// Returns DUAs of a Domain where every `aDuasPerGroup` consecutive DUAs
+// share the last 24 bits and hence the solicited-node multicast group.
+std::vector<Ip6Address> MakeDuas(size_t aNumDuas, size_t aDuasPerGroup)
+{
+    std::vector<Ip6Address> duas;
+
+    for (size_t i = 0; i < aNumDuas; i++)
+    {
+        Ip6Address dua("fd00:7d03:7d03:7d03::");
+        size_t     group = i / aDuasPerGroup;
+
+        dua.m8[8]  = static_cast<uint8_t>(i % aDuasPerGroup);
+        dua.m8[11] = static_cast<uint8_t>(i * 37);
+        dua.m8[13] = static_cast<uint8_t>(group >> 16);
+        dua.m8[14] = static_cast<uint8_t>(group >> 8);
+        dua.m8[15] = static_cast<uint8_t>(group);
+        duas.push_back(dua);
+    }
+
+    return duas;
+}
+
+struct GroupSync
+{
+    void Sync(NdProxyTable &aTable)
+    {
+        aTable.SyncGroups(
+            [this](const Ip6Address &aGroup) {
+                EXPECT_TRUE(mJoined.insert(aGroup).second);
+                return true;
+            },
+            [this](const Ip6Address &aGroup) {
+                EXPECT_EQ(mJoined.erase(aGroup), 1u);
+                return true;
+            });
+    }
+
+    std::set<Ip6Address> mJoined;
+};
+
+} // namespace
+
+TEST(NdProxyTable, AddRemoveAndSyncGroups)
+{
+    NdProxyTable            table;
+    GroupSync               sync;
+    std::vector<Ip6Address> duas = MakeDuas(300, 3);
+
+    for (const Ip6Address &dua : duas)
+    {
+        EXPECT_TRUE(table.Add(dua));
+        EXPECT_FALSE(table.Add(dua));
+    }
+    EXPECT_EQ(table.size(), 300u);
+    EXPECT_EQ(table.GetGroupCount(), 100u);
+    EXPECT_TRUE(table.HasGroupChanges());
+
+    sync.Sync(table);
+    EXPECT_FALSE(table.HasGroupChanges());
+    EXPECT_EQ(sync.mJoined.size(), 100u);
+
+    for (const Ip6Address &dua : duas)
+    {
+        EXPECT_TRUE(table.Contains(dua));
+        EXPECT_TRUE(table.ContainsSolicitedNodeGroup(dua.ToSolicitedNodeMulticastAddress()));
+    }
+    EXPECT_FALSE(table.Contains(Ip6Address("fd00:7d03:7d03:7d03::1")));
+    EXPECT_FALSE(table.ContainsSolicitedNodeGroup(Ip6Address("ff02::1:ffff:ffff")));
+    EXPECT_FALSE(table.ContainsSolicitedNodeGroup(Ip6Address("ff05::1:ff00:0")));
+
+    // Removing two of the three DUAs of a group keeps the group.
+    for (size_t i = 0; i < duas.size(); i++)
+    {
+        if (i % 3 != 2)
+        {
+            EXPECT_TRUE(table.Remove(duas[i]));
+            EXPECT_FALSE(table.Remove(duas[i]));
+        }
+    }
+    EXPECT_EQ(table.size(), 100u);
+    EXPECT_FALSE(table.HasGroupChanges());
+
+    for (size_t i = 0; i < duas.size(); i++)
+    {
+        EXPECT_EQ(table.Contains(duas[i]), i % 3 == 2);
+    }
+
+    // A group which is left and joined again before syncing isn't touched.
+    EXPECT_TRUE(table.Remove(duas[2]));
+    EXPECT_TRUE(table.Add(duas[0]));
+    EXPECT_TRUE(table.Remove(duas[5]));
+    sync.Sync(table);
+    EXPECT_EQ(sync.mJoined.size(), 99u);
+    EXPECT_FALSE(table.ContainsSolicitedNodeGroup(duas[5].ToSolicitedNodeMulticastAddress()));
+
+    // Groups are joined again after they have been reset.
+    table.ResetGroups();
+    sync.mJoined.clear();
+    sync.Sync(table);
+    EXPECT_EQ(sync.mJoined.size(), 99u);
+
+    table.Clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.GetGroupCount(), 0u);
+    sync.Sync(table);
+    EXPECT_TRUE(sync.mJoined.empty());
+}
+
+TEST(NdProxyTable, FailedJoinsAndLeavesAreRetried)
+{
+    NdProxyTable            table;
+    std::vector<Ip6Address> duas      = MakeDuas(4, 2);
+    bool                    isFailing = true;
+    size_t                  numJoins  = 0;
+    size_t                  numLeaves = 0;
+
+    auto join = [&isFailing, &numJoins](const Ip6Address &) {
+        numJoins++;
+        return !isFailing;
+    };
+    auto leave = [&isFailing, &numLeaves](const Ip6Address &) {
+        numLeaves++;
+        return !isFailing;
+    };
+
+    for (const Ip6Address &dua : duas)
+    {
+        EXPECT_TRUE(table.Add(dua));
+    }
+
+    // The group of the first two DUAs is changed twice, it's only tried once.
+    EXPECT_TRUE(table.Remove(duas[0]));
+    EXPECT_TRUE(table.Remove(duas[1]));
+    EXPECT_TRUE(table.Add(duas[0]));
+
+    table.SyncGroups(join, leave);
+    EXPECT_EQ(numJoins, 2u);
+    EXPECT_TRUE(table.HasGroupChanges());
+
+    table.SyncGroups(join, leave);
+    EXPECT_EQ(numJoins, 4u);
+    EXPECT_TRUE(table.HasGroupChanges());
+
+    isFailing = false;
+    table.SyncGroups(join, leave);
+    EXPECT_EQ(numJoins, 6u);
+    EXPECT_FALSE(table.HasGroupChanges());
+
+    // A failed leave keeps the group until it's left.
+    isFailing = true;
+    EXPECT_TRUE(table.Remove(duas[2]));
+    EXPECT_TRUE(table.Remove(duas[3]));
+    table.SyncGroups(join, leave);
+    EXPECT_EQ(numLeaves, 1u);
+    EXPECT_TRUE(table.HasGroupChanges());
+
+    isFailing = false;
+    table.SyncGroups(join, leave);
+    EXPECT_EQ(numLeaves, 2u);
+    EXPECT_FALSE(table.HasGroupChanges());
+    EXPECT_EQ(numJoins, 6u);
+}
+
+// Simulates a Backbone Router which takes over 1000 DUAs sharing 250
+// solicited-node groups, then answers multicast solicitations and clears
+// the DUAs, comparing the table with the `std::set` and the per-DUA joins
+// and leaves which were used before.
+TEST(NdProxyTable, DISABLED_Benchmark1000Duas)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kNumDuas      = 1000;
+    static constexpr size_t kDuasPerGroup = 4;
+
+    std::vector<Ip6Address> duas = MakeDuas(kNumDuas, kDuasPerGroup);
+    NdProxyTable            table;
+    std::set<Ip6Address>    set;
+    size_t                  tableGroupOps = 0;
+    size_t                  setGroupOps   = 0;
+    size_t                  found         = 0;
+    Clock::time_point       start;
+    double                  tableUs[3];
+    double                  setUs[3];
+    auto                    countGroupOp = [&tableGroupOps](const Ip6Address &) { return ++tableGroupOps > 0; };
+
+    start = Clock::now();
+    for (const Ip6Address &dua : duas)
+    {
+        table.Add(dua);
+    }
+    table.SyncGroups(countGroupOp, countGroupOp);
+    tableUs[0] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    EXPECT_EQ(tableGroupOps, kNumDuas / kDuasPerGroup);
+
+    start = Clock::now();
+    for (const Ip6Address &dua : duas)
+    {
+        if (set.insert(dua).second)
+        {
+            setGroupOps++;
+        }
+    }
+    setUs[0] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (const Ip6Address &dua : duas)
+    {
+        found += table.ContainsSolicitedNodeGroup(dua.ToSolicitedNodeMulticastAddress());
+    }
+    tableUs[1] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (const Ip6Address &dua : duas)
+    {
+        Ip6Address group = dua.ToSolicitedNodeMulticastAddress();
+
+        for (const Ip6Address &proxied : set)
+        {
+            if (proxied.ToSolicitedNodeMulticastAddress() == group)
+            {
+                found++;
+                break;
+            }
+        }
+    }
+    setUs[1] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    EXPECT_EQ(found, 2 * kNumDuas);
+
+    start = Clock::now();
+    table.Clear();
+    table.SyncGroups(countGroupOp, countGroupOp);
+    tableUs[2] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    EXPECT_EQ(tableGroupOps, 2 * kNumDuas / kDuasPerGroup);
+
+    start = Clock::now();
+    setGroupOps += set.size();
+    set.clear();
+    setUs[2] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    printf("%zu DUAs in %zu groups, add/lookup/clear in us: NdProxyTable %.1f/%.1f/%.1f, std::set %.1f/%.1f/%.1f; "
+           "group joins and leaves: %zu vs %zu\n",
+           kNumDuas, kNumDuas / kDuasPerGroup, tableUs[0], tableUs[1], tableUs[2], setUs[0], setUs[1], setUs[2],
+           tableGroupOps, setGroupOps);
+}
@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include <arpa/inet.h>
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <ifaddrs.h>
@@ -46,6 +47,7 @@
 #include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <thread>
 #include <vector>
 
 #ifdef __linux__
@@ -57,6 +59,7 @@
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
+#include "lib/spinel/spinel.h"
 #include "ncp/posix/netif.hpp"
 #include "utils/socket_utils.hpp"
 
@@ -65,6 +68,17 @@
 
 static constexpr size_t kMaxIp6Size = 1280;
 
+// Udp Packet
+// Ip6 source: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a
+// Ip6 destination: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b
+// Udp destination port: 12345
+// Udp payload: "Hello Otbr Netif!"
+static const uint8_t kUdpPacket[] = {0x60, 0x0e, 0xea, 0x69, 0x00, 0x19, 0x11, 0x40, 0xfd, 0x2a, 0xc3, 0x0c, 0x87,
+                                     0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8a, 0xfd, 0x2a,
+                                     0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57,
+                                     0x8b, 0xe7, 0x08, 0x30, 0x39, 0x00, 0x19, 0x36, 0x81, 0x48, 0x65, 0x6c, 0x6c,
+                                     0x6f, 0x20, 0x4f, 0x74, 0x62, 0x72, 0x20, 0x4e, 0x65, 0x74, 0x69, 0x66, 0x21};
+
 std::vector<std::string> GetAllIp6Addrs(const char *aInterfaceName)
 {
     struct ifaddrs          *ifaddr, *ifa;
@@ -369,6 +383,65 @@ TEST(Netif, WpanIfHasCorrectUnicastAddresses_AfterUpdatingUnicastAddresses)
     netif.Deinit();
 }
 
+// Measures updates of a table with hundreds of addresses as seen on DUA and
+// SLAAC churn: adding all addresses, replacing half of them, an update
+// without changes and removing all addresses.
+TEST(Netif, DISABLED_BenchmarkUpdateIp6UnicastAddresses)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kNumAddresses = 500;
+
+    const char                       *wpan = "wpan0";
+    otbr::Netif                       netif(sDefaultNetifDependencies);
+    std::vector<otbr::Ip6AddressInfo> addrs;
+    std::vector<otbr::Ip6AddressInfo> churnedAddrs;
+    double                            ms[4];
+    Clock::time_point                 start;
+
+    EXPECT_EQ(netif.Init(wpan), OT_ERROR_NONE);
+
+    for (size_t i = 0; i < kNumAddresses + kNumAddresses / 2; i++)
+    {
+        otIp6Address address = {
+            {0xfd, 0x0d, 0x07, 0xfc, 0xa1, 0xb9, 0xf0, 0x50, 0, 0, 0, 0, 0, 0, static_cast<uint8_t>(i >> 8),
+             static_cast<uint8_t>(i)}};
+
+        if (i < kNumAddresses)
+        {
+            addrs.emplace_back(address, 64, 0, 1, 0);
+        }
+        if (i >= kNumAddresses / 2)
+        {
+            churnedAddrs.emplace_back(address, 64, 0, 1, 0);
+        }
+    }
+
+    start = Clock::now();
+    netif.UpdateIp6UnicastAddresses(addrs);
+    ms[0] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    EXPECT_EQ(GetAllIp6Addrs(wpan).size(), kNumAddresses);
+
+    start = Clock::now();
+    netif.UpdateIp6UnicastAddresses(churnedAddrs);
+    ms[1] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    EXPECT_EQ(GetAllIp6Addrs(wpan).size(), kNumAddresses);
+
+    start = Clock::now();
+    netif.UpdateIp6UnicastAddresses(churnedAddrs);
+    ms[2] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    netif.UpdateIp6UnicastAddresses({});
+    ms[3] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    EXPECT_EQ(GetAllIp6Addrs(wpan).size(), 0u);
+
+    printf("%zu addresses, add/churn/unchanged/remove in ms: %.2f/%.2f/%.3f/%.2f\n", kNumAddresses, ms[0], ms[1],
+           ms[2], ms[3]);
+
+    netif.Deinit();
+}
+
 TEST(Netif, WpanIfHasCorrectMulticastAddresses_AfterUpdatingMulticastAddresses)
 {
     const char *wpan = "wpan0";
@@ -501,17 +574,7 @@ TEST(Netif, WpanIfRecvIp6PacketCorrectly_AfterReceivingFromNetif)
         exit(EXIT_FAILURE);
     }
 
-    // Udp Packet
-    // Ip6 source: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a
-    // Ip6 destination: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b
-    // Udp destination port: 12345
-    // Udp payload: "Hello Otbr Netif!"
-    const uint8_t udpPacket[] = {0x60, 0x0e, 0xea, 0x69, 0x00, 0x19, 0x11, 0x40, 0xfd, 0x2a, 0xc3, 0x0c, 0x87,
-                                 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8a, 0xfd, 0x2a,
-                                 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57,
-                                 0x8b, 0xe7, 0x08, 0x30, 0x39, 0x00, 0x19, 0x36, 0x81, 0x48, 0x65, 0x6c, 0x6c,
-                                 0x6f, 0x20, 0x4f, 0x74, 0x62, 0x72, 0x20, 0x4e, 0x65, 0x74, 0x69, 0x66, 0x21};
-    netif.Ip6Receive(udpPacket, sizeof(udpPacket));
+    netif.Ip6Receive(kUdpPacket, sizeof(kUdpPacket));
 
     socklen_t   len = sizeof(listenAddr);
     int         n   = recvfrom(sockFd, (char *)recvBuf, kMaxIp6Size, MSG_WAITALL, (struct sockaddr *)&listenAddr, &len);
@@ -619,6 +682,216 @@ TEST(Netif, WpanIfSendIp6PacketCorrectly_AfterReceivingOnIf)
     netif.Deinit();
 }
 
+class NetifDependencyTestIp6SendCount : public otbr::Netif::Dependencies
+{
+public:
+    otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override
+    {
+        const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(aData);
+
+        OTBR_UNUSED_VARIABLE(aLength);
+
+        if (ipv6_header->ip6_nxt == IPPROTO_UDP)
+        {
+            mUdpPackets++;
+        }
+
+        return OTBR_ERROR_NONE;
+    }
+
+    size_t mUdpPackets = 0;
+};
+
+// Measures how many packets per second go from the Linux host through the
+// TUN device into `Netif::Dependencies::Ip6Send`. The packets are sent in
+// bursts which fit in the TUN queue, as a host application would.
+TEST(Netif, DISABLED_BenchmarkIp6SendThroughput)
+{
+    static constexpr size_t kNumPackets = 20000;
+    static constexpr size_t kBurstSize  = 200;
+
+    NetifDependencyTestIp6SendCount netifDependency;
+    otbr::Netif                     netif(netifDependency);
+    const char                      payload[64]   = "Hello Otbr Netif!";
+    size_t                          numIterations = 0;
+    int                             sockFd;
+    struct sockaddr_in6             destAddr;
+
+    EXPECT_EQ(netif.Init("wpan0"), OT_ERROR_NONE);
+
+    // OMR Prefix: fd76:a5d1:fcb0:1707::/64
+    const otIp6Address kOmr = {
+        {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM, 0), 0);
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin6_family = AF_INET6;
+    destAddr.sin6_port   = htons(12345);
+    inet_pton(AF_INET6, "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f", &destAddr.sin6_addr);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t sent = 0; sent < kNumPackets; sent += kBurstSize)
+    {
+        for (size_t i = 0; i < kBurstSize; i++)
+        {
+            ASSERT_EQ(sendto(sockFd, payload, sizeof(payload), 0, reinterpret_cast<struct sockaddr *>(&destAddr),
+                             sizeof(destAddr)),
+                      static_cast<ssize_t>(sizeof(payload)));
+        }
+
+        while (netifDependency.mUdpPackets < sent + kBurstSize)
+        {
+            otbr::MainloopContext context;
+
+            context.mMaxFd   = -1;
+            context.mTimeout = {1, 0};
+            FD_ZERO(&context.mReadFdSet);
+            FD_ZERO(&context.mWriteFdSet);
+            FD_ZERO(&context.mErrorFdSet);
+
+            netif.UpdateFdSet(&context);
+            ASSERT_GT(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                             &context.mTimeout),
+                      0);
+            netif.Process(&context);
+            numIterations++;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(netifDependency.mUdpPackets, kNumPackets);
+    EXPECT_GE(netif.GetTunCounters().mSentPackets, kNumPackets);
+    EXPECT_EQ(netif.GetTunCounters().mSendDropped, 0u);
+
+    printf("%zu packets in %.3f s (%.0f packets/s), %zu mainloop iterations\n", kNumPackets, seconds,
+           kNumPackets / seconds, numIterations);
+
+    close(sockFd);
+    netif.Deinit();
+}
+
+// Measures how many packets per second go from the NCP through the TUN
+// device to a UDP socket on the host. A simulated NCP sends the packets as
+// STREAM_NET frames over a socketpair, which are decoded in place as
+// `NcpSpinel` does before they are passed to `Netif::Ip6Receive`.
+TEST(Netif, DISABLED_BenchmarkIp6ReceiveThroughput)
+{
+    static constexpr size_t kNumPackets = 20000;
+    static constexpr size_t kBatchSize  = 64;
+
+    otbr::Netif         netif(sDefaultNetifDependencies);
+    int                 spinelFds[2];
+    int                 sockFd;
+    int                 rcvBufSize  = 1 << 20;
+    size_t              numReceived = 0;
+    struct sockaddr_in6 listenAddr;
+    uint8_t             frame[kMaxIp6Size + 16];
+    uint8_t             recvBuf[kMaxIp6Size];
+
+    EXPECT_EQ(netif.Init("wpan0"), OTBR_ERROR_NONE);
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    ASSERT_GE(sockFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0), 0);
+    setsockopt(sockFd, SOL_SOCKET, SO_RCVBUF, &rcvBufSize, sizeof(rcvBufSize));
+    memset(&listenAddr, 0, sizeof(listenAddr));
+    listenAddr.sin6_family = AF_INET6;
+    listenAddr.sin6_port   = htons(12345);
+    inet_pton(AF_INET6, "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b", &listenAddr.sin6_addr);
+    ASSERT_EQ(bind(sockFd, reinterpret_cast<struct sockaddr *>(&listenAddr), sizeof(listenAddr)), 0);
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, spinelFds), 0);
+
+    std::thread ncp([&spinelFds]() {
+        uint8_t        ncpFrame[kMaxIp6Size + 16];
+        spinel_ssize_t len =
+            spinel_datatype_pack(ncpFrame, sizeof(ncpFrame), SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                 SPINEL_HEADER_FLAG, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_NET, kUdpPacket,
+                                 static_cast<uint32_t>(sizeof(kUdpPacket)));
+
+        for (size_t i = 0; i < kNumPackets; i++)
+        {
+            if (send(spinelFds[1], ncpFrame, static_cast<size_t>(len), 0) != len)
+            {
+                break;
+            }
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t handled = 0; handled < kNumPackets;)
+    {
+        for (size_t i = 0; i < kBatchSize && handled < kNumPackets; i++, handled++)
+        {
+            ssize_t        frameLen = recv(spinelFds[0], frame, sizeof(frame), 0);
+            uint8_t        header;
+            unsigned int   cmd;
+            unsigned int   key;
+            const uint8_t *value;
+            spinel_size_t  valueLen;
+            const uint8_t *packet;
+            unsigned int   packetLen;
+
+            ASSERT_GT(frameLen, 0);
+            ASSERT_GT(spinel_datatype_unpack(frame, static_cast<spinel_size_t>(frameLen), "CiiD", &header, &cmd, &key,
+                                             &value, &valueLen),
+                      0);
+            ASSERT_EQ(key, static_cast<unsigned int>(SPINEL_PROP_STREAM_NET));
+            ASSERT_GT(spinel_datatype_unpack(value, valueLen, SPINEL_DATATYPE_DATA_WLEN_S, &packet, &packetLen), 0);
+            netif.Ip6Receive(packet, static_cast<uint16_t>(packetLen));
+        }
+
+        while (recv(sockFd, recvBuf, sizeof(recvBuf), 0) > 0)
+        {
+            numReceived++;
+        }
+    }
+
+    for (int retry = 0; numReceived < kNumPackets && retry < 100; retry++)
+    {
+        fd_set readFdSet;
+        timeval timeout = {0, 10000};
+
+        FD_ZERO(&readFdSet);
+        FD_SET(sockFd, &readFdSet);
+        select(sockFd + 1, &readFdSet, nullptr, nullptr, &timeout);
+        while (recv(sockFd, recvBuf, sizeof(recvBuf), 0) > 0)
+        {
+            numReceived++;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ncp.join();
+
+    EXPECT_EQ(netif.GetTunCounters().mReceivedPackets, kNumPackets);
+    EXPECT_EQ(netif.GetTunCounters().mReceivedBytes, kNumPackets * sizeof(kUdpPacket));
+    EXPECT_EQ(netif.GetTunCounters().mWriteErrors, 0u);
+    EXPECT_EQ(numReceived, kNumPackets);
+
+    printf("%zu packets in %.3f s (%.0f packets/s)\n", kNumPackets, seconds, kNumPackets / seconds);
+
+    close(spinelFds[0]);
+    close(spinelFds[1]);
+    close(sockFd);
+    netif.Deinit();
+}
+
 class NetifDependencyTestMulSub : public otbr::Netif::Dependencies
 {
 public:
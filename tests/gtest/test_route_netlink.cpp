@@ -0,0 +1,209 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <net/if.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#include <linux/rtnetlink.h>
+
+#include "common/types.hpp"
+#include "utils/route_netlink.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::Utils::RouteNetlink;
+
+namespace {
+
+std::string RunCommand(const char *aCommand)
+{
+    std::string output;
+    char        buffer[256];
+    FILE       *file = popen(aCommand, "r");
+
+    while (file != nullptr && fgets(buffer, sizeof(buffer), file) != nullptr)
+    {
+        output += buffer;
+    }
+
+    if (file != nullptr)
+    {
+        pclose(file);
+    }
+
+    return output;
+}
+
+size_t CountLines(const std::string &aOutput)
+{
+    size_t count = 0;
+
+    for (char c : aOutput)
+    {
+        count += (c == '\n');
+    }
+
+    return count;
+}
+
+// Runs each test in a network namespace of its own with the veth pair
+// `rtnl0` and `rtnl1`, the namespace goes away at the end of the test.
+class RouteNetlinkTest : public testing::Test
+{
+protected:
+    void SetUp(void) override
+    {
+        ASSERT_GE(mNetns = open("/proc/thread-self/ns/net", O_RDONLY | O_CLOEXEC), 0);
+        ASSERT_EQ(unshare(CLONE_NEWNET), 0);
+        ASSERT_EQ(system("ip link add rtnl0 type veth peer name rtnl1 && ip link set rtnl0 up && "
+                         "ip link set rtnl1 up"),
+                  0);
+
+        mIfIndex0 = if_nametoindex("rtnl0");
+        mIfIndex1 = if_nametoindex("rtnl1");
+        ASSERT_EQ(mRouteNetlink.Open(), OTBR_ERROR_NONE);
+    }
+
+    void TearDown(void) override
+    {
+        mRouteNetlink.Close();
+        EXPECT_EQ(setns(mNetns, CLONE_NEWNET), 0);
+        close(mNetns);
+    }
+
+    int          mNetns = -1;
+    uint32_t     mIfIndex0;
+    uint32_t     mIfIndex1;
+    RouteNetlink mRouteNetlink;
+};
+
+} // namespace
+
+TEST_F(RouteNetlinkTest, AddAndDeleteRoutesRulesAndNeighborProxies)
+{
+    const Ip6Prefix  prefix("fd00:db8::", 64);
+    const Ip6Address dua("fd00:db8::1");
+
+    mRouteNetlink.AddRoute(prefix, mIfIndex0, RT_TABLE_MAIN, 1);
+    mRouteNetlink.AddRule("rtnl0", 88);
+    mRouteNetlink.AddRoute(prefix, mIfIndex1, 88, 0);
+    mRouteNetlink.AddNeighborProxy(dua, mIfIndex1);
+    EXPECT_EQ(mRouteNetlink.GetPendingRequestCount(), 4u);
+    EXPECT_EQ(mRouteNetlink.Commit(), OTBR_ERROR_NONE);
+    EXPECT_EQ(mRouteNetlink.GetPendingRequestCount(), 0u);
+
+    EXPECT_NE(RunCommand("ip -6 route show table main").find("fd00:db8::/64 dev rtnl0 proto static metric 1"),
+              std::string::npos);
+    EXPECT_NE(RunCommand("ip -6 route show table 88").find("fd00:db8::/64 dev rtnl1 proto static"),
+              std::string::npos);
+    EXPECT_NE(RunCommand("ip -6 rule show").find("iif rtnl0 lookup 88"), std::string::npos);
+    EXPECT_NE(RunCommand("ip -6 neigh show proxy").find("fd00:db8::1 dev rtnl1 router proxy"), std::string::npos);
+
+    mRouteNetlink.DeleteRoute(prefix, mIfIndex0, RT_TABLE_MAIN, 1);
+    mRouteNetlink.DeleteRule("rtnl0", 88);
+    mRouteNetlink.DeleteRoute(prefix, mIfIndex1, 88, 0);
+    mRouteNetlink.DeleteNeighborProxy(dua, mIfIndex1);
+    EXPECT_EQ(mRouteNetlink.Commit(), OTBR_ERROR_NONE);
+
+    EXPECT_EQ(RunCommand("ip -6 route show table main").find("fd00:db8::/64"), std::string::npos);
+    EXPECT_EQ(RunCommand("ip -6 route show table 88"), "");
+    EXPECT_EQ(RunCommand("ip -6 rule show").find("rtnl0"), std::string::npos);
+    EXPECT_EQ(RunCommand("ip -6 neigh show proxy"), "");
+}
+
+TEST_F(RouteNetlinkTest, ReportsFailedRequestsAndAppliesTheOthers)
+{
+    const Ip6Prefix prefix("fd00:db8::", 64);
+
+    mRouteNetlink.AddRoute(prefix, mIfIndex0, RT_TABLE_MAIN, 0);
+    mRouteNetlink.AddRoute(prefix, mIfIndex0, RT_TABLE_MAIN, 0);
+    mRouteNetlink.AddRule("rtnl0", 88);
+    EXPECT_EQ(mRouteNetlink.Commit(), OTBR_ERROR_ERRNO);
+    EXPECT_EQ(errno, EEXIST);
+
+    EXPECT_NE(RunCommand("ip -6 route show table main").find("fd00:db8::/64 dev rtnl0 proto static"),
+              std::string::npos);
+    EXPECT_NE(RunCommand("ip -6 rule show").find("iif rtnl0 lookup 88"), std::string::npos);
+
+    mRouteNetlink.DeleteNeighborProxy(Ip6Address("fd00:db8::1"), mIfIndex0);
+    EXPECT_EQ(mRouteNetlink.Commit(), OTBR_ERROR_ERRNO);
+    EXPECT_EQ(errno, ENOENT);
+}
+
+// Programs proxy neighbor entries for 500 DUAs in batches, compared with
+// running `ip` for each of them as the Backbone Router did before.
+TEST_F(RouteNetlinkTest, DISABLED_BenchmarkNeighborProxies)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kNumDuas     = 500;
+    static constexpr size_t kNumCommands = 50;
+
+    Clock::time_point start;
+    double            netlinkMs;
+    double            commandMs;
+
+    start = Clock::now();
+    for (size_t i = 0; i < kNumDuas; i++)
+    {
+        Ip6Address dua("fd00:db8::");
+
+        dua.m8[14] = static_cast<uint8_t>(i >> 8);
+        dua.m8[15] = static_cast<uint8_t>(i);
+        mRouteNetlink.AddNeighborProxy(dua, mIfIndex0);
+    }
+    EXPECT_EQ(mRouteNetlink.Commit(), OTBR_ERROR_NONE);
+    netlinkMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    EXPECT_EQ(CountLines(RunCommand("ip -6 neigh show proxy")), kNumDuas);
+
+    start = Clock::now();
+    for (size_t i = 0; i < kNumCommands; i++)
+    {
+        std::string command = "ip -6 neigh add proxy fd00:db8::1:" + std::to_string(i) + " dev rtnl1";
+
+        EXPECT_EQ(system(command.c_str()), 0);
+    }
+    commandMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    printf("Add proxy neighbor entry in us: rtnetlink %.1f, ip command %.1f\n", netlinkMs * 1000 / kNumDuas,
+           commandMs * 1000 / kNumCommands);
+}
+
+#endif // __linux__
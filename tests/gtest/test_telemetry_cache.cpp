@@ -0,0 +1,127 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "utils/telemetry_cache.hpp"
+
+using otbr::Milliseconds;
+using otbr::Seconds;
+using otbr::agent::TelemetryCache;
+
+TEST(TelemetryCache, AssemblesSectionsInOrder)
+{
+    TelemetryCache cache;
+    std::string    bytes;
+    int            firstCount  = 0;
+    int            secondCount = 0;
+
+    cache.AddSection("First", Seconds(10), [&firstCount](std::string &aFragment) {
+        firstCount++;
+        aFragment = "first";
+        return OT_ERROR_NONE;
+    });
+    cache.AddSection("Second", Milliseconds(0), [&secondCount](std::string &aFragment) {
+        secondCount++;
+        aFragment = std::to_string(secondCount);
+        return OT_ERROR_NONE;
+    });
+
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(bytes, "first1");
+
+    // The first section is still fresh, the second one is encoded on every assembly.
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(bytes, "first2");
+    EXPECT_EQ(firstCount, 1);
+    EXPECT_EQ(secondCount, 2);
+
+    {
+        auto stats = cache.GetSectionStats();
+
+        ASSERT_EQ(stats.size(), 2u);
+        EXPECT_EQ(stats[0].mName, "First");
+        EXPECT_EQ(stats[0].mRefreshCount, 1u);
+        EXPECT_EQ(stats[0].mCacheHitCount, 1u);
+        EXPECT_EQ(stats[0].mFragmentSize, 5u);
+        EXPECT_EQ(stats[1].mName, "Second");
+        EXPECT_EQ(stats[1].mRefreshCount, 2u);
+        EXPECT_EQ(stats[1].mCacheHitCount, 0u);
+    }
+}
+
+TEST(TelemetryCache, InvalidatedSectionIsEncodedAgain)
+{
+    TelemetryCache cache;
+    std::string    bytes;
+    int            count = 0;
+    size_t         section;
+
+    section = cache.AddSection("Section", Seconds(10), [&count](std::string &aFragment) {
+        count++;
+        aFragment = std::to_string(count);
+        return OT_ERROR_NONE;
+    });
+
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(bytes, "1");
+
+    cache.Invalidate(section);
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(bytes, "2");
+
+    cache.InvalidateAll();
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_NONE);
+    EXPECT_EQ(bytes, "3");
+}
+
+TEST(TelemetryCache, FailedSectionIsCachedAndReported)
+{
+    TelemetryCache cache;
+    std::string    bytes;
+    int            count = 0;
+
+    cache.AddSection("Good", Seconds(10), [](std::string &aFragment) {
+        aFragment = "good";
+        return OT_ERROR_NONE;
+    });
+    cache.AddSection("Partial", Seconds(10), [&count](std::string &aFragment) {
+        count++;
+        aFragment = "partial";
+        return OT_ERROR_FAILED;
+    });
+
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_FAILED);
+    EXPECT_EQ(bytes, "goodpartial");
+    EXPECT_EQ(cache.Assemble(bytes), OT_ERROR_FAILED);
+    EXPECT_EQ(bytes, "goodpartial");
+    EXPECT_EQ(count, 1);
+}
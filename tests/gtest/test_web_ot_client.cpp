@@ -0,0 +1,366 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "web/web-service/ot_client.hpp"
+
+using otbr::Web::OpenThreadClient;
+using otbr::Web::OpenThreadClientPool;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The commands executed by the web status request.
+const char *const kStatusCommands[] = {"state",       "version",  "version api", "rcp version",    "eui64",
+                                       "channel",     "txpower",  "networkname", "extpanid",       "panid",
+                                       "partitionid", "ipaddr",   "dataset active"};
+
+/**
+ * This class emulates the CLI session socket of the OpenThread daemon.
+ *
+ * Like the daemon, it serves a single session and closes the current session when another client connects. Each
+ * command is answered with its output, a `Done` or `Error` line and the prompt, written separately.
+ */
+class FakeCliDaemon
+{
+public:
+    explicit FakeCliDaemon(const char *aNetifName)
+        : mConnectionCount(0)
+    {
+        struct sockaddr_un sockname;
+
+        memset(&sockname, 0, sizeof(sockname));
+        sockname.sun_family = AF_UNIX;
+        snprintf(sockname.sun_path, sizeof(sockname.sun_path), OPENTHREAD_POSIX_DAEMON_SOCKET_NAME, aNetifName);
+        mPath = sockname.sun_path;
+        unlink(mPath.c_str());
+
+        mListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        EXPECT_EQ(bind(mListenSocket, reinterpret_cast<struct sockaddr *>(&sockname), sizeof(sockname)), 0);
+        EXPECT_EQ(listen(mListenSocket, 1), 0);
+        EXPECT_EQ(pipe(mStopPipe), 0);
+
+        mThread = std::thread([this] { Run(); });
+    }
+
+    ~FakeCliDaemon(void)
+    {
+        EXPECT_EQ(write(mStopPipe[1], "x", 1), 1);
+        mThread.join();
+        close(mListenSocket);
+        close(mStopPipe[0]);
+        close(mStopPipe[1]);
+        unlink(mPath.c_str());
+    }
+
+    uint32_t GetConnectionCount(void) const { return mConnectionCount; }
+
+    // Connects a client which takes the session over, as `ot-ctl` would do.
+    int TakeOverSession(void)
+    {
+        struct sockaddr_un sockname;
+        int                fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        memset(&sockname, 0, sizeof(sockname));
+        sockname.sun_family = AF_UNIX;
+        strncpy(sockname.sun_path, mPath.c_str(), sizeof(sockname.sun_path) - 1);
+        EXPECT_EQ(connect(fd, reinterpret_cast<struct sockaddr *>(&sockname), sizeof(sockname)), 0);
+
+        return fd;
+    }
+
+private:
+    void Run(void)
+    {
+        int         session = -1;
+        std::string input;
+
+        for (;;)
+        {
+            struct pollfd fds[3] = {{mStopPipe[0], POLLIN, 0}, {mListenSocket, POLLIN, 0}, {session, POLLIN, 0}};
+            char          buffer[256];
+            ssize_t       count;
+
+            ASSERT_GT(poll(fds, session == -1 ? 2 : 3, -1), 0);
+
+            if (fds[0].revents != 0)
+            {
+                break;
+            }
+
+            if (fds[1].revents != 0)
+            {
+                if (session != -1)
+                {
+                    close(session);
+                }
+
+                session = accept(mListenSocket, nullptr, nullptr);
+                input.clear();
+                mConnectionCount++;
+                continue;
+            }
+
+            if (session == -1 || fds[2].revents == 0)
+            {
+                continue;
+            }
+
+            count = read(session, buffer, sizeof(buffer));
+            if (count <= 0)
+            {
+                close(session);
+                session = -1;
+                continue;
+            }
+
+            input.append(buffer, count);
+            for (size_t end = input.find('\n'); end != std::string::npos; end = input.find('\n'))
+            {
+                HandleCommand(session, input.substr(0, end));
+                input.erase(0, end + 1);
+            }
+        }
+
+        if (session != -1)
+        {
+            close(session);
+        }
+    }
+
+    // The client may close the session before reading the prompt, which the daemon ignores too.
+    static void Send(int aSession, const std::string &aOutput)
+    {
+        send(aSession, aOutput.data(), aOutput.size(), MSG_NOSIGNAL);
+    }
+
+    static void HandleCommand(int aSession, const std::string &aCommand)
+    {
+        if (aCommand.empty())
+        {
+            Send(aSession, "> ");
+        }
+        else if (aCommand == "invalid")
+        {
+            Send(aSession, "Error 35: InvalidCommand\r\n");
+            Send(aSession, "> ");
+        }
+        else
+        {
+            if (aCommand == "state")
+            {
+                Send(aSession, "leader\r\n");
+            }
+            else if (aCommand == "ipaddr")
+            {
+                Send(aSession, "fd11:22:0:0:0:ff:fe00:fc00\r\n");
+                Send(aSession, "fe80:0:0:0:a8d9:5dd6:54d5:6fb0\r\n");
+            }
+            else if (aCommand != "ifconfig up")
+            {
+                Send(aSession, aCommand + "-value\r\n");
+            }
+
+            Send(aSession, "Done\r\n");
+            Send(aSession, "> ");
+        }
+    }
+
+    std::string           mPath;
+    int                   mListenSocket;
+    int                   mStopPipe[2];
+    std::atomic<uint32_t> mConnectionCount;
+    std::thread           mThread;
+};
+
+std::string MakeNetifName(void)
+{
+    return "wpan-gtest-" + std::to_string(getpid());
+}
+
+bool ExecuteStatusCommands(OpenThreadClient &aClient)
+{
+    bool succeeded = true;
+
+    for (const char *command : kStatusCommands)
+    {
+        succeeded = succeeded && aClient.Execute("%s", command) != nullptr;
+    }
+
+    return succeeded;
+}
+
+} // namespace
+
+TEST(OpenThreadClient, ExecuteReadsUntilResultLine)
+{
+    std::string      netifName = MakeNetifName();
+    FakeCliDaemon    daemon(netifName.c_str());
+    OpenThreadClient client(netifName.c_str());
+    char            *output;
+
+    ASSERT_TRUE(client.Connect());
+
+    output = client.Execute("state");
+    ASSERT_NE(output, nullptr);
+    EXPECT_STREQ(output, "leader");
+
+    output = client.Execute("ipaddr");
+    ASSERT_NE(output, nullptr);
+    EXPECT_STREQ(output, "fd11:22:0:0:0:ff:fe00:fc00\r\nfe80:0:0:0:a8d9:5dd6:54d5:6fb0");
+
+    output = client.Execute("ifconfig up");
+    ASSERT_NE(output, nullptr);
+    EXPECT_STREQ(output, "");
+
+    // An error is reported as soon as the error line is received, instead of waiting for the timeout.
+    {
+        Clock::time_point start = Clock::now();
+
+        EXPECT_EQ(client.Execute("invalid"), nullptr);
+        EXPECT_LT(Clock::now() - start, std::chrono::milliseconds(400));
+    }
+
+    output = client.Execute("networkname");
+    ASSERT_NE(output, nullptr);
+    EXPECT_STREQ(output, "networkname-value");
+    EXPECT_EQ(daemon.GetConnectionCount(), 1u);
+}
+
+TEST(OpenThreadClient, ReconnectsWhenSessionIsTakenOver)
+{
+    std::string      netifName = MakeNetifName();
+    FakeCliDaemon    daemon(netifName.c_str());
+    OpenThreadClient client(netifName.c_str());
+    int              otCtl;
+    char            *output;
+
+    ASSERT_TRUE(client.Connect());
+    ASSERT_NE(client.Execute("state"), nullptr);
+
+    otCtl = daemon.TakeOverSession();
+    while (daemon.GetConnectionCount() < 2)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    output = client.Execute("state");
+    ASSERT_NE(output, nullptr);
+    EXPECT_STREQ(output, "leader");
+    EXPECT_EQ(daemon.GetConnectionCount(), 3u);
+
+    close(otCtl);
+}
+
+TEST(OpenThreadClientPool, RequestsShareOneSession)
+{
+    std::string              netifName = MakeNetifName();
+    FakeCliDaemon            daemon(netifName.c_str());
+    OpenThreadClientPool     pool(netifName.c_str(), 1);
+    std::atomic<int>         failures(0);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&pool, &failures] {
+            for (int j = 0; j < 20; j++)
+            {
+                OpenThreadClientPool::Lease client = pool.Acquire();
+
+                if (!client->Connect() || !ExecuteStatusCommands(*client))
+                {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(daemon.GetConnectionCount(), 1u);
+}
+
+// Compares the latency of the web status request when each request
+// connects its own CLI session, as the web service did before, with
+// the latency when the requests lease the pooled session.
+TEST(OpenThreadClientPool, DISABLED_BenchmarkStatusRequest)
+{
+    static constexpr int kNumRequests = 200;
+
+    std::string          netifName = MakeNetifName();
+    FakeCliDaemon        daemon(netifName.c_str());
+    OpenThreadClientPool pool(netifName.c_str(), 1);
+    Clock::time_point    start;
+    double               connectMs;
+    double               pooledMs;
+
+    start = Clock::now();
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        OpenThreadClient client(netifName.c_str());
+
+        ASSERT_TRUE(client.Connect());
+        ASSERT_TRUE(ExecuteStatusCommands(client));
+    }
+    connectMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (int i = 0; i < kNumRequests; i++)
+    {
+        OpenThreadClientPool::Lease client = pool.Acquire();
+
+        ASSERT_TRUE(client->Connect());
+        ASSERT_TRUE(ExecuteStatusCommands(*client));
+    }
+    pooledMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    EXPECT_EQ(daemon.GetConnectionCount(), static_cast<uint32_t>(kNumRequests + 1));
+
+    printf("%d status requests of %zu commands, mean latency in ms: connect per request %.3f, pooled session %.3f\n",
+           kNumRequests, sizeof(kStatusCommands) / sizeof(kStatusCommands[0]), connectMs / kNumRequests,
+           pooledMs / kNumRequests);
+}
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a tool to decode binary logs.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+#include <time.h>
+
+#include "common/binary_log.hpp"
+#include "common/code_utils.hpp"
+
+static const char kLevelStrings[][8] = {
+    "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
+};
+
+void help(void)
+{
+    printf("log-decoder - decode binary logs of otbr-agent\n"
+           "SYNTAX:\n"
+           "    log-decoder [FILE]\n"
+           "EXAMPLE:\n"
+           "    log-decoder /var/log/otbr-agent.log\n"
+           "    tail -c +1 -f /var/log/otbr-agent.log | log-decoder\n");
+}
+
+// Prints a log as the text logs are written, e.g. `[INFO]-MDNS----: text`.
+void PrintLog(const otbr::BinaryLogReader::Log &aLog)
+{
+    static constexpr size_t kMaxTagSize = 7;
+
+    time_t    seconds = static_cast<time_t>(aLog.mTime / 1000000);
+    struct tm localTime;
+    char      timeString[32];
+
+    localtime_r(&seconds, &localTime);
+    strftime(timeString, sizeof(timeString), "%Y-%m-%d %H:%M:%S", &localTime);
+    printf("%s.%06u ", timeString, static_cast<unsigned int>(aLog.mTime % 1000000));
+
+    if (!aLog.mLogTag.empty())
+    {
+        std::string tag = aLog.mLogTag.substr(0, kMaxTagSize);
+
+        tag.resize(kMaxTagSize + 1, '-');
+        printf("%s-%s: ", kLevelStrings[aLog.mLevel], tag.c_str());
+    }
+
+    printf("%s\n", aLog.mText.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    int                        ret   = EX_USAGE;
+    FILE                      *file  = stdin;
+    otbrError                  error = OTBR_ERROR_NONE;
+    otbr::BinaryLogReader::Log log;
+
+    VerifyOrExit(argc <= 2, help());
+
+    if (argc == 2)
+    {
+        VerifyOrExit(strcmp(argv[1], "-h") != 0 && strcmp(argv[1], "--help") != 0, help());
+        file = fopen(argv[1], "rb");
+        VerifyOrExit(file != nullptr, ret = EX_NOINPUT, fprintf(stderr, "%s: %s\n", argv[1], strerror(errno)));
+    }
+
+    {
+        otbr::BinaryLogReader reader(file);
+
+        while ((error = reader.Read(log)) == OTBR_ERROR_NONE)
+        {
+            PrintLog(log);
+        }
+    }
+
+    VerifyOrExit(error == OTBR_ERROR_NOT_FOUND, ret = EX_DATAERR, fprintf(stderr, "Invalid binary log\n"));
+    ret = EX_OK;
+
+exit:
+    if (file != nullptr && file != stdin)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}